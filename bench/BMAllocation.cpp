@@ -0,0 +1,103 @@
+#include "BenchEnvironment.h"
+#include "Nexpp/Batch/BatchRunner.h"
+#include "Nexpp/Generator/JobArena.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <string>
+
+namespace {
+thread_local std::uint64_t allocation_count = 0;
+
+ProjectSpec allocation_spec()
+{
+  ProjectSpec spec;
+  spec.name      = "service";
+  spec.libraries = {"gtest", "benchmark"};
+  spec.has_flags = true;
+  return spec;
+}
+
+void report_allocations(benchmark::State &state, std::uint64_t allocations)
+{
+  state.counters["allocs_per_project"] = benchmark::Counter(
+      static_cast<double>(allocations),
+      benchmark::Counter::kAvgIterations
+  );
+}
+
+void BM_RenderLayoutAllocations(benchmark::State &state)
+{
+  const ProjectGenerator generator;
+  const ProjectSpec      spec = allocation_spec();
+
+  {
+    const JobArena::Scope warm_up;
+    benchmark::DoNotOptimize(generator.layout(spec));
+  }
+
+  std::uint64_t allocations = 0;
+  for(auto _ : state) {
+    const std::uint64_t   before = allocation_count;
+    const JobArena::Scope arena;
+    benchmark::DoNotOptimize(generator.layout(spec));
+    allocations += allocation_count - before;
+  }
+
+  report_allocations(state, allocations);
+}
+
+void BM_GenerateAllocations(benchmark::State &state)
+{
+  const std::filesystem::path root = bench_root("nexpp_bench_allocation");
+  const ProjectGenerator      generator(
+      GenerationOptions {SyncPolicy::None, IoBackend::Sync}
+  );
+
+  ProjectSpec spec = allocation_spec();
+  spec.destination = root;
+
+  std::filesystem::remove_all(root);
+  std::filesystem::create_directories(root);
+
+  std::uint64_t allocations = 0;
+  std::size_t   project     = 0;
+  for(auto _ : state) {
+    state.PauseTiming();
+    spec.name = "service" + std::to_string(project++);
+    state.ResumeTiming();
+
+    const std::uint64_t before = allocation_count;
+    benchmark::DoNotOptimize(BatchRunner::generate_one(generator, spec));
+    allocations += allocation_count - before;
+  }
+
+  report_allocations(state, allocations);
+  std::filesystem::remove_all(root);
+}
+} // namespace
+
+void *operator new(std::size_t size)
+{
+  ++allocation_count;
+  if(void *pointer = std::malloc(size != 0 ? size : 1)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+BENCHMARK(BM_RenderLayoutAllocations);
+BENCHMARK(BM_GenerateAllocations)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,62 @@
+#include "Nexpp/Data/CMakeBase.h"
+#include "Nexpp/Generator/ContentHasher.h"
+#include "Nexpp/Generator/PreviewRenderer.h"
+#include <benchmark/benchmark.h>
+#include <string>
+
+namespace {
+void BM_CMakeBaseSetupConfig(benchmark::State &state)
+{
+  const CMakeBase   cmake_base;
+  const std::string project_name = "service_" + std::string(16, 'x');
+  const bool        has_flags    = state.range(0) != 0;
+  std::size_t       bytes        = 0;
+
+  for(auto _ : state) {
+    std::string config =
+        cmake_base.setup_config(project_name, Standard::CPP23, has_flags);
+    bytes += config.size();
+    benchmark::DoNotOptimize(config);
+  }
+
+  state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+
+void BM_CMakeBaseWriteConfigToHasher(benchmark::State &state)
+{
+  const CMakeBase cmake_base;
+  ProjectSpec     spec;
+  spec.name      = "service_" + std::string(16, 'x');
+  spec.has_flags = true;
+
+  for(auto _ : state) {
+    ContentHasher hasher;
+    HashSink      sink(hasher);
+    cmake_base.write_config(sink, spec);
+    benchmark::DoNotOptimize(hasher.digest());
+  }
+}
+
+void BM_PreviewRendererKeystroke(benchmark::State &state)
+{
+  PreviewRenderer preview;
+  ProjectSpec     spec;
+  spec.name      = "service";
+  spec.libraries = {"gtest", "benchmark"};
+  spec.perf      = {true, true, true};
+  preview.update(spec);
+
+  const std::size_t base_length = spec.name.size();
+  for(auto _ : state) {
+    spec.name.push_back('x');
+    if(spec.name.size() > base_length + 16) {
+      spec.name.resize(base_length);
+    }
+    benchmark::DoNotOptimize(preview.update(spec));
+  }
+}
+} // namespace
+
+BENCHMARK(BM_CMakeBaseSetupConfig)->ArgName("flags")->Arg(0)->Arg(1);
+BENCHMARK(BM_CMakeBaseWriteConfigToHasher);
+BENCHMARK(BM_PreviewRendererKeystroke);
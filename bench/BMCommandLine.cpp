@@ -0,0 +1,31 @@
+#include "Nexpp/CommandLine/CommandLine.h"
+#include <benchmark/benchmark.h>
+
+namespace {
+void BM_CommandLineSingleProject(benchmark::State &state)
+{
+  const QStringList arguments = {"nexpp", "-n", "service", "-d", "out",
+                                 "-s",    "23"};
+
+  for(auto _ : state) {
+    CommandLine command_line(arguments);
+    benchmark::DoNotOptimize(command_line.get_project_spec());
+  }
+}
+
+void BM_CommandLineFull(benchmark::State &state)
+{
+  const QStringList arguments = {
+      "nexpp", "-n", "service", "-d",     "out",  "-s",   "20",   "-l",
+      "qt,gtest,Qt", "-f",      "--sync", "file", "--io", "uring"
+  };
+
+  for(auto _ : state) {
+    CommandLine command_line(arguments);
+    benchmark::DoNotOptimize(command_line.get_project_spec());
+  }
+}
+} // namespace
+
+BENCHMARK(BM_CommandLineSingleProject);
+BENCHMARK(BM_CommandLineFull);
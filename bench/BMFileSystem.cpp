@@ -0,0 +1,127 @@
+#include "BenchEnvironment.h"
+#include "Nexpp/FileSystem/FileSystem.h"
+#include "Nexpp/FileSystem/MemoryFileSystem.h"
+#include "Nexpp/FileSystem/StagedWriter.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <string>
+
+namespace {
+class FileSystemFixture : public benchmark::Fixture
+{
+public:
+  std::filesystem::path root = bench_root("nexpp_bench_filesystem");
+  DiskFileSystem        file_system;
+
+  void                  SetUp(benchmark::State &) override
+  {
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+  }
+
+  void TearDown(benchmark::State &) override
+  {
+    std::filesystem::remove_all(root);
+  }
+};
+
+BENCHMARK_F(FileSystemFixture, CreateFolder)(benchmark::State &state)
+{
+  std::size_t index = 0;
+  for(auto _ : state) {
+    file_system.create_folder(root, "folder" + std::to_string(index++));
+  }
+}
+
+BENCHMARK_F(FileSystemFixture, CreateFile)(benchmark::State &state)
+{
+  for(auto _ : state) {
+    file_system.create_file(root, "file.txt");
+  }
+}
+
+BENCHMARK_F(FileSystemFixture, PutInFile)(benchmark::State &state)
+{
+  const std::string content(4096, 'x');
+  for(auto _ : state) {
+    file_system.put_in_file(root / "file.txt", content);
+  }
+  state.SetBytesProcessed(
+      state.iterations() * static_cast<std::int64_t>(content.size())
+  );
+}
+
+BENCHMARK_F(FileSystemFixture, AppendInFile)(benchmark::State &state)
+{
+  const std::string content(64, 'x');
+  for(auto _ : state) {
+    file_system.append_in_file(root / "file.txt", content);
+  }
+}
+
+BENCHMARK_F(FileSystemFixture, CreateSymlink)(benchmark::State &state)
+{
+  file_system.create_file(root, "target.txt");
+  std::size_t index = 0;
+  for(auto _ : state) {
+    file_system.create_symlink(
+        root / "target.txt", root / ("link" + std::to_string(index++))
+    );
+  }
+}
+
+class MemoryFileSystemFixture : public benchmark::Fixture
+{
+public:
+  std::filesystem::path root = "nexpp_bench_filesystem";
+  MemoryFileSystem      file_system;
+
+  void                  SetUp(benchmark::State &) override
+  {
+    file_system.clear();
+    file_system.create_folder(".", root.string());
+  }
+};
+
+BENCHMARK_F(MemoryFileSystemFixture, CreateFolder)(benchmark::State &state)
+{
+  std::size_t index = 0;
+  for(auto _ : state) {
+    file_system.create_folder(root, "folder" + std::to_string(index++));
+  }
+}
+
+BENCHMARK_F(MemoryFileSystemFixture, PutInFile)(benchmark::State &state)
+{
+  const std::string content(4096, 'x');
+  for(auto _ : state) {
+    file_system.put_in_file(root / "file.txt", content);
+  }
+  state.SetBytesProcessed(
+      state.iterations() * static_cast<std::int64_t>(content.size())
+  );
+}
+
+BENCHMARK_F(MemoryFileSystemFixture, AppendInFile)(benchmark::State &state)
+{
+  const std::string content(64, 'x');
+  for(auto _ : state) {
+    file_system.append_in_file(root / "file.txt", content);
+  }
+}
+
+BENCHMARK_F(FileSystemFixture, StagedWriterCommit)(benchmark::State &state)
+{
+  const std::string content(1024, 'x');
+  std::size_t       index = 0;
+  for(auto _ : state) {
+    StagedWriter writer(
+        root / ("project" + std::to_string(index++)), SyncPolicy::None
+    );
+    writer.create_folder("src");
+    writer.write_file("CMakeLists.txt", content);
+    writer.write_file("src/main.cpp", content);
+    writer.commit();
+  }
+}
+} // namespace
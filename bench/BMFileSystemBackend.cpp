@@ -0,0 +1,89 @@
+#include "BenchEnvironment.h"
+#include "Nexpp/FileSystem/FileSystemBackend.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <string>
+
+namespace {
+constexpr int kFolders        = 100;
+constexpr int kFilesPerFolder = 100;
+
+void BM_BackendTree10k(benchmark::State &state)
+{
+  const auto                  kind    = static_cast<IoBackend>(state.range(0));
+  const std::filesystem::path root    = bench_root("nexpp_bench_backend");
+  const std::string           content(512, 'x');
+  auto                        backend = make_file_system_backend(kind);
+
+  state.SetLabel(backend->name());
+
+  for(auto _ : state) {
+    state.PauseTiming();
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    state.ResumeTiming();
+
+    for(int folder = 0; folder < kFolders; ++folder) {
+      const std::filesystem::path directory =
+          root / ("dir" + std::to_string(folder));
+      backend->create_folder(directory);
+
+      for(int file = 0; file < kFilesPerFolder; ++file) {
+        backend->write_file(
+            directory / ("file" + std::to_string(file) + ".cpp"), content,
+            false
+        );
+      }
+    }
+    backend->flush();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kFolders * kFilesPerFolder);
+  std::filesystem::remove_all(root);
+}
+
+void BM_BackendLayout10k(benchmark::State &state)
+{
+  const auto                  kind    = static_cast<IoBackend>(state.range(0));
+  const std::filesystem::path root    = bench_root("nexpp_bench_layout");
+  const std::pmr::string      content(512, 'x');
+  auto                        backend = make_file_system_backend(kind);
+
+  LayoutTree                  layout;
+  for(int folder = 0; folder < kFolders; ++folder) {
+    const std::string directory = "dir" + std::to_string(folder);
+    for(int file = 0; file < kFilesPerFolder; ++file) {
+      layout.add_file(
+          directory + "/file" + std::to_string(file) + ".cpp", content
+      );
+    }
+  }
+
+  state.SetLabel(backend->name());
+
+  for(auto _ : state) {
+    state.PauseTiming();
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    state.ResumeTiming();
+
+    backend->write_layout(root, layout, false);
+    backend->flush();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kFolders * kFilesPerFolder);
+  std::filesystem::remove_all(root);
+}
+} // namespace
+
+BENCHMARK(BM_BackendTree10k)
+    ->Arg(static_cast<int>(IoBackend::Sync))
+    ->Arg(static_cast<int>(IoBackend::Uring))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_BackendLayout10k)
+    ->Arg(static_cast<int>(IoBackend::Sync))
+    ->Arg(static_cast<int>(IoBackend::Uring))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
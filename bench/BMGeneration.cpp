@@ -0,0 +1,166 @@
+#include "BenchEnvironment.h"
+#include "Nexpp/Archive/ArchiveWriter.h"
+#include "Nexpp/Batch/BatchRunner.h"
+#include "Nexpp/FileSystem/FileCloner.h"
+#include "Nexpp/FileSystem/MemoryFileSystem.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+void BM_GenerateProjects(benchmark::State &state)
+{
+  const std::filesystem::path root  = bench_root("nexpp_bench_generation");
+  const auto                  count = static_cast<std::size_t>(state.range(0));
+
+  std::vector<ProjectSpec>    specs(count);
+  for(std::size_t i = 0; i < count; ++i) {
+    specs[i].name        = "service" + std::to_string(i);
+    specs[i].destination = root;
+    specs[i].has_flags   = i % 2 == 0;
+  }
+
+  const BatchRunner runner(
+      std::thread::hardware_concurrency(),
+      GenerationOptions {SyncPolicy::None, IoBackend::Sync}
+  );
+
+  for(auto _ : state) {
+    state.PauseTiming();
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(runner.run(specs));
+  }
+
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<std::int64_t>(count)
+  );
+  std::filesystem::remove_all(root);
+}
+
+// Rendering and materialization without any file system syscall.
+void BM_GenerateInMemory(benchmark::State &state)
+{
+  const auto             count = static_cast<std::size_t>(state.range(0));
+  MemoryFileSystem       file_system;
+  const ProjectGenerator generator(GenerationOptions {}, file_system);
+
+  ProjectSpec spec;
+  spec.destination = "/projects";
+
+  for(auto _ : state) {
+    state.PauseTiming();
+    file_system.clear();
+    state.ResumeTiming();
+
+    for(std::size_t i = 0; i < count; ++i) {
+      spec.name      = "service" + std::to_string(i);
+      spec.has_flags = i % 2 == 0;
+      benchmark::DoNotOptimize(generator.generate(spec));
+    }
+  }
+
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<std::int64_t>(count)
+  );
+}
+
+// The same small projects written from rendered content or cloned from a
+// skeleton. The skeleton is stored before timing starts. Without reflinks
+// the generator skips the skeleton, so both runs should then write.
+void BM_GenerateFromSkeleton(benchmark::State &state)
+{
+  const std::filesystem::path root   = bench_root("nexpp_bench_skeleton");
+  const bool                  cached = state.range(0) != 0;
+
+  GenerationOptions           options {SyncPolicy::None, IoBackend::Sync};
+  if(cached) {
+    options.skeleton_cache = root / "skeletons";
+  }
+  const ProjectGenerator generator(options);
+
+  ProjectSpec            spec;
+  spec.name        = "warm_up";
+  spec.destination = root / "projects";
+  spec.libraries   = {"gtest", "benchmark"};
+
+  std::filesystem::remove_all(root);
+  std::filesystem::create_directories(spec.destination);
+  generator.generate(spec);
+
+  std::size_t project = 0;
+  for(auto _ : state) {
+    spec.name = "service" + std::to_string(project++);
+    benchmark::DoNotOptimize(generator.generate(spec));
+  }
+
+  const bool reflinks = FileCloner::supports_reflink(root.c_str());
+  state.SetLabel(cached && reflinks ? "clone" : "write");
+  state.SetItemsProcessed(state.iterations());
+  std::filesystem::remove_all(root);
+}
+
+void BM_ArchiveProjects(benchmark::State &state)
+{
+  const std::filesystem::path root  = bench_root("nexpp_bench_archive");
+  const auto                  count = static_cast<std::size_t>(state.range(0));
+  const auto                  format =
+      static_cast<ArchiveFormat>(state.range(1));
+  const ProjectGenerator      generator;
+
+  std::filesystem::create_directories(root);
+
+  ProjectSpec spec;
+  for(auto _ : state) {
+    std::ofstream out(root / "projects.archive", std::ios::binary);
+    const auto    writer = make_archive_writer(format, out);
+
+    for(std::size_t i = 0; i < count; ++i) {
+      spec.name      = "service" + std::to_string(i);
+      spec.has_flags = i % 2 == 0;
+      generator.archive(spec, *writer);
+    }
+    writer->finish();
+  }
+
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<std::int64_t>(count)
+  );
+  std::filesystem::remove_all(root);
+}
+} // namespace
+
+BENCHMARK(BM_GenerateProjects)
+    ->ArgName("projects")
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_GenerateInMemory)
+    ->ArgName("projects")
+    ->Arg(1)
+    ->Arg(100)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_GenerateFromSkeleton)
+    ->ArgName("skeleton")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_ArchiveProjects)
+    ->ArgNames({"projects", "format"})
+    ->Args({100, static_cast<std::int64_t>(ArchiveFormat::Tar)})
+    ->Args({100, static_cast<std::int64_t>(ArchiveFormat::Zip)})
+    ->Args({10000, static_cast<std::int64_t>(ArchiveFormat::Tar)})
+    ->Args({10000, static_cast<std::int64_t>(ArchiveFormat::Zip)})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
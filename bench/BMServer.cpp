@@ -0,0 +1,68 @@
+#include "BenchEnvironment.h"
+#include "Nexpp/Batch/BatchRunner.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include "Nexpp/Server/GeneratorClient.h"
+#include "Nexpp/Server/GeneratorServer.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <thread>
+
+namespace {
+const GenerationOptions bench_options {SyncPolicy::None, IoBackend::Sync};
+
+void BM_InProcessRequest(benchmark::State &state)
+{
+  const std::filesystem::path root = bench_root("nexpp_bench_in_process");
+  const ProjectGenerator      generator(bench_options);
+
+  ProjectSpec                 spec;
+  spec.name        = "service";
+  spec.destination = root;
+
+  for(auto _ : state) {
+    state.PauseTiming();
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(BatchRunner::generate_one(generator, spec));
+  }
+
+  std::filesystem::remove_all(root);
+}
+
+void BM_DaemonRequest(benchmark::State &state)
+{
+  const std::filesystem::path root = bench_root("nexpp_bench_daemon");
+  std::filesystem::remove_all(root);
+  std::filesystem::create_directories(root);
+
+  GeneratorServer server(root / "nexpp.sock", 2, bench_options);
+  std::thread     loop([&] { server.run(); });
+
+  ProjectSpec     spec;
+  spec.name        = "service";
+  spec.destination = root / "projects";
+
+  for(auto _ : state) {
+    state.PauseTiming();
+    std::filesystem::remove_all(spec.destination);
+    std::filesystem::create_directories(spec.destination);
+    state.ResumeTiming();
+
+    const auto result = GeneratorClient::generate(server.socket_path(), spec);
+    if(!result || !result->success) {
+      state.SkipWithError("Daemon request failed");
+      break;
+    }
+    benchmark::DoNotOptimize(result);
+  }
+
+  server.stop();
+  loop.join();
+  std::filesystem::remove_all(root);
+}
+} // namespace
+
+BENCHMARK(BM_InProcessRequest)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_DaemonRequest)->Unit(benchmark::kMicrosecond)->UseRealTime();
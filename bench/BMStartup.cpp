@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <fcntl.h>
+#include <spawn.h>
+#include <string>
+#include <sys/wait.h>
+#include <vector>
+
+extern char **environ;
+
+namespace {
+#ifdef NEXPP_EXECUTABLE
+int spawn_nexpp(std::vector<std::string> arguments)
+{
+  arguments.insert(arguments.begin(), NEXPP_EXECUTABLE);
+
+  std::vector<char *> argv;
+  for(auto &argument : arguments) {
+    argv.push_back(argument.data());
+  }
+  argv.push_back(nullptr);
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(
+      &actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0
+  );
+
+  pid_t pid    = 0;
+  int   status = -1;
+  if(posix_spawn(&pid, NEXPP_EXECUTABLE, &actions, nullptr, argv.data(),
+                 environ) == 0) {
+    waitpid(pid, &status, 0);
+  }
+
+  posix_spawn_file_actions_destroy(&actions);
+  return status;
+}
+
+void BM_StartupCli(benchmark::State &state)
+{
+  for(auto _ : state) {
+    if(spawn_nexpp({"--mode", "cli", "--version"}) != 0) {
+      state.SkipWithError("Nexpp exited with an error");
+      break;
+    }
+  }
+}
+
+void BM_StartupGui(benchmark::State &state)
+{
+  setenv("QT_QPA_PLATFORM", "offscreen", 0);
+
+  for(auto _ : state) {
+    if(spawn_nexpp({"--mode", "gui", "--version"}) != 0) {
+      state.SkipWithError("Nexpp GUI module failed to start");
+      break;
+    }
+  }
+}
+#endif
+} // namespace
+
+#ifdef NEXPP_EXECUTABLE
+BENCHMARK(BM_StartupCli)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StartupGui)->Unit(benchmark::kMillisecond);
+#endif
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+inline std::filesystem::path bench_root(const std::string &name)
+{
+  if(const char *directory = std::getenv("NEXPP_BENCH_DIR")) {
+    return std::filesystem::path(directory) / name;
+  }
+
+  const std::filesystem::path tmpfs = "/dev/shm";
+  return (std::filesystem::is_directory(tmpfs) ? tmpfs : "/tmp") / name;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <ostream>
+#include <string_view>
+
+#include "Nexpp/Types/ArchiveFormat.h"
+
+class ArchiveWriter
+{
+public:
+  virtual ~ArchiveWriter() = default;
+
+  virtual void add_folder(const std::filesystem::path &path) = 0;
+  virtual void add_file(
+      const std::filesystem::path &path, std::string_view content
+  )                    = 0;
+
+  virtual void finish() = 0;
+};
+
+std::unique_ptr<ArchiveWriter>
+    make_archive_writer(ArchiveFormat format, std::ostream &out);
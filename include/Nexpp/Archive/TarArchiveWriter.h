@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+#include "Nexpp/Archive/ArchiveWriter.h"
+
+class TarArchiveWriter final : public ArchiveWriter
+{
+public:
+  explicit TarArchiveWriter(std::ostream &out);
+
+  void add_folder(const std::filesystem::path &path) override;
+  void add_file(
+      const std::filesystem::path &path, std::string_view content
+  ) override;
+
+  void finish() override;
+
+private:
+  void write_header(
+      const std::string &name, std::uint64_t size, unsigned mode, char type
+  );
+  void          write_padding(std::uint64_t size);
+
+  std::ostream &m_out;
+  std::int64_t  m_mtime;
+  bool          m_finished = false;
+};
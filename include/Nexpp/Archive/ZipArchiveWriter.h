@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Nexpp/Archive/ArchiveWriter.h"
+
+class ZipArchiveWriter final : public ArchiveWriter
+{
+public:
+  explicit ZipArchiveWriter(std::ostream &out);
+
+  void add_folder(const std::filesystem::path &path) override;
+  void add_file(
+      const std::filesystem::path &path, std::string_view content
+  ) override;
+
+  void finish() override;
+
+  static std::uint32_t crc32(std::string_view data);
+
+private:
+  struct Entry
+  {
+    std::string   name;
+    std::uint32_t crc    = 0;
+    std::uint32_t size   = 0;
+    std::uint32_t offset = 0;
+    bool          folder = false;
+  };
+
+  void               add_entry(Entry entry, std::string_view content);
+  void               write(std::string_view bytes);
+
+  std::ostream      &m_out;
+  std::vector<Entry> m_entries;
+  std::uint64_t      m_offset   = 0;
+  std::uint16_t      m_dos_time = 0;
+  std::uint16_t      m_dos_date = 0;
+  bool               m_finished = false;
+};
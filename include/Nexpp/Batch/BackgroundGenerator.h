@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Nexpp/Batch/BatchRunner.h"
+#include "Nexpp/Batch/ThreadPool.h"
+#include "Nexpp/Generator/GenerationControl.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include "Nexpp/Types/GenerationOptions.h"
+#include "Nexpp/Types/ProjectSpec.h"
+
+// Cancelling rolls back the projects the batch created. Existing projects
+// that were already updated keep their changes and are counted in
+// projects_updated.
+struct GenerationProgress
+{
+  std::size_t projects_total   = 0;
+  std::size_t projects_done    = 0;
+  std::size_t projects_failed  = 0;
+  std::size_t projects_updated = 0;
+  std::size_t files_written    = 0;
+  bool        cancelled        = false;
+  bool        finished         = true;
+};
+
+class BackgroundGenerator
+{
+public:
+  explicit BackgroundGenerator(
+      std::size_t       thread_count = std::thread::hardware_concurrency(),
+      GenerationOptions options      = {}
+  );
+  ~BackgroundGenerator();
+
+  BackgroundGenerator(const BackgroundGenerator &)            = delete;
+  BackgroundGenerator &operator=(const BackgroundGenerator &) = delete;
+
+  void                     start(std::vector<ProjectSpec> specs);
+  void                     cancel();
+  void                     wait();
+
+  GenerationProgress       progress() const;
+  std::vector<BatchResult> take_results();
+
+private:
+  void                               run_one(std::size_t index);
+  void                               roll_back_created();
+
+  ProjectGenerator                   m_generator;
+  ThreadPool                         m_pool;
+  GenerationControl                  m_control;
+
+  std::vector<ProjectSpec>           m_specs;
+  std::atomic<std::size_t>           m_done     = 0;
+  std::atomic<std::size_t>           m_failed   = 0;
+  std::atomic<std::size_t>           m_updated  = 0;
+  std::atomic<bool>                  m_finished = true;
+
+  std::mutex                         m_results_mutex;
+  std::vector<BatchResult>           m_results;
+  std::vector<std::filesystem::path> m_created;
+};
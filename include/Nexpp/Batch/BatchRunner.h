@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Nexpp/Generator/GenerationControl.h"
+#include "Nexpp/Generator/GenerationReport.h"
+#include "Nexpp/Types/GenerationOptions.h"
+#include "Nexpp/Types/ProjectSpec.h"
+
+class ProjectGenerator;
+
+struct BatchResult
+{
+  std::string               project_name;
+  GenerationReport          report;
+  bool                      success = false;
+  std::string               error;
+  std::chrono::microseconds duration {0};
+};
+
+class BatchRunner
+{
+public:
+  explicit BatchRunner(
+      std::size_t       thread_count = std::thread::hardware_concurrency(),
+      GenerationOptions options      = {}
+  );
+
+  std::vector<BatchResult> run(const std::vector<ProjectSpec> &specs) const;
+
+  static BatchResult generate_one(
+      const ProjectGenerator &generator, const ProjectSpec &spec,
+      GenerationControl *control = nullptr
+  );
+
+  static void
+      print_report(std::ostream &out, const std::vector<BatchResult> &results);
+
+private:
+  std::size_t       m_thread_count;
+  GenerationOptions m_options;
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <QJsonObject>
+#include <filesystem>
+#include <vector>
+
+#include "Nexpp/Types/ProjectSpec.h"
+
+class Manifest
+{
+public:
+  static std::vector<ProjectSpec> load(const std::filesystem::path &path);
+  static std::vector<ProjectSpec> parse(const QByteArray &content);
+
+  static ProjectSpec
+      parse_project(const QJsonObject &object, const ProjectSpec &defaults);
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+  explicit ThreadPool(
+      std::size_t thread_count = std::thread::hardware_concurrency()
+  );
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &)            = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  void        submit(std::function<void()> task);
+  void        wait_idle();
+
+  std::size_t size() const;
+
+private:
+  struct WorkQueue
+  {
+    std::mutex                        mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void run_worker(std::size_t index);
+  bool pop_local(std::size_t index, std::function<void()> &task);
+  bool steal(std::size_t thief, std::function<void()> &task);
+
+  std::vector<std::unique_ptr<WorkQueue>> m_queues;
+  std::vector<std::thread>                m_workers;
+
+  std::mutex                              m_state_mutex;
+  std::condition_variable                 m_work_available;
+  std::condition_variable                 m_idle;
+  std::size_t                             m_queued   = 0;
+  std::size_t                             m_pending  = 0;
+  std::size_t                             m_next     = 0;
+  bool                                    m_stopping = false;
+};
@@ -1,22 +1,53 @@
 #pragma once
 
-#include <QApplication>
+#include <QCoreApplication>
 #include <QCommandLineParser>
 
 #include "Nexpp/Types/AppMode.h"
+#include "Nexpp/Types/ArchiveFormat.h"
+#include "Nexpp/Types/CompilerFamily.h"
+#include "Nexpp/Types/GenerationOptions.h"
+#include "Nexpp/Types/PerfOptions.h"
+#include "Nexpp/Types/ProjectSpec.h"
 #include "Nexpp/Types/Standard.h"
 
 class CommandLine
 {
 public:
-  explicit CommandLine(const QApplication &application);
+  explicit CommandLine(const QCoreApplication &application);
+  explicit CommandLine(const QStringList &arguments);
 
-  AppMode     get_mode() const;
-  QString     get_project_name() const;
-  QString     get_destination() const;
-  QStringList get_libraries() const;
-  Standard    get_standard() const;
-  bool        has_flags() const;
+  static AppMode peek_mode(int argc, char **argv);
+  static bool    peek_trace(int argc, char **argv);
+
+  AppMode        get_mode() const;
+  QString        get_project_name() const;
+  QString        get_destination() const;
+  QStringList    get_libraries() const;
+  Standard       get_standard() const;
+  bool           has_flags() const;
+  PerfOptions    get_perf_options() const;
+  bool           has_modules() const;
+  CompilerFamily get_compiler() const;
+  bool           should_probe_toolchain() const;
+  QString        get_manifest() const;
+  QString        get_workspace() const;
+  std::size_t    get_jobs() const;
+  SyncPolicy     get_sync_policy() const;
+  IoBackend      get_io_backend() const;
+  QString        get_skeleton_cache() const;
+  QString        get_socket() const;
+  bool           should_connect() const;
+  QString        get_archive() const;
+  ArchiveFormat  get_archive_format() const;
+  bool           is_dry_run() const;
+  QString        get_gtest_import() const;
+  QString        get_trace() const;
+  bool           should_print_stats() const;
+  QString        get_stats_json() const;
+
+  ProjectSpec       get_project_spec() const;
+  GenerationOptions get_generation_options() const;
 
 private:
   void               setup_options();
@@ -27,6 +58,24 @@ private:
   void               add_libraries_option();
   void               add_standards_option();
   void               add_flags_option();
+  void               add_perf_option();
+  void               add_modules_option();
+  void               add_compiler_option();
+  void               add_no_probe_option();
+  void               add_manifest_option();
+  void               add_workspace_option();
+  void               add_jobs_option();
+  void               add_sync_option();
+  void               add_io_backend_option();
+  void               add_skeleton_cache_option();
+  void               add_socket_option();
+  void               add_connect_option();
+  void               add_archive_option();
+  void               add_archive_format_option();
+  void               add_dry_run_option();
+  void               add_import_gtest_option();
+  void               add_trace_option();
+  void               add_stats_options();
 
   QCommandLineOption create_option_with_allowed_values(
       const QStringList &names, const QString &description,
@@ -43,4 +92,25 @@ private:
   QStringList        m_libraries;
   Standard           m_standard;
   bool               m_has_flags;
+  PerfOptions        m_perf;
+  bool               m_modules;
+  CompilerFamily     m_compiler;
+  // Without --compiler the family is only detected once it is asked for.
+  bool               m_has_compiler;
+  bool               m_probe;
+  QString            m_manifest;
+  QString            m_workspace;
+  std::size_t        m_jobs;
+  SyncPolicy         m_sync_policy;
+  IoBackend          m_io_backend;
+  QString            m_skeleton_cache;
+  QString            m_socket;
+  bool               m_connect;
+  QString            m_archive;
+  ArchiveFormat      m_archive_format;
+  bool               m_dry_run;
+  QString            m_gtest_import;
+  QString            m_trace;
+  bool               m_stats;
+  QString            m_stats_json;
 };
@@ -1,13 +1,83 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
+#include "Nexpp/Template/OutputSink.h"
+#include "Nexpp/Types/ProjectSpec.h"
+#include "Nexpp/Types/SpecField.h"
 #include "Nexpp/Types/Standard.h"
 
+enum class ConfigSegment
+{
+  Project,
+  Launcher,
+  Linker,
+  Target,
+  Flags,
+  Ipo,
+  Unity,
+  Pch,
+  Qt,
+  GTest,
+  Benchmark,
+  PgoInclude,
+  Count
+};
+
 class CMakeBase
 {
 public:
   std::string setup_config(
       const std::string &project_name, Standard cpp_standard, bool has_flags
   ) const;
+  // The PgoInclude segment is only emitted with pgo_module, when the caller
+  // also writes cmake/Pgo.cmake next to the configuration.
+  std::string setup_config(
+      const ProjectSpec              &spec,
+      const std::vector<std::string> &precompiled_headers = {},
+      bool                            pgo_module          = false
+  ) const;
+  std::string setup_segment(
+      ConfigSegment segment, const ProjectSpec &spec,
+      const std::vector<std::string> &precompiled_headers = {},
+      bool                            pgo_module          = false
+  ) const;
+  std::string setup_pgo_module(const ProjectSpec &spec) const;
+  std::string setup_dependencies_module() const;
+  std::string setup_presets(const ProjectSpec &spec) const;
+  std::string setup_layout_comparison(const ProjectSpec &spec) const;
+  std::string setup_workspace_config(
+      const ProjectSpec &workspace, const std::vector<ProjectSpec> &projects,
+      const std::vector<std::string> &precompiled_headers = {}
+  ) const;
+  std::string setup_component_config(
+      const ProjectSpec &spec, const ProjectSpec &workspace,
+      const std::vector<std::string> &precompiled_headers = {}
+  ) const;
+
+  void write_config(
+      OutputSink &sink, const ProjectSpec &spec,
+      const std::vector<std::string> &precompiled_headers = {},
+      bool                            pgo_module          = false
+  ) const;
+  void write_pgo_module(OutputSink &sink, const ProjectSpec &spec) const;
+  void write_dependencies_module(OutputSink &sink) const;
+  void write_presets(OutputSink &sink, const ProjectSpec &spec) const;
+  void write_layout_comparison(OutputSink &sink, const ProjectSpec &spec) const;
+
+  // A workspace root holds the settings of workspace, shared by every project
+  // it adds as a subdirectory component, and configures dependencies once.
+  void write_workspace_config(
+      OutputSink &sink, const ProjectSpec &workspace,
+      const std::vector<ProjectSpec> &projects,
+      const std::vector<std::string> &precompiled_headers = {}
+  ) const;
+  void write_component_config(
+      OutputSink &sink, const ProjectSpec &spec, const ProjectSpec &workspace,
+      const std::vector<std::string> &precompiled_headers = {}
+  ) const;
+
+  static std::string option_prefix(const std::string &project_name);
+  static SpecFields  segment_dependencies(ConfigSegment segment) noexcept;
 };
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Nexpp/Template/OutputSink.h"
+
+class SourceBase
+{
+public:
+  std::string setup_main(const std::string &project_name) const;
+  std::string setup_module_main(const std::string &project_name) const;
+  std::string setup_module_interface(const std::string &project_name) const;
+  std::string setup_module_partition(const std::string &project_name) const;
+  std::string setup_benchmark() const;
+  std::string setup_test() const;
+  std::string setup_pch_source() const;
+
+  void write_main(OutputSink &sink, const std::string &project_name) const;
+
+  // The modules layout: main imports the primary interface, which re-exports
+  // a greeting partition that uses import std when the build enables it.
+  void write_module_main(
+      OutputSink &sink, const std::string &project_name
+  ) const;
+  void write_module_interface(
+      OutputSink &sink, const std::string &project_name
+  ) const;
+  void write_module_partition(
+      OutputSink &sink, const std::string &project_name
+  ) const;
+  void write_benchmark(OutputSink &sink) const;
+  void write_test(OutputSink &sink) const;
+  void write_pch_source(OutputSink &sink) const;
+
+  static std::vector<std::string> standard_headers(std::string_view source);
+  static std::string              module_name(std::string_view project_name);
+};
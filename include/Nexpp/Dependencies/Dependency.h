@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+struct Dependency
+{
+  std::string_view name;
+  std::string_view version;
+  std::string_view url;
+  // SHA256 of the archive at url, checked by every download into the store.
+  std::string_view sha256;
+
+  std::string      directory_name() const
+  {
+    return std::string(name) + "-" + std::string(version);
+  }
+};
+
+inline constexpr Dependency googletest_dependency {
+    "googletest", "1.15.2",
+    "https://github.com/google/googletest/releases/download/v1.15.2/"
+    "googletest-1.15.2.tar.gz",
+    "7b42b4d6ed48810c5362c265a17faebe90dc2373c885e5216439d37927f02926"
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Nexpp/Dependencies/Dependency.h"
+
+class DependencyStore
+{
+public:
+  explicit DependencyStore(std::filesystem::path root = default_root());
+
+  const std::filesystem::path &root() const;
+  std::filesystem::path        source_dir(const Dependency &dependency) const;
+  bool                         has_source(const Dependency &dependency) const;
+  std::filesystem::path        import_source(
+      const Dependency &dependency, const std::filesystem::path &archive
+  ) const;
+
+  static std::filesystem::path default_root();
+
+private:
+  std::filesystem::path m_root;
+};
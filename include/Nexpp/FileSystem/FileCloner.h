@@ -0,0 +1,24 @@
+#pragma once
+
+enum class CloneMethod
+{
+  Reflink,
+  CopyRange,
+  Copy
+};
+
+// Copies a file by sharing its extents when the file system supports reflinks,
+// then through copy_file_range, and finally through read/write.
+class FileCloner
+{
+public:
+  // Creates target relative to directory_fd, or to the working directory when
+  // it is AT_FDCWD.
+  static CloneMethod clone(
+      const char *source, int directory_fd, const char *target, bool sync
+  );
+
+  // Whether files in directory can share extents. Without that, a clone is a
+  // copy through the kernel and costs more syscalls than writing the content.
+  static bool supports_reflink(const char *directory);
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <unistd.h>
+#include <utility>
+
+class FileDescriptor
+{
+public:
+  FileDescriptor() = default;
+  explicit FileDescriptor(int fd) noexcept : m_fd(fd) {}
+
+  ~FileDescriptor()
+  {
+    reset();
+  }
+
+  FileDescriptor(const FileDescriptor &)            = delete;
+  FileDescriptor &operator=(const FileDescriptor &) = delete;
+
+  FileDescriptor(FileDescriptor &&other) noexcept : m_fd(other.release()) {}
+
+  FileDescriptor &operator=(FileDescriptor &&other) noexcept
+  {
+    if(this != &other) {
+      reset(other.release());
+    }
+    return *this;
+  }
+
+  int get() const noexcept
+  {
+    return m_fd;
+  }
+
+  bool is_valid() const noexcept
+  {
+    return m_fd >= 0;
+  }
+
+  int release() noexcept
+  {
+    return std::exchange(m_fd, -1);
+  }
+
+  void reset(int fd = -1) noexcept
+  {
+    if(m_fd >= 0) {
+      ::close(m_fd);
+    }
+    m_fd = fd;
+  }
+
+private:
+  int m_fd = -1;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+#include "Nexpp/FileSystem/FileDescriptor.h"
+#include "Nexpp/Template/OutputSink.h"
+
+// Buffers rendered output and writes it straight to a file descriptor.
+// Nothing is reported if the sink is destroyed without close().
+class FileSink final : public OutputSink
+{
+public:
+  enum class Mode
+  {
+    Truncate,
+    Append
+  };
+
+  explicit FileSink(
+      const std::filesystem::path &path, Mode mode = Mode::Truncate
+  );
+
+  FileSink(const FileSink &)            = delete;
+  FileSink &operator=(const FileSink &) = delete;
+
+  void write(std::string_view data) override;
+  void close(bool sync = false);
+
+private:
+  static constexpr std::size_t buffer_size = 16 * 1024;
+
+  void                          flush();
+  void                          write_through(std::string_view data);
+
+  std::filesystem::path         m_path;
+  FileDescriptor                m_file;
+  std::array<char, buffer_size> m_buffer;
+  std::size_t                   m_buffered = 0;
+};
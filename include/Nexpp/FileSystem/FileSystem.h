@@ -1,18 +1,52 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
 
 class FileSystem
 {
 public:
-  static void
-      create_folder(std::filesystem::path path, std::string folder_name);
-  static void create_file(std::filesystem::path path, std::string filename);
+  virtual ~FileSystem() = default;
 
-  static void put_in_file(std::filesystem::path path, std::string content);
-  static void append_in_file(std::filesystem::path path, std::string content);
+  virtual void
+      create_folder(std::filesystem::path path, std::string folder_name) = 0;
+  virtual void
+      create_file(std::filesystem::path path, std::string filename) = 0;
 
-  static void create_symlink(
+  virtual void
+      put_in_file(std::filesystem::path path, std::string_view content) = 0;
+  virtual void append_in_file(
+      std::filesystem::path path, std::string_view content
+  ) = 0;
+
+  virtual void create_symlink(
+      std::filesystem::path origin, std::filesystem::path destination
+  ) = 0;
+
+  virtual bool exists(const std::filesystem::path &path) const = 0;
+  virtual std::optional<std::string>
+      read_file(const std::filesystem::path &path) const = 0;
+};
+
+class DiskFileSystem final : public FileSystem
+{
+public:
+  void create_folder(std::filesystem::path path, std::string folder_name)
+      override;
+  void create_file(std::filesystem::path path, std::string filename) override;
+
+  void put_in_file(std::filesystem::path path, std::string_view content)
+      override;
+  void append_in_file(std::filesystem::path path, std::string_view content)
+      override;
+
+  void create_symlink(
       std::filesystem::path origin, std::filesystem::path destination
-  );
+  ) override;
+
+  bool exists(const std::filesystem::path &path) const override;
+  std::optional<std::string>
+      read_file(const std::filesystem::path &path) const override;
 };
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+#include "Nexpp/FileSystem/LayoutTree.h"
+#include "Nexpp/Types/IoBackend.h"
+
+class FileSystemBackend
+{
+public:
+  virtual ~FileSystemBackend() = default;
+
+  virtual void create_folder(const std::filesystem::path &path) = 0;
+  // Backends may queue the write until flush(), so content must stay alive
+  // until flush() or discard() returns.
+  virtual void write_file(
+      const std::filesystem::path &path, std::string_view content, bool sync
+  )                           = 0;
+  virtual void clone_file(
+      const std::filesystem::path &source, const std::filesystem::path &target,
+      bool sync
+  );
+  // Like folders, a queued symlink is only created once flush() has made its
+  // parent folder.
+  virtual void create_symlink(
+      const std::filesystem::path &target, const std::filesystem::path &link
+  );
+  virtual void write_layout(
+      const std::filesystem::path &root, const LayoutTree &layout, bool sync
+  );
+
+  virtual void        flush()            = 0;
+  virtual void        discard() noexcept = 0;
+
+  virtual const char *name() const = 0;
+};
+
+class SyncFileSystemBackend final : public FileSystemBackend
+{
+public:
+  void create_folder(const std::filesystem::path &path) override;
+  void write_file(
+      const std::filesystem::path &path, std::string_view content, bool sync
+  ) override;
+  void write_layout(
+      const std::filesystem::path &root, const LayoutTree &layout, bool sync
+  ) override;
+
+  void        flush() override;
+  void        discard() noexcept override;
+
+  const char *name() const override;
+};
+
+std::unique_ptr<FileSystemBackend> make_file_system_backend(IoBackend backend);
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class LayoutKind
+{
+  Folder,
+  File,
+  Symlink,
+  Clone
+};
+
+struct LayoutNode
+{
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+
+  LayoutNode() = default;
+
+  explicit LayoutNode(const allocator_type &allocator)
+      : name(allocator), content(allocator), children(allocator)
+  {
+  }
+
+  LayoutNode(const LayoutNode &other, const allocator_type &allocator)
+      : kind(other.kind), name(other.name, allocator),
+        content(other.content, allocator), children(other.children, allocator)
+  {
+  }
+
+  LayoutNode(LayoutNode &&other, const allocator_type &allocator)
+      : kind(other.kind), name(std::move(other.name), allocator),
+        content(std::move(other.content), allocator),
+        children(std::move(other.children), allocator)
+  {
+  }
+
+  LayoutNode(const LayoutNode &)            = default;
+  LayoutNode(LayoutNode &&)                 = default;
+  LayoutNode &operator=(const LayoutNode &) = default;
+  LayoutNode &operator=(LayoutNode &&)      = default;
+
+  LayoutKind                   kind = LayoutKind::Folder;
+  std::pmr::string             name;
+  std::pmr::string             content;
+  std::pmr::vector<LayoutNode> children;
+};
+
+// Nodes and their contents live in the memory resource given at construction,
+// which must outlive the tree.
+class LayoutTree
+{
+public:
+  // Visited paths are relative and '/'-separated, and only valid during the
+  // call.
+  using Visitor = std::function<void(std::string_view, const LayoutNode &)>;
+
+  explicit LayoutTree(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+  );
+
+  // Entry paths are relative and '/'-separated.
+  void add_folder(std::string_view path);
+  void add_file(std::string_view path, std::pmr::string content);
+  void add_symlink(std::string_view path, const std::filesystem::path &target);
+  void add_clone(std::string_view path, const std::filesystem::path &source);
+
+  const LayoutNode &root() const;
+  bool              empty() const;
+  std::size_t       size() const;
+
+  void              for_each(const Visitor &visitor) const;
+  std::uint64_t     hash() const;
+
+  void materialize(int directory_fd, bool sync) const;
+
+private:
+  LayoutNode &
+      insert(std::string_view path, LayoutKind kind, std::pmr::string content);
+
+  LayoutNode  m_root;
+  std::size_t m_size = 0;
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string_view>
+#include <vector>
+
+#include "Nexpp/FileSystem/FileSystem.h"
+
+class MemoryFileSystem final : public FileSystem
+{
+public:
+  void create_folder(std::filesystem::path path, std::string folder_name)
+      override;
+  void create_file(std::filesystem::path path, std::string filename) override;
+
+  void put_in_file(std::filesystem::path path, std::string_view content)
+      override;
+  void append_in_file(std::filesystem::path path, std::string_view content)
+      override;
+
+  void create_symlink(
+      std::filesystem::path origin, std::filesystem::path destination
+  ) override;
+
+  bool exists(const std::filesystem::path &path) const override;
+  std::optional<std::string>
+      read_file(const std::filesystem::path &path) const override;
+
+  std::optional<std::string_view>
+              view_file(const std::filesystem::path &path) const;
+
+  std::size_t arena_size() const;
+  std::size_t live_bytes() const;
+  void        clear();
+
+private:
+  struct Extent
+  {
+    std::size_t offset = 0;
+    std::size_t size   = 0;
+  };
+
+  static std::filesystem::path normalize(const std::filesystem::path &path);
+
+  std::filesystem::path resolve(std::filesystem::path path) const;
+  void require_parent(const std::filesystem::path &path) const;
+  void store(const std::filesystem::path &path, std::string_view content);
+  void compact();
+
+  using PathMap = std::map<std::filesystem::path, std::filesystem::path>;
+
+  std::vector<char>                       m_arena;
+  std::map<std::filesystem::path, Extent> m_files;
+  std::set<std::filesystem::path>         m_folders;
+  PathMap                                 m_symlinks;
+  std::size_t                             m_live_bytes = 0;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <deque>
+#include <filesystem>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "Nexpp/FileSystem/FileSystemBackend.h"
+#include "Nexpp/FileSystem/LayoutTree.h"
+#include "Nexpp/Types/SyncPolicy.h"
+
+// The staged paths and contents are kept in the memory resource given at
+// construction, which must outlive the writer.
+class StagedWriter
+{
+public:
+  StagedWriter(std::filesystem::path destination, SyncPolicy policy);
+  StagedWriter(
+      std::filesystem::path destination, SyncPolicy policy,
+      FileSystemBackend         &backend,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+  );
+  ~StagedWriter();
+
+  StagedWriter(const StagedWriter &)            = delete;
+  StagedWriter &operator=(const StagedWriter &) = delete;
+
+  void create_folder(const std::filesystem::path &relative_path);
+  void write_file(
+      const std::filesystem::path &relative_path, std::string content
+  );
+  void write_layout(const LayoutTree &layout);
+
+  void commit();
+  void rollback() noexcept;
+
+  const std::filesystem::path &staging_path() const;
+
+private:
+  void                               sync_staged_tree() const;
+  void                               publish_into_existing() const;
+
+  std::filesystem::path              m_destination;
+  std::filesystem::path              m_staging;
+  SyncPolicy                         m_policy;
+  FileSystemBackend                 &m_backend;
+  std::pmr::vector<std::pmr::string> m_folders;
+  std::pmr::vector<std::pmr::string> m_files;
+  std::pmr::deque<std::string>       m_contents;
+  bool                               m_finished = false;
+};
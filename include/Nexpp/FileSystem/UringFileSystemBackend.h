@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "Nexpp/FileSystem/FileSystemBackend.h"
+
+class UringFileSystemBackend final : public FileSystemBackend
+{
+public:
+  static std::unique_ptr<UringFileSystemBackend>
+      create(unsigned queue_depth = 256);
+
+  ~UringFileSystemBackend() override;
+
+  void create_folder(const std::filesystem::path &path) override;
+  void write_file(
+      const std::filesystem::path &path, std::string_view content, bool sync
+  ) override;
+  void clone_file(
+      const std::filesystem::path &source, const std::filesystem::path &target,
+      bool sync
+  ) override;
+  void create_symlink(
+      const std::filesystem::path &target, const std::filesystem::path &link
+  ) override;
+
+  void        flush() override;
+  void        discard() noexcept override;
+
+  const char *name() const override;
+
+private:
+  struct Ring;
+
+  struct PendingClone
+  {
+    std::filesystem::path source;
+    std::filesystem::path target;
+    bool                  sync = false;
+  };
+
+  struct PendingSymlink
+  {
+    std::filesystem::path target;
+    std::filesystem::path link;
+  };
+
+  struct PendingFile
+  {
+    std::filesystem::path path;
+    std::string_view      content;
+    bool                  sync    = false;
+    int                   fd      = -1;
+    std::size_t           written = 0;
+    bool                  closed  = false;
+  };
+
+  explicit UringFileSystemBackend(std::unique_ptr<Ring> ring);
+
+  void flush_folders();
+  void flush_symlinks();
+  void flush_files(std::size_t first, std::size_t last);
+  void flush_clones();
+  void finish_file(PendingFile &file);
+  void record_error(int error, const std::filesystem::path &path);
+
+  std::unique_ptr<Ring>              m_ring;
+  std::vector<std::filesystem::path> m_folders;
+  std::vector<PendingSymlink>        m_symlinks;
+  std::vector<PendingFile>           m_files;
+  std::vector<PendingClone>          m_clones;
+  std::error_code                    m_error;
+  std::filesystem::path              m_error_path;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Nexpp/Template/OutputSink.h"
+
+class ContentHasher
+{
+public:
+  explicit ContentHasher(std::uint64_t seed = 0);
+
+  void                 update(std::string_view data);
+  std::uint64_t        digest() const;
+
+  static std::uint64_t hash(std::string_view data);
+
+private:
+  std::uint64_t m_seed;
+  std::uint64_t m_lanes[4];
+  unsigned char m_buffer[32];
+  std::size_t   m_buffered = 0;
+  std::uint64_t m_length   = 0;
+};
+
+class HashSink final : public OutputSink
+{
+public:
+  explicit HashSink(ContentHasher &hasher) : m_hasher(hasher) {}
+
+  void write(std::string_view data) override
+  {
+    m_hasher.update(data);
+  }
+
+private:
+  ContentHasher &m_hasher;
+};
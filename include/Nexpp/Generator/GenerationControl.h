@@ -0,0 +1,15 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+struct GenerationControl
+{
+  std::atomic<bool>        cancelled     = false;
+  std::atomic<std::size_t> files_written = 0;
+
+  bool                     is_cancelled() const noexcept
+  {
+    return cancelled.load(std::memory_order_relaxed);
+  }
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Nexpp/Generator/PathList.h"
+
+struct GenerationReport
+{
+  std::filesystem::path root;
+  PathList              written;
+  PathList              unchanged;
+  PathList              conflicts;
+};
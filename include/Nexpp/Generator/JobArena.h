@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+// Monotonic arena backing the transient allocations of one generation job.
+// Every thread keeps its own arena between jobs. Leaving the outermost scope
+// drops everything at once, and a job that overflowed the first block grows
+// it for the next one, so steady-state jobs stay off the global heap.
+class JobArena
+{
+public:
+  class Scope
+  {
+  public:
+    Scope();
+    ~Scope();
+
+    Scope(const Scope &)            = delete;
+    Scope &operator=(const Scope &) = delete;
+  };
+
+  static std::pmr::memory_resource *current() noexcept;
+  static std::size_t                capacity() noexcept;
+};
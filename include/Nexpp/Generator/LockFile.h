@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Nexpp/Template/OutputSink.h"
+
+class LockFile
+{
+public:
+  using Entries = std::pmr::map<std::pmr::string, std::uint64_t, std::less<>>;
+
+  static constexpr const char *file_name = ".nexpp-lock";
+
+  LockFile() = default;
+  explicit LockFile(std::pmr::memory_resource *resource);
+
+  static LockFile              load(const std::filesystem::path &project_root);
+  static LockFile              parse(std::string_view content);
+
+  // Paths are relative and '/'-separated, as they appear in the lock file.
+  std::optional<std::uint64_t> find(std::string_view path) const;
+  void           set(std::string_view path, std::uint64_t hash);
+  const Entries &entries() const;
+
+  std::string serialize() const;
+  void        write_to(OutputSink &sink) const;
+
+  bool        operator==(const LockFile &other) const = default;
+
+private:
+  Entries m_entries;
+};
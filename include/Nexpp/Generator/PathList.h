@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Relative '/'-separated paths packed into one buffer, so a list costs two
+// allocations however many files it holds. Every path is followed by a null
+// character, so data() of an entry is also a C string.
+class PathList
+{
+public:
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::string_view;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = std::string_view;
+
+    const_iterator() = default;
+    const_iterator(const PathList *list, std::size_t index)
+        : m_list(list), m_index(index)
+    {
+    }
+
+    std::string_view operator*() const
+    {
+      return (*m_list)[m_index];
+    }
+
+    const_iterator &operator++()
+    {
+      ++m_index;
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const_iterator previous = *this;
+      ++m_index;
+      return previous;
+    }
+
+    bool operator==(const const_iterator &other) const = default;
+
+  private:
+    const PathList *m_list  = nullptr;
+    std::size_t     m_index = 0;
+  };
+
+  using iterator   = const_iterator;
+  using value_type = std::string_view;
+
+  PathList() = default;
+  PathList(std::initializer_list<std::string_view> paths);
+
+  // Makes room for count paths of bytes characters in total.
+  void             reserve(std::size_t count, std::size_t bytes);
+  void             push_back(std::string_view path);
+
+  bool             empty() const noexcept;
+  std::size_t      size() const noexcept;
+  std::string_view front() const;
+  std::string_view operator[](std::size_t index) const;
+
+  const_iterator   begin() const noexcept;
+  const_iterator   end() const noexcept;
+
+  bool             operator==(const PathList &other) const = default;
+
+private:
+  std::string              m_buffer;
+  std::vector<std::size_t> m_offsets;
+};
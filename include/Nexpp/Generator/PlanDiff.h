@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include "Nexpp/FileSystem/FileSystem.h"
+#include "Nexpp/Generator/ProjectPlan.h"
+
+class PlanDiff
+{
+public:
+  static std::string project(
+      const std::filesystem::path &root, const ProjectPlan &plan,
+      const FileSystem &file_system
+  );
+
+  static std::string unified(
+      std::string_view before, std::string_view after,
+      const std::string &before_label, const std::string &after_label,
+      std::size_t context = 3
+  );
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Nexpp/Data/CMakeBase.h"
+#include "Nexpp/Data/SourceBase.h"
+#include "Nexpp/Generator/ProjectPlan.h"
+#include "Nexpp/Types/ProjectSpec.h"
+
+// Keeps the last rendered plan and, on update, re-renders only the CMake
+// segments and files whose inputs changed. The result always equals
+// ProjectGenerator::render for the same spec.
+class PreviewRenderer
+{
+public:
+  const ProjectPlan &update(const ProjectSpec &spec);
+
+  const ProjectPlan &plan() const;
+  std::size_t        rendered_parts() const;
+
+private:
+  static constexpr std::size_t segment_count =
+      static_cast<std::size_t>(ConfigSegment::Count);
+
+  void render_segments(SpecFields changed);
+  void render_files(SpecFields changed);
+  void assemble_config();
+
+  CMakeBase                              m_cmake_base;
+  SourceBase                             m_source_base;
+
+  std::optional<ProjectSpec>             m_spec;
+  std::vector<std::string>               m_headers;
+  std::array<std::string, segment_count> m_segments;
+  ProjectPlan                            m_plan;
+  std::size_t                            m_rendered = 0;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+
+#include "Nexpp/Archive/ArchiveWriter.h"
+#include "Nexpp/Data/CMakeBase.h"
+#include "Nexpp/Data/SourceBase.h"
+#include "Nexpp/FileSystem/FileSystem.h"
+#include "Nexpp/FileSystem/LayoutTree.h"
+#include "Nexpp/Generator/GenerationControl.h"
+#include "Nexpp/Generator/GenerationReport.h"
+#include "Nexpp/Generator/LockFile.h"
+#include "Nexpp/Generator/ProjectPlan.h"
+#include "Nexpp/Generator/SkeletonCache.h"
+#include "Nexpp/Types/GenerationOptions.h"
+#include "Nexpp/Types/ProjectSpec.h"
+#include "Nexpp/Types/WorkspaceSpec.h"
+
+class ProjectGenerator
+{
+public:
+  explicit ProjectGenerator(GenerationOptions options = {});
+  // Projects are read from and written into file_system, which must outlive
+  // the generator, instead of being staged on disk. No skeleton is cloned.
+  ProjectGenerator(GenerationOptions options, FileSystem &file_system);
+
+  GenerationReport generate(
+      const ProjectSpec &spec, GenerationControl *control = nullptr
+  ) const;
+  GenerationReport generate_workspace(
+      const WorkspaceSpec &workspace, GenerationControl *control = nullptr
+  ) const;
+
+  // Within a JobArena::Scope the plan and layout are allocated in the arena
+  // and must not outlive the scope.
+  ProjectPlan      render(const ProjectSpec &spec) const;
+  ProjectPlan      render_workspace(const WorkspaceSpec &workspace) const;
+  LayoutTree       layout(const ProjectSpec &spec) const;
+  void archive(const ProjectSpec &spec, ArchiveWriter &writer) const;
+
+private:
+  // Without a spec no skeleton is looked up and every file is written. The
+  // root moves into the returned report.
+  GenerationReport create_project(
+      std::filesystem::path root, ProjectPlan plan, const ProjectSpec *spec,
+      GenerationControl *control
+  ) const;
+  GenerationReport update_project(
+      std::filesystem::path root, ProjectPlan plan, GenerationControl *control
+  ) const;
+  void publish(
+      const std::filesystem::path &root, const LayoutTree &layout,
+      const GenerationReport &report, GenerationControl *control
+  ) const;
+
+  bool exists(const std::filesystem::path &path) const;
+  std::optional<std::uint64_t>
+           hash_existing(const std::filesystem::path &path) const;
+  LockFile load_lock(const std::filesystem::path &root) const;
+
+  GenerationOptions m_options;
+  CMakeBase         m_cmake_base;
+  SourceBase        m_source_base;
+
+  std::shared_ptr<SkeletonCache> m_skeletons;
+  FileSystem                    *m_file_system = nullptr;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Paths are relative and '/'-separated, so they can live in the job arena
+// next to the content instead of in heap-allocated std::filesystem::path.
+struct PlannedFile
+{
+  std::pmr::string path;
+  std::pmr::string content;
+};
+
+struct ProjectPlan
+{
+  std::pmr::vector<std::pmr::string> folders;
+  std::pmr::vector<PlannedFile>      files;
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Nexpp/FileSystem/LayoutTree.h"
+#include "Nexpp/Generator/ProjectPlan.h"
+#include "Nexpp/Types/ProjectSpec.h"
+
+// The files of one spec combination that do not depend on the project name.
+// A pattern may contain name_token, which stands for the project name.
+class Skeleton
+{
+public:
+  static constexpr std::string_view name_token = "@name@";
+
+  struct File
+  {
+    std::string   pattern;
+    std::uint64_t hash = 0;
+
+    bool          operator==(const File &other) const = default;
+  };
+
+  Skeleton(
+      std::filesystem::path directory, std::vector<File> files,
+      bool reflinks = false
+  );
+
+  const std::filesystem::path &directory() const;
+  const std::vector<File>     &files() const;
+  // Cloning only beats writing when the clone shares the stored extents.
+  bool                         reflinks() const;
+
+  // Returns the stored copy of path when it holds exactly the given content.
+  std::optional<std::filesystem::path> find(
+      std::string_view path, std::string_view project_name, std::uint64_t hash
+  ) const;
+
+private:
+  std::filesystem::path m_directory;
+  std::vector<File>     m_files;
+  bool                  m_reflinks;
+};
+
+// Keeps one skeleton directory per combination of everything in a spec but
+// its name and destination. A skeleton is rendered and written once, then new
+// projects clone its files instead of writing them. The key does not cover
+// the templates, so a stored skeleton is checked against a fresh render the
+// first time it is acquired and rewritten when the two disagree.
+class SkeletonCache
+{
+public:
+  using Renderer = std::function<ProjectPlan(const ProjectSpec &)>;
+
+  explicit SkeletonCache(std::filesystem::path root);
+
+  const std::filesystem::path    &root() const;
+  std::filesystem::path           directory(const ProjectSpec &spec) const;
+  std::shared_ptr<const Skeleton> acquire(
+      const ProjectSpec &spec, const Renderer &render
+  );
+
+  static std::uint64_t key(const ProjectSpec &spec);
+
+private:
+  static std::shared_ptr<const Skeleton>
+      load(const std::filesystem::path &directory);
+  static std::shared_ptr<const Skeleton> store(
+      const std::filesystem::path &directory, const LayoutTree &layout,
+      std::vector<Skeleton::File> files
+  );
+
+  std::filesystem::path m_root;
+  std::mutex            m_mutex;
+  std::unordered_map<std::uint64_t, std::shared_ptr<const Skeleton>>
+      m_skeletons;
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <QtGlobal>
+
+inline constexpr const char *GUI_ENTRY_POINT = "nexpp_run_gui";
+
+using GuiEntryPoint                          = int (*)(int &argc, char **argv);
+
+extern "C" Q_DECL_EXPORT int nexpp_run_gui(int &argc, char **argv);
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <QCheckBox>
+#include <QComboBox>
+#include <QLabel>
+#include <QLineEdit>
+#include <QListWidget>
+#include <QPlainTextEdit>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QTimer>
+#include <QStringList>
+#include <QWidget>
+#include <vector>
+
+#include "Nexpp/Batch/BackgroundGenerator.h"
+#include "Nexpp/CommandLine/CommandLine.h"
+#include "Nexpp/Generator/PreviewRenderer.h"
+
+class MainWindow : public QWidget
+{
+public:
+  explicit MainWindow(
+      const CommandLine &command_line, QWidget *parent = nullptr
+  );
+
+private:
+  void                     setup_form(const CommandLine &command_line);
+  void                     setup_actions();
+
+  ProjectSpec              form_spec() const;
+  void                     probe_toolchain(ProjectSpec &spec) const;
+  std::vector<ProjectSpec> requested_specs() const;
+
+  void                     start_generation();
+  void                     refresh_progress();
+  void                     refresh_preview();
+  void                     show_preview_file();
+
+  BackgroundGenerator      m_generator;
+  ProjectSpec              m_defaults;
+  bool                     m_probe_toolchain = true;
+  QTimer                   m_refresh_timer;
+  PreviewRenderer          m_preview;
+  QTimer                   m_preview_timer;
+  QStringList              m_preview_paths;
+
+  QLineEdit               *m_name        = nullptr;
+  QLineEdit               *m_destination = nullptr;
+  QLineEdit               *m_manifest    = nullptr;
+  QComboBox               *m_standard    = nullptr;
+  QCheckBox               *m_flags       = nullptr;
+  QCheckBox               *m_modules     = nullptr;
+  std::vector<QCheckBox *> m_libraries;
+
+  QPushButton             *m_generate = nullptr;
+  QPushButton             *m_cancel   = nullptr;
+  QProgressBar            *m_progress = nullptr;
+  QLabel                  *m_status   = nullptr;
+  QListWidget             *m_results  = nullptr;
+
+  QComboBox               *m_preview_file = nullptr;
+  QPlainTextEdit          *m_preview_text = nullptr;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+
+#include "Nexpp/Batch/BatchRunner.h"
+#include "Nexpp/Types/ProjectSpec.h"
+
+class GeneratorClient
+{
+public:
+  static std::optional<BatchResult> generate(
+      const std::filesystem::path &socket_path, const ProjectSpec &spec
+  );
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "Nexpp/Batch/ThreadPool.h"
+#include "Nexpp/FileSystem/FileDescriptor.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include "Nexpp/Types/GenerationOptions.h"
+
+class GeneratorServer
+{
+public:
+  GeneratorServer(
+      std::filesystem::path socket_path,
+      std::size_t           thread_count = std::thread::hardware_concurrency(),
+      GenerationOptions     options      = {}
+  );
+  ~GeneratorServer();
+
+  GeneratorServer(const GeneratorServer &)            = delete;
+  GeneratorServer &operator=(const GeneratorServer &) = delete;
+
+  void                         run();
+  void                         stop() noexcept;
+
+  const std::filesystem::path &socket_path() const;
+
+  static std::filesystem::path default_socket_path();
+
+  // Longest request line accepted; longer ones close the connection.
+  static constexpr std::size_t max_request_length = 64 * 1024;
+
+private:
+  // Connections are polled by run() and only occupy a pool worker while one
+  // of their requests is being generated.
+  struct Connection
+  {
+    FileDescriptor    socket;
+    std::string       pending;
+    std::atomic<bool> busy   = false;
+    std::atomic<bool> closed = false;
+  };
+
+  void                  receive(Connection &connection) const;
+  void                  dispatch(const std::shared_ptr<Connection> &connection);
+
+  std::filesystem::path m_socket_path;
+  FileDescriptor        m_listener;
+  FileDescriptor        m_wakeup;
+  FileDescriptor        m_completed;
+  ProjectGenerator      m_generator;
+  ThreadPool            m_pool;
+};
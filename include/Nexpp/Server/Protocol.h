@@ -0,0 +1,16 @@
+#pragma once
+
+#include <QByteArray>
+
+#include "Nexpp/Batch/BatchRunner.h"
+#include "Nexpp/Types/ProjectSpec.h"
+
+class Protocol
+{
+public:
+  static QByteArray  encode_request(const ProjectSpec &spec);
+  static ProjectSpec decode_request(const QByteArray &line);
+
+  static QByteArray  encode_response(const BatchResult &result);
+  static BatchResult decode_response(const QByteArray &line);
+};
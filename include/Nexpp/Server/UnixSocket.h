@@ -0,0 +1,12 @@
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+#include <sys/un.h>
+
+#include "Nexpp/FileSystem/FileDescriptor.h"
+
+sockaddr_un    make_socket_address(const std::filesystem::path &path);
+FileDescriptor make_stream_socket();
+
+void           send_all(const FileDescriptor &socket, std::string_view data);
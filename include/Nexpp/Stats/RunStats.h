@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+
+enum class StatCounter
+{
+  Projects,
+  Files,
+  ClonedFiles,
+  Directories,
+  BytesWritten,
+  Syscalls,
+  Count
+};
+
+enum class StatLatency
+{
+  Render,
+  FileWrite,
+  Project,
+  Count
+};
+
+struct LatencySummary
+{
+  std::uint64_t count  = 0;
+  std::int64_t  p50_ns = 0;
+  std::int64_t  p95_ns = 0;
+  std::int64_t  p99_ns = 0;
+  std::int64_t  max_ns = 0;
+};
+
+struct StatsSnapshot
+{
+  std::array<std::uint64_t, static_cast<std::size_t>(StatCounter::Count)>
+      counters {};
+  std::array<LatencySummary, static_cast<std::size_t>(StatLatency::Count)>
+      latencies {};
+
+  std::uint64_t counter(StatCounter counter) const
+  {
+    return counters[static_cast<std::size_t>(counter)];
+  }
+
+  const LatencySummary &latency(StatLatency latency) const
+  {
+    return latencies[static_cast<std::size_t>(latency)];
+  }
+};
+
+class RunStats
+{
+public:
+  static void start();
+  static void stop();
+  static void reset();
+
+  static bool is_enabled() noexcept
+  {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
+
+  static void add(StatCounter counter, std::uint64_t amount = 1) noexcept
+  {
+    if(is_enabled()) {
+      increment(counter, amount);
+    }
+  }
+
+  static void          record(StatLatency latency, std::int64_t ns) noexcept;
+
+  static std::size_t   bucket_of(std::int64_t ns) noexcept;
+  static std::int64_t  bucket_upper_bound(std::size_t bucket) noexcept;
+
+  static StatsSnapshot snapshot();
+  static void print(std::ostream &out, const StatsSnapshot &snapshot);
+  static void write_json(std::ostream &out, const StatsSnapshot &snapshot);
+  static void write_json(
+      const std::filesystem::path &path, const StatsSnapshot &snapshot
+  );
+
+private:
+  static void increment(StatCounter counter, std::uint64_t amount) noexcept;
+
+  static std::atomic<bool> s_enabled;
+};
+
+class LatencyTimer
+{
+public:
+  explicit LatencyTimer(StatLatency latency) noexcept;
+  ~LatencyTimer();
+
+  LatencyTimer(const LatencyTimer &)            = delete;
+  LatencyTimer &operator=(const LatencyTimer &) = delete;
+
+private:
+  StatLatency  m_latency;
+  std::int64_t m_start_ns = -1;
+};
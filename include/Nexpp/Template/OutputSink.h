@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+class OutputSink
+{
+public:
+  virtual ~OutputSink() = default;
+
+  // Announces the number of bytes the next render will write, when known.
+  virtual void reserve(std::size_t) {}
+  virtual void write(std::string_view data) = 0;
+};
+
+template<typename String>
+class BasicStringSink final : public OutputSink
+{
+public:
+  explicit BasicStringSink(String &output) : m_output(output) {}
+
+  void reserve(std::size_t size) override
+  {
+    m_output.reserve(m_output.size() + size);
+  }
+
+  void write(std::string_view data) override
+  {
+    m_output.append(data);
+  }
+
+private:
+  String &m_output;
+};
+
+using StringSink    = BasicStringSink<std::string>;
+using PmrStringSink = BasicStringSink<std::pmr::string>;
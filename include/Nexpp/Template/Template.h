@@ -0,0 +1,242 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "Nexpp/Template/OutputSink.h"
+#include "Nexpp/Types/Standard.h"
+
+template<std::size_t N>
+struct FixedString
+{
+  char data[N] {};
+
+  consteval FixedString(const char (&text)[N])
+  {
+    std::copy_n(text, N, data);
+  }
+
+  constexpr std::string_view view() const
+  {
+    return {data, N - 1};
+  }
+};
+
+struct TemplateSegment
+{
+  std::size_t offset      = 0;
+  std::size_t length      = 0;
+  std::size_t placeholder = 0;
+};
+
+class TemplateValue
+{
+public:
+  TemplateValue(std::string_view text) : m_text(text) {}
+  TemplateValue(const std::string &text) : m_text(text) {}
+  TemplateValue(const char *text) : m_text(text) {}
+  TemplateValue(Standard standard) : m_text(to_string_view(standard)) {}
+
+  template<std::integral T>
+  TemplateValue(T value)
+  {
+    const auto result =
+        std::to_chars(m_digits, m_digits + sizeof(m_digits), value);
+    m_length = static_cast<std::size_t>(result.ptr - m_digits);
+  }
+
+  TemplateValue(const TemplateValue &)            = delete;
+  TemplateValue &operator=(const TemplateValue &) = delete;
+
+  std::string_view view() const
+  {
+    return m_length ? std::string_view(m_digits, m_length) : m_text;
+  }
+
+private:
+  std::string_view m_text;
+  char             m_digits[24] {};
+  std::size_t      m_length = 0;
+};
+
+template<FixedString Text>
+class Template
+{
+  static consteval bool is_directive(std::string_view text, std::size_t i)
+  {
+    return text[i] == '%' && i + 1 < text.size() &&
+           (text[i + 1] == '%' || (text[i + 1] >= '1' && text[i + 1] <= '9'));
+  }
+
+  static consteval std::size_t count_segments()
+  {
+    constexpr std::string_view text = Text.view();
+
+    std::size_t                count      = 0;
+    bool                       in_literal = false;
+    for(std::size_t i = 0; i < text.size(); ++i) {
+      if(is_directive(text, i)) {
+        ++count;
+        ++i;
+        in_literal = false;
+      } else if(!in_literal) {
+        ++count;
+        in_literal = true;
+      }
+    }
+    return count;
+  }
+
+public:
+  static constexpr std::size_t segment_count = count_segments();
+
+private:
+  static consteval std::array<TemplateSegment, segment_count> parse()
+  {
+    constexpr std::string_view                 text = Text.view();
+
+    std::array<TemplateSegment, segment_count> segments {};
+    std::size_t                                current    = 0;
+    bool                                       in_literal = false;
+
+    for(std::size_t i = 0; i < text.size(); ++i) {
+      if(is_directive(text, i) && text[i + 1] == '%') {
+        segments[current++] = {i, 1, 0};
+        ++i;
+        in_literal = false;
+      } else if(is_directive(text, i)) {
+        segments[current++].placeholder =
+            static_cast<std::size_t>(text[i + 1] - '0');
+        ++i;
+        in_literal = false;
+      } else if(in_literal) {
+        ++segments[current - 1].length;
+      } else {
+        segments[current++] = {i, 1, 0};
+        in_literal          = true;
+      }
+    }
+    return segments;
+  }
+
+  static consteval std::size_t count_placeholders()
+  {
+    std::size_t highest = 0;
+    for(const auto &segment : segments) {
+      highest = std::max(highest, segment.placeholder);
+    }
+
+    for(std::size_t index = 1; index <= highest; ++index) {
+      if(std::none_of(segments.begin(), segments.end(), [&](const auto &s) {
+           return s.placeholder == index;
+         })) {
+        throw "Template placeholders must be numbered without gaps";
+      }
+    }
+    return highest;
+  }
+
+  static consteval std::size_t count_literal_size()
+  {
+    std::size_t size = 0;
+    for(const auto &segment : segments) {
+      size += segment.length;
+    }
+    return size;
+  }
+
+public:
+  static constexpr std::array<TemplateSegment, segment_count> segments =
+      parse();
+  static constexpr std::size_t placeholder_count = count_placeholders();
+  static constexpr std::size_t literal_size      = count_literal_size();
+
+  template<typename... Args>
+  static std::size_t size(const Args &...args)
+  {
+    static_assert(
+        sizeof...(Args) == placeholder_count,
+        "Template rendered with the wrong number of arguments"
+    );
+
+    const TemplateValue values[] = {TemplateValue(args)..., TemplateValue("")};
+    return size_of(values);
+  }
+
+  template<typename... Args>
+  static void append_to(std::string &output, const Args &...args)
+  {
+    static_assert(
+        sizeof...(Args) == placeholder_count,
+        "Template rendered with the wrong number of arguments"
+    );
+
+    const TemplateValue values[] = {TemplateValue(args)..., TemplateValue("")};
+    const std::size_t   offset   = output.size();
+    const std::size_t   added    = size_of(values);
+
+    output.resize_and_overwrite(
+        offset + added,
+        [&](char *buffer, std::size_t) {
+          write(buffer + offset, values);
+          return offset + added;
+        }
+    );
+  }
+
+  template<typename... Args>
+  static void write_to(OutputSink &sink, const Args &...args)
+  {
+    static_assert(
+        sizeof...(Args) == placeholder_count,
+        "Template rendered with the wrong number of arguments"
+    );
+
+    const TemplateValue values[] = {TemplateValue(args)..., TemplateValue("")};
+
+    constexpr std::string_view text = Text.view();
+    for(const auto &segment : segments) {
+      sink.write(
+          segment.placeholder ? values[segment.placeholder - 1].view()
+                              : text.substr(segment.offset, segment.length)
+      );
+    }
+  }
+
+  template<typename... Args>
+  static std::string render(const Args &...args)
+  {
+    std::string output;
+    append_to(output, args...);
+    return output;
+  }
+
+private:
+  static std::size_t size_of(const TemplateValue *values)
+  {
+    std::size_t size = literal_size;
+    for(const auto &segment : segments) {
+      if(segment.placeholder) {
+        size += values[segment.placeholder - 1].view().size();
+      }
+    }
+    return size;
+  }
+
+  static void write(char *buffer, const TemplateValue *values)
+  {
+    constexpr std::string_view text = Text.view();
+
+    for(const auto &segment : segments) {
+      const std::string_view part =
+          segment.placeholder ? values[segment.placeholder - 1].view()
+                              : text.substr(segment.offset, segment.length);
+      buffer = std::copy(part.begin(), part.end(), buffer);
+    }
+  }
+};
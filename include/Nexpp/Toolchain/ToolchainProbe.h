@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "Nexpp/Types/CompilerFamily.h"
+#include "Nexpp/Types/Standard.h"
+#include "Nexpp/Types/Toolchain.h"
+
+class ToolchainProbe
+{
+public:
+  explicit ToolchainProbe(
+      std::filesystem::path cache_file = default_cache_file()
+  );
+
+  Toolchain          probe(CompilerFamily family, Standard standard);
+  std::optional<int> compiler_version(const std::filesystem::path &compiler);
+
+  static ToolchainProbe       &shared();
+  static std::filesystem::path default_cache_file();
+  static CompilerFamily        detect_compiler_family();
+  static int
+      minimum_version(CompilerFamily family, Standard standard) noexcept;
+
+  static std::optional<std::filesystem::path>
+      find_program(std::string_view name);
+  static std::optional<CompilerFamily>
+      family_of(const std::filesystem::path &compiler);
+
+private:
+  struct CacheEntry
+  {
+    std::int64_t mtime   = 0;
+    int          version = 0;
+  };
+
+  std::optional<int> cached_version(const std::filesystem::path &compiler);
+  void               load_cache();
+  void               save_cache() const;
+
+  std::filesystem::path                                   m_cache_file;
+  std::map<std::string, CacheEntry>                       m_cache;
+  std::map<std::pair<CompilerFamily, Standard>, Toolchain> m_probed;
+  std::mutex                                              m_mutex;
+};
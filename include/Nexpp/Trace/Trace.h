@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+struct TraceEvent
+{
+  const char   *name = nullptr;
+  std::string   detail;
+  std::int64_t  start_ns    = 0;
+  std::int64_t  duration_ns = 0;
+  std::uint32_t thread_id   = 0;
+};
+
+class Trace
+{
+public:
+  static void start();
+  static void stop();
+  static void clear();
+
+  static bool is_enabled() noexcept
+  {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
+
+  static std::int64_t now_ns() noexcept;
+  static void         record(
+              const char *name, std::string_view detail, std::int64_t start_ns
+          );
+
+  static std::size_t event_count();
+  static void        write(std::ostream &out);
+  static void        write(const std::filesystem::path &path);
+
+private:
+  static std::atomic<bool> s_enabled;
+};
+
+// The detail view is not copied until the span ends; it must outlive the span.
+class TraceSpan
+{
+public:
+  explicit TraceSpan(const char *name, std::string_view detail = {})
+  {
+    if(Trace::is_enabled()) {
+      m_name     = name;
+      m_detail   = detail;
+      m_start_ns = Trace::now_ns();
+    }
+  }
+
+  ~TraceSpan()
+  {
+    if(m_name != nullptr) {
+      Trace::record(m_name, m_detail, m_start_ns);
+    }
+  }
+
+  TraceSpan(const TraceSpan &)            = delete;
+  TraceSpan &operator=(const TraceSpan &) = delete;
+
+private:
+  const char      *m_name = nullptr;
+  std::string_view m_detail;
+  std::int64_t     m_start_ns = 0;
+};
+
+#define NEXPP_TRACE_CONCAT_INNER(left, right) left##right
+#define NEXPP_TRACE_CONCAT(left, right) NEXPP_TRACE_CONCAT_INNER(left, right)
+
+#ifdef NEXPP_ENABLE_TRACE
+#define NEXPP_TRACE_SCOPE(...)                                                 \
+  const TraceSpan NEXPP_TRACE_CONCAT(trace_span_, __LINE__)(__VA_ARGS__)
+#else
+#define NEXPP_TRACE_SCOPE(...) static_cast<void>(0)
+#endif
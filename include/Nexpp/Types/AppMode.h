@@ -5,7 +5,8 @@
 enum class AppMode
 {
   GUI,
-  CLI
+  CLI,
+  Server
 };
 
 inline const QString to_string(AppMode mode) noexcept
@@ -15,6 +16,8 @@ inline const QString to_string(AppMode mode) noexcept
     return "GUI";
   case AppMode::CLI:
     return "CLI";
+  case AppMode::Server:
+    return "Server";
   default:
     return "Invalid";
   }
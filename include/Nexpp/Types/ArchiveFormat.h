@@ -0,0 +1,21 @@
+#pragma once
+
+#include <QString>
+
+enum class ArchiveFormat
+{
+  Tar,
+  Zip
+};
+
+inline const QString to_string(ArchiveFormat format) noexcept
+{
+  switch(format) {
+  case ArchiveFormat::Tar:
+    return "tar";
+  case ArchiveFormat::Zip:
+    return "zip";
+  default:
+    return "Invalid";
+  }
+}
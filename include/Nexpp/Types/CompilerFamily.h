@@ -0,0 +1,51 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+#include <stdexcept>
+#include <string_view>
+
+enum class CompilerFamily
+{
+  GCC,
+  Clang
+};
+
+inline const QString to_string(CompilerFamily family) noexcept
+{
+  switch(family) {
+  case CompilerFamily::GCC:
+    return "gcc";
+  case CompilerFamily::Clang:
+    return "clang";
+  default:
+    return "Invalid";
+  }
+}
+
+inline const QStringList &known_compiler_families() noexcept
+{
+  static const QStringList families = {"gcc", "clang"};
+  return families;
+}
+
+inline CompilerFamily parse_compiler_family(const QString &value)
+{
+  const QString family = value.trimmed().toLower();
+  if(family == "gcc") {
+    return CompilerFamily::GCC;
+  }
+
+  if(family == "clang") {
+    return CompilerFamily::Clang;
+  }
+
+  throw std::runtime_error(
+      "Unrecognized compiler family: " + value.toStdString()
+  );
+}
+
+constexpr std::string_view cxx_compiler(CompilerFamily family) noexcept
+{
+  return family == CompilerFamily::Clang ? "clang++" : "g++";
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Nexpp/Types/IoBackend.h"
+#include "Nexpp/Types/SyncPolicy.h"
+
+struct GenerationOptions
+{
+  SyncPolicy sync_policy = SyncPolicy::PerProject;
+  IoBackend  io_backend  = IoBackend::Sync;
+
+  // New projects clone name-independent files from skeletons kept here.
+  // Empty disables the cache.
+  std::filesystem::path skeleton_cache = {};
+};
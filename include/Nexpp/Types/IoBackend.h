@@ -0,0 +1,21 @@
+#pragma once
+
+#include <QString>
+
+enum class IoBackend
+{
+  Sync,
+  Uring
+};
+
+inline const QString to_string(IoBackend backend) noexcept
+{
+  switch(backend) {
+  case IoBackend::Sync:
+    return "sync";
+  case IoBackend::Uring:
+    return "uring";
+  default:
+    return "Invalid";
+  }
+}
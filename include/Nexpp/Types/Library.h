@@ -0,0 +1,15 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+
+inline const QStringList &known_libraries() noexcept
+{
+  static const QStringList libraries = {"qt", "gtest", "benchmark"};
+  return libraries;
+}
+
+inline bool is_known_library(const QString &library) noexcept
+{
+  return known_libraries().contains(library, Qt::CaseInsensitive);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+#include <stdexcept>
+
+struct PerfOptions
+{
+  bool ipo   = false;
+  bool unity = false;
+  bool pch   = false;
+
+  bool operator==(const PerfOptions &other) const = default;
+};
+
+inline const QStringList &known_perf_options() noexcept
+{
+  static const QStringList options = {"lto", "unity", "pch", "all"};
+  return options;
+}
+
+inline PerfOptions parse_perf_options(const QStringList &values)
+{
+  PerfOptions options;
+
+  for(const auto &value : values) {
+    const QString option = value.trimmed().toLower();
+    if(option == "lto") {
+      options.ipo = true;
+    } else if(option == "unity") {
+      options.unity = true;
+    } else if(option == "pch") {
+      options.pch = true;
+    } else if(option == "all") {
+      options = {true, true, true};
+    } else {
+      throw std::runtime_error(
+          "Unrecognized performance option: " + value.toStdString()
+      );
+    }
+  }
+
+  return options;
+}
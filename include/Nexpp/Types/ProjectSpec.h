@@ -0,0 +1,31 @@
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Nexpp/Types/CompilerFamily.h"
+#include "Nexpp/Types/PerfOptions.h"
+#include "Nexpp/Types/Standard.h"
+#include "Nexpp/Types/Toolchain.h"
+
+struct ProjectSpec
+{
+  std::string              name;
+  std::filesystem::path    destination = "./";
+  Standard                 standard    = Standard::CPP23;
+  std::vector<std::string> libraries;
+  bool                     has_flags = false;
+  PerfOptions              perf;
+  bool                     modules  = false;
+  CompilerFamily           compiler = CompilerFamily::GCC;
+  Toolchain                toolchain;
+
+  bool                     has_library(std::string_view library) const
+  {
+    return std::find(libraries.begin(), libraries.end(), library) !=
+           libraries.end();
+  }
+};
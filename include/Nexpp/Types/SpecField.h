@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Nexpp/Types/ProjectSpec.h"
+
+enum class SpecField : unsigned
+{
+  Name      = 1U << 0,
+  Standard  = 1U << 1,
+  Libraries = 1U << 2,
+  Flags     = 1U << 3,
+  Perf      = 1U << 4,
+  Compiler  = 1U << 5,
+  Toolchain = 1U << 6,
+  Modules   = 1U << 7
+};
+
+using SpecFields = unsigned;
+
+inline constexpr SpecFields all_fields = (1U << 8) - 1;
+
+constexpr SpecFields operator|(SpecFields fields, SpecField field)
+{
+  return fields | static_cast<SpecFields>(field);
+}
+
+constexpr SpecFields operator|(SpecField left, SpecField right)
+{
+  return static_cast<SpecFields>(left) | right;
+}
+
+constexpr bool has_field(SpecFields fields, SpecField field)
+{
+  return (fields & static_cast<SpecFields>(field)) != 0;
+}
+
+inline SpecFields changed_fields(
+    const ProjectSpec &before, const ProjectSpec &after
+)
+{
+  SpecFields fields = 0;
+  if(before.name != after.name) {
+    fields = fields | SpecField::Name;
+  }
+  if(before.standard != after.standard) {
+    fields = fields | SpecField::Standard;
+  }
+  if(before.libraries != after.libraries) {
+    fields = fields | SpecField::Libraries;
+  }
+  if(before.has_flags != after.has_flags) {
+    fields = fields | SpecField::Flags;
+  }
+  if(before.perf != after.perf) {
+    fields = fields | SpecField::Perf;
+  }
+  if(before.compiler != after.compiler) {
+    fields = fields | SpecField::Compiler;
+  }
+  if(before.toolchain != after.toolchain) {
+    fields = fields | SpecField::Toolchain;
+  }
+  if(before.modules != after.modules) {
+    fields = fields | SpecField::Modules;
+  }
+  return fields;
+}
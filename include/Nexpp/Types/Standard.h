@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QString>
+#include <string_view>
 
 enum class Standard
 {
@@ -26,6 +27,22 @@ inline const QString to_string(Standard standard) noexcept
   }
 }
 
+constexpr std::string_view to_string_view(Standard standard) noexcept
+{
+  switch(standard) {
+  case Standard::CPP14:
+    return "14";
+  case Standard::CPP17:
+    return "17";
+  case Standard::CPP20:
+    return "20";
+  case Standard::CPP23:
+    return "23";
+  default:
+    return "Invalid";
+  }
+}
+
 inline Standard from_int(int standard) noexcept
 {
   if(standard == 14) {
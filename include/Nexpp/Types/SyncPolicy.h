@@ -0,0 +1,24 @@
+#pragma once
+
+#include <QString>
+
+enum class SyncPolicy
+{
+  None,
+  PerProject,
+  PerFile
+};
+
+inline const QString to_string(SyncPolicy policy) noexcept
+{
+  switch(policy) {
+  case SyncPolicy::None:
+    return "none";
+  case SyncPolicy::PerProject:
+    return "project";
+  case SyncPolicy::PerFile:
+    return "file";
+  default:
+    return "Invalid";
+  }
+}
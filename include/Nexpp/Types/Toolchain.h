@@ -0,0 +1,12 @@
+#pragma once
+
+#include <string>
+
+struct Toolchain
+{
+  std::string compiler;
+  std::string launcher;
+  std::string linker;
+
+  bool        operator==(const Toolchain &other) const = default;
+};
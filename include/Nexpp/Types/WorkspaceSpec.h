@@ -0,0 +1,16 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Nexpp/Types/ProjectSpec.h"
+
+// The projects become components of one superbuild rooted at
+// destination / name; their own destinations are ignored.
+struct WorkspaceSpec
+{
+  std::string              name;
+  std::filesystem::path    destination = "./";
+  std::vector<ProjectSpec> projects;
+};
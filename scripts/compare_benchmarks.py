@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Compare two Google Benchmark JSON reports and fail on regressions.
+
+Usage: compare_benchmarks.py BASELINE.json CURRENT.json [--threshold 0.10]
+
+A benchmark regresses when its real time grows by more than the threshold
+(a fraction, 0.10 meaning 10%) relative to the baseline. Benchmarks that
+only exist in one of the reports, or whose baseline time is zero, are
+listed but never fail the run.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path, encoding="utf-8") as report:
+        benchmarks = json.load(report)["benchmarks"]
+
+    return {
+        entry["name"]: entry["real_time"]
+        for entry in benchmarks
+        if entry.get("run_type", "iteration") == "iteration"
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10)
+    arguments = parser.parse_args()
+
+    baseline = load(arguments.baseline)
+    current = load(arguments.current)
+    regressions = []
+
+    for name in sorted(baseline.keys() | current.keys()):
+        if name not in current:
+            print(f"  removed    {name}")
+            continue
+        if name not in baseline:
+            print(f"  new        {name}")
+            continue
+        if baseline[name] == 0:
+            print(f"  {'n/a':<10} {name}: zero baseline time")
+            continue
+
+        change = (current[name] - baseline[name]) / baseline[name]
+        status = "REGRESSED" if change > arguments.threshold else "ok"
+        print(f"  {status:<10} {name}: {change:+.1%}")
+
+        if change > arguments.threshold:
+            regressions.append(name)
+
+    if regressions:
+        print(
+            f"{len(regressions)} benchmark(s) regressed by more than "
+            f"{arguments.threshold:.0%}"
+        )
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
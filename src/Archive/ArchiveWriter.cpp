@@ -0,0 +1,14 @@
+#include "Nexpp/Archive/ArchiveWriter.h"
+
+#include "Nexpp/Archive/TarArchiveWriter.h"
+#include "Nexpp/Archive/ZipArchiveWriter.h"
+
+std::unique_ptr<ArchiveWriter>
+    make_archive_writer(ArchiveFormat format, std::ostream &out)
+{
+  if(format == ArchiveFormat::Zip) {
+    return std::make_unique<ZipArchiveWriter>(out);
+  }
+
+  return std::make_unique<TarArchiveWriter>(out);
+}
@@ -0,0 +1,159 @@
+#include "Nexpp/Archive/TarArchiveWriter.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace {
+constexpr std::size_t block_size = 512;
+
+struct UstarHeader
+{
+  char name[100];
+  char mode[8];
+  char uid[8];
+  char gid[8];
+  char size[12];
+  char mtime[12];
+  char checksum[8];
+  char type;
+  char link_name[100];
+  char magic[6];
+  char version[2];
+  char user_name[32];
+  char group_name[32];
+  char device_major[8];
+  char device_minor[8];
+  char prefix[155];
+  char padding[12];
+};
+
+static_assert(sizeof(UstarHeader) == block_size);
+
+template<std::size_t Width>
+void write_octal(char (&field)[Width], std::uint64_t value)
+{
+  std::array<char, Width> digits {};
+  const auto [end, error] =
+      std::to_chars(digits.data(), digits.data() + Width - 1, value, 8);
+  if(error != std::errc()) {
+    throw std::runtime_error("Value does not fit in a tar header field");
+  }
+
+  const auto length = static_cast<std::size_t>(end - digits.data());
+  std::memset(field, '0', Width - 1 - length);
+  std::memcpy(field + Width - 1 - length, digits.data(), length);
+  field[Width - 1] = '\0';
+}
+
+template<std::size_t Width>
+void write_text(char (&field)[Width], std::string_view text)
+{
+  std::memcpy(field, text.data(), std::min(text.size(), Width));
+}
+
+void split_name(const std::string &name, UstarHeader &header)
+{
+  if(name.size() <= sizeof(header.name)) {
+    write_text(header.name, name);
+    return;
+  }
+
+  const std::size_t limit = std::min(name.size() - 1, sizeof(header.prefix));
+  const std::size_t slash = name.rfind('/', limit);
+  if(slash == std::string::npos || slash == 0 ||
+     name.size() - slash - 1 > sizeof(header.name)) {
+    throw std::runtime_error("Path is too long for a tar archive: " + name);
+  }
+
+  write_text(header.prefix, std::string_view(name).substr(0, slash));
+  write_text(header.name, std::string_view(name).substr(slash + 1));
+}
+} // namespace
+
+TarArchiveWriter::TarArchiveWriter(std::ostream &out)
+    : m_out(out),
+      m_mtime(std::chrono::duration_cast<std::chrono::seconds>(
+                  std::chrono::system_clock::now().time_since_epoch()
+      )
+                  .count())
+{
+}
+
+void TarArchiveWriter::add_folder(const std::filesystem::path &path)
+{
+  write_header(path.generic_string() + '/', 0, 0755, '5');
+}
+
+void TarArchiveWriter::add_file(
+    const std::filesystem::path &path, std::string_view content
+)
+{
+  write_header(path.generic_string(), content.size(), 0644, '0');
+  m_out.write(content.data(), static_cast<std::streamsize>(content.size()));
+  write_padding(content.size());
+}
+
+void TarArchiveWriter::finish()
+{
+  if(m_finished) {
+    return;
+  }
+
+  const std::array<char, 2 * block_size> end_of_archive {};
+  m_out.write(end_of_archive.data(), end_of_archive.size());
+  m_out.flush();
+  m_finished = true;
+
+  if(!m_out) {
+    throw std::runtime_error("Cannot write tar archive");
+  }
+}
+
+void TarArchiveWriter::write_header(
+    const std::string &name, std::uint64_t size, unsigned mode, char type
+)
+{
+  if(m_finished) {
+    throw std::logic_error("Tar archive is already finished");
+  }
+
+  UstarHeader header {};
+  split_name(name, header);
+  write_octal(header.mode, mode);
+  write_octal(header.uid, 0);
+  write_octal(header.gid, 0);
+  write_octal(header.size, size);
+  write_octal(header.mtime, static_cast<std::uint64_t>(m_mtime));
+  header.type = type;
+  write_text(header.magic, std::string_view("ustar", 6));
+  write_text(header.version, "00");
+
+  std::memset(header.checksum, ' ', sizeof(header.checksum));
+  const auto *bytes = reinterpret_cast<const unsigned char *>(&header);
+  write_octal(
+      header.checksum, std::accumulate(bytes, bytes + block_size, 0u)
+  );
+
+  m_out.write(reinterpret_cast<const char *>(&header), block_size);
+  if(!m_out) {
+    throw std::runtime_error("Cannot write tar archive entry: " + name);
+  }
+}
+
+void TarArchiveWriter::write_padding(std::uint64_t size)
+{
+  static constexpr std::array<char, block_size> zeros {};
+
+  const std::size_t remainder = size % block_size;
+  if(remainder != 0) {
+    m_out.write(
+        zeros.data(), static_cast<std::streamsize>(block_size - remainder)
+    );
+  }
+}
@@ -0,0 +1,208 @@
+#include "Nexpp/Archive/ZipArchiveWriter.h"
+
+#include <array>
+#include <ctime>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+constexpr std::uint32_t local_header_signature   = 0x04034b50;
+constexpr std::uint32_t central_header_signature = 0x02014b50;
+constexpr std::uint32_t end_of_central_signature = 0x06054b50;
+constexpr std::uint16_t version_needed           = 20;
+constexpr std::uint16_t version_made_by_unix     = (3 << 8) | 20;
+constexpr std::uint16_t utf8_names_flag          = 1 << 11;
+
+constexpr auto crc_table = [] {
+  std::array<std::uint32_t, 256> table {};
+  for(std::uint32_t i = 0; i < table.size(); ++i) {
+    std::uint32_t value = i;
+    for(int bit = 0; bit < 8; ++bit) {
+      value = (value & 1) != 0 ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+    }
+    table[i] = value;
+  }
+  return table;
+}();
+
+class RecordBuilder
+{
+public:
+  RecordBuilder &u16(std::uint16_t value)
+  {
+    m_bytes.push_back(static_cast<char>(value & 0xFF));
+    m_bytes.push_back(static_cast<char>(value >> 8));
+    return *this;
+  }
+
+  RecordBuilder &u32(std::uint32_t value)
+  {
+    u16(static_cast<std::uint16_t>(value & 0xFFFF));
+    return u16(static_cast<std::uint16_t>(value >> 16));
+  }
+
+  RecordBuilder &bytes(std::string_view value)
+  {
+    m_bytes.append(value);
+    return *this;
+  }
+
+  std::string_view view() const
+  {
+    return m_bytes;
+  }
+
+private:
+  std::string m_bytes;
+};
+
+std::uint32_t checked_u32(std::uint64_t value, const char *what)
+{
+  if(value > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::runtime_error(
+        std::string("Zip archive exceeds the 4 GiB limit: ") + what
+    );
+  }
+  return static_cast<std::uint32_t>(value);
+}
+
+std::uint16_t checked_u16(std::size_t value, const char *what)
+{
+  if(value > std::numeric_limits<std::uint16_t>::max()) {
+    throw std::runtime_error(
+        std::string("Zip archive exceeds the 65535 limit: ") + what
+    );
+  }
+  return static_cast<std::uint16_t>(value);
+}
+} // namespace
+
+ZipArchiveWriter::ZipArchiveWriter(std::ostream &out) : m_out(out)
+{
+  const std::time_t now = std::time(nullptr);
+  std::tm           local {};
+  localtime_r(&now, &local);
+
+  m_dos_time = static_cast<std::uint16_t>(
+      (local.tm_hour << 11) | (local.tm_min << 5) | (local.tm_sec / 2)
+  );
+  m_dos_date = static_cast<std::uint16_t>(
+      ((local.tm_year - 80) << 9) | ((local.tm_mon + 1) << 5) | local.tm_mday
+  );
+}
+
+void ZipArchiveWriter::add_folder(const std::filesystem::path &path)
+{
+  Entry entry;
+  entry.name   = path.generic_string() + '/';
+  entry.folder = true;
+  add_entry(std::move(entry), {});
+}
+
+void ZipArchiveWriter::add_file(
+    const std::filesystem::path &path, std::string_view content
+)
+{
+  Entry entry;
+  entry.name = path.generic_string();
+  entry.crc  = crc32(content);
+  entry.size = checked_u32(content.size(), entry.name.c_str());
+  add_entry(std::move(entry), content);
+}
+
+void ZipArchiveWriter::finish()
+{
+  if(m_finished) {
+    return;
+  }
+
+  const std::uint64_t central_offset = m_offset;
+
+  for(const auto &entry : m_entries) {
+    const std::uint32_t mode =
+        entry.folder ? (040755u << 16) | 0x10u : 0100644u << 16;
+
+    RecordBuilder       record;
+    record.u32(central_header_signature)
+        .u16(version_made_by_unix)
+        .u16(version_needed)
+        .u16(utf8_names_flag)
+        .u16(0)
+        .u16(m_dos_time)
+        .u16(m_dos_date)
+        .u32(entry.crc)
+        .u32(entry.size)
+        .u32(entry.size)
+        .u16(static_cast<std::uint16_t>(entry.name.size()))
+        .u16(0)
+        .u16(0)
+        .u16(0)
+        .u16(0)
+        .u32(mode)
+        .u32(entry.offset)
+        .bytes(entry.name);
+    write(record.view());
+  }
+
+  const std::uint16_t count = checked_u16(m_entries.size(), "entry count");
+
+  RecordBuilder       end;
+  end.u32(end_of_central_signature)
+      .u16(0)
+      .u16(0)
+      .u16(count)
+      .u16(count)
+      .u32(checked_u32(m_offset - central_offset, "central directory"))
+      .u32(checked_u32(central_offset, "central directory"))
+      .u16(0);
+  write(end.view());
+
+  m_out.flush();
+  m_finished = true;
+}
+
+std::uint32_t ZipArchiveWriter::crc32(std::string_view data)
+{
+  std::uint32_t crc = 0xFFFFFFFFu;
+  for(const char byte : data) {
+    crc = crc_table[(crc ^ static_cast<unsigned char>(byte)) & 0xFF] ^
+          (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+void ZipArchiveWriter::add_entry(Entry entry, std::string_view content)
+{
+  if(m_finished) {
+    throw std::logic_error("Zip archive is already finished");
+  }
+
+  entry.offset = checked_u32(m_offset, entry.name.c_str());
+
+  RecordBuilder header;
+  header.u32(local_header_signature)
+      .u16(version_needed)
+      .u16(utf8_names_flag)
+      .u16(0)
+      .u16(m_dos_time)
+      .u16(m_dos_date)
+      .u32(entry.crc)
+      .u32(entry.size)
+      .u32(entry.size)
+      .u16(checked_u16(entry.name.size(), entry.name.c_str()))
+      .u16(0)
+      .bytes(entry.name);
+  write(header.view());
+  write(content);
+
+  m_entries.push_back(std::move(entry));
+}
+
+void ZipArchiveWriter::write(std::string_view bytes)
+{
+  m_out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  if(!m_out) {
+    throw std::runtime_error("Cannot write zip archive");
+  }
+  m_offset += bytes.size();
+}
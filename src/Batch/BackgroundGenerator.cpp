@@ -0,0 +1,122 @@
+#include "Nexpp/Batch/BackgroundGenerator.h"
+
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+BackgroundGenerator::BackgroundGenerator(
+    std::size_t thread_count, GenerationOptions options
+)
+    : m_generator(options), m_pool(thread_count)
+{
+}
+
+BackgroundGenerator::~BackgroundGenerator()
+{
+  cancel();
+  wait();
+}
+
+void BackgroundGenerator::start(std::vector<ProjectSpec> specs)
+{
+  if(!m_finished.load(std::memory_order_acquire)) {
+    throw std::logic_error("A generation batch is already running");
+  }
+
+  m_pool.wait_idle();
+
+  m_specs = std::move(specs);
+  m_control.cancelled.store(false, std::memory_order_relaxed);
+  m_control.files_written.store(0, std::memory_order_relaxed);
+  m_done.store(0, std::memory_order_relaxed);
+  m_failed.store(0, std::memory_order_relaxed);
+  m_updated.store(0, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(m_results_mutex);
+    m_results.clear();
+    m_created.clear();
+  }
+
+  if(m_specs.empty()) {
+    return;
+  }
+
+  m_finished.store(false, std::memory_order_release);
+  for(std::size_t index = 0; index < m_specs.size(); ++index) {
+    m_pool.submit([this, index] { run_one(index); });
+  }
+}
+
+void BackgroundGenerator::cancel()
+{
+  if(!m_finished.load(std::memory_order_acquire)) {
+    m_control.cancelled.store(true, std::memory_order_relaxed);
+  }
+}
+
+void BackgroundGenerator::wait()
+{
+  m_pool.wait_idle();
+}
+
+GenerationProgress BackgroundGenerator::progress() const
+{
+  GenerationProgress progress;
+  progress.projects_total   = m_specs.size();
+  progress.projects_done    = m_done.load(std::memory_order_relaxed);
+  progress.projects_failed  = m_failed.load(std::memory_order_relaxed);
+  progress.projects_updated = m_updated.load(std::memory_order_relaxed);
+  progress.files_written =
+      m_control.files_written.load(std::memory_order_relaxed);
+  progress.cancelled = m_control.is_cancelled();
+  progress.finished  = m_finished.load(std::memory_order_acquire);
+  return progress;
+}
+
+std::vector<BatchResult> BackgroundGenerator::take_results()
+{
+  std::lock_guard<std::mutex> lock(m_results_mutex);
+  return std::exchange(m_results, {});
+}
+
+void BackgroundGenerator::run_one(std::size_t index)
+{
+  const ProjectSpec          &spec = m_specs[index];
+  const std::filesystem::path root = spec.destination / spec.name;
+
+  std::error_code             error;
+  const bool                  existed = std::filesystem::exists(root, error);
+  BatchResult result = BatchRunner::generate_one(m_generator, spec, &m_control);
+
+  if(!result.success) {
+    m_failed.fetch_add(1, std::memory_order_relaxed);
+  } else if(existed && !result.report.written.empty()) {
+    m_updated.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_results_mutex);
+    if(result.success && !existed) {
+      m_created.push_back(root);
+    }
+    m_results.push_back(std::move(result));
+  }
+
+  if(m_done.fetch_add(1, std::memory_order_acq_rel) + 1 == m_specs.size()) {
+    if(m_control.is_cancelled()) {
+      roll_back_created();
+    }
+    m_finished.store(true, std::memory_order_release);
+  }
+}
+
+void BackgroundGenerator::roll_back_created()
+{
+  std::lock_guard<std::mutex> lock(m_results_mutex);
+
+  for(const auto &root : m_created) {
+    std::error_code error;
+    std::filesystem::remove_all(root, error);
+  }
+  m_created.clear();
+}
@@ -0,0 +1,93 @@
+#include "Nexpp/Batch/BatchRunner.h"
+
+#include <algorithm>
+#include <exception>
+
+#include "Nexpp/Batch/ThreadPool.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include "Nexpp/Stats/RunStats.h"
+
+BatchRunner::BatchRunner(std::size_t thread_count, GenerationOptions options)
+    : m_thread_count(std::max<std::size_t>(thread_count, 1)),
+      m_options(options)
+{
+}
+
+std::vector<BatchResult>
+    BatchRunner::run(const std::vector<ProjectSpec> &specs) const
+{
+  std::vector<BatchResult> results(specs.size());
+  const ProjectGenerator   generator(m_options);
+
+  {
+    ThreadPool pool(std::clamp<std::size_t>(specs.size(), 1, m_thread_count));
+
+    for(std::size_t i = 0; i < specs.size(); ++i) {
+      pool.submit([&, i] { results[i] = generate_one(generator, specs[i]); });
+    }
+
+    pool.wait_idle();
+  }
+
+  return results;
+}
+
+BatchResult BatchRunner::generate_one(
+    const ProjectGenerator &generator, const ProjectSpec &spec,
+    GenerationControl *control
+)
+{
+  BatchResult result;
+  const auto  start = std::chrono::steady_clock::now();
+
+  result.project_name = spec.name;
+
+  try {
+    result.report  = generator.generate(spec, control);
+    result.success = true;
+    RunStats::add(StatCounter::Projects);
+  } catch(const std::exception &exception) {
+    result.report.root = spec.destination / spec.name;
+    result.error       = exception.what();
+  }
+
+  result.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start
+  );
+
+  return result;
+}
+
+void BatchRunner::print_report(
+    std::ostream &out, const std::vector<BatchResult> &results
+)
+{
+  std::size_t failures = 0;
+
+  for(const auto &result : results) {
+    if(result.success) {
+      out << "[ OK ]   ";
+    } else {
+      out << "[FAIL]   ";
+      ++failures;
+    }
+
+    out << result.project_name << " -> " << result.report.root.string()
+        << " (" << result.duration.count() << " us)";
+
+    if(!result.success) {
+      out << ": " << result.error;
+    } else {
+      out << ": " << result.report.written.size() << " written, "
+          << result.report.unchanged.size() << " unchanged";
+    }
+    out << '\n';
+
+    for(const auto &conflict : result.report.conflicts) {
+      out << "         user-modified, kept: " << conflict << '\n';
+    }
+  }
+
+  out << results.size() - failures << "/" << results.size()
+      << " projects generated, " << failures << " failed\n";
+}
@@ -0,0 +1,180 @@
+#include "Nexpp/Batch/Manifest.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+#include "Nexpp/Toolchain/ToolchainProbe.h"
+#include "Nexpp/Types/Library.h"
+
+namespace {
+Standard parse_standard(const QJsonValue &value)
+{
+  const QString text = value.isString() ? value.toString()
+                                        : QString::number(value.toInt());
+  const int     standard = text.toInt();
+
+  if(standard != 14 && standard != 17 && standard != 20 && standard != 23) {
+    throw std::runtime_error(
+        "Unrecognized standard in manifest: " + text.toStdString()
+    );
+  }
+
+  return from_int(standard);
+}
+
+std::vector<std::string> parse_libraries(const QJsonValue &value)
+{
+  std::vector<std::string> libraries;
+
+  for(const auto &entry : value.toArray()) {
+    const QString library = entry.toString().toLower();
+    if(!is_known_library(library)) {
+      throw std::runtime_error(
+          "Unrecognized library in manifest: " + library.toStdString()
+      );
+    }
+
+    if(std::find(
+           libraries.begin(), libraries.end(), library.toStdString()
+       ) == libraries.end()) {
+      libraries.push_back(library.toStdString());
+    }
+  }
+
+  return libraries;
+}
+
+Toolchain parse_toolchain(const QJsonObject &object)
+{
+  Toolchain toolchain;
+  toolchain.compiler = object.value("compiler").toString().toStdString();
+  toolchain.launcher = object.value("launcher").toString().toStdString();
+  toolchain.linker   = object.value("linker").toString().toStdString();
+  return toolchain;
+}
+
+std::filesystem::path project_root(const ProjectSpec &spec)
+{
+  return (spec.destination / spec.name).lexically_normal();
+}
+} // namespace
+
+std::vector<ProjectSpec> Manifest::load(const std::filesystem::path &path)
+{
+  QFile file(QString::fromStdString(path.string()));
+  if(!file.open(QIODevice::ReadOnly)) {
+    throw std::runtime_error("Cannot open manifest: " + path.string());
+  }
+
+  return parse(file.readAll());
+}
+
+std::vector<ProjectSpec> Manifest::parse(const QByteArray &content)
+{
+  QJsonParseError     error;
+  const QJsonDocument document = QJsonDocument::fromJson(content, &error);
+  if(document.isNull()) {
+    throw std::runtime_error(
+        "Invalid manifest: " + error.errorString().toStdString()
+    );
+  }
+
+  ProjectSpec defaults;
+  QJsonArray  projects;
+  bool        has_compiler = false;
+
+  if(document.isArray()) {
+    projects = document.array();
+  } else {
+    const QJsonObject root = document.object();
+    if(root.contains("defaults")) {
+      const QJsonObject object = root.value("defaults").toObject();
+      defaults                 = parse_project(object, defaults);
+      has_compiler             = object.contains("compiler");
+    }
+    projects = root.value("projects").toArray();
+  }
+
+  // The family of this machine's compiler is only detected when an entry
+  // leaves it out.
+  if(!has_compiler &&
+     std::any_of(projects.begin(), projects.end(), [](const auto &project) {
+       return !project.toObject().contains("compiler");
+     })) {
+    defaults.compiler = ToolchainProbe::detect_compiler_family();
+  }
+
+  std::vector<ProjectSpec>        specs;
+  std::unordered_set<std::string> roots;
+  specs.reserve(static_cast<std::size_t>(projects.size()));
+  roots.reserve(static_cast<std::size_t>(projects.size()));
+
+  for(const auto &project : projects) {
+    ProjectSpec spec = parse_project(project.toObject(), defaults);
+    if(spec.name.empty()) {
+      throw std::runtime_error(
+          "Project name is required for every manifest entry !"
+      );
+    }
+
+    // Two entries generating into one directory would race on it.
+    const std::string root = project_root(spec).native();
+    if(!roots.insert(root).second) {
+      throw std::runtime_error("Duplicate manifest entry for " + root + " !");
+    }
+    specs.push_back(std::move(spec));
+  }
+
+  return specs;
+}
+
+ProjectSpec
+    Manifest::parse_project(const QJsonObject &object, const ProjectSpec &defaults)
+{
+  ProjectSpec spec = defaults;
+  spec.name        = object.value("name").toString().toStdString();
+
+  if(object.contains("destination")) {
+    spec.destination =
+        object.value("destination").toString().toStdString();
+  }
+
+  if(object.contains("standard")) {
+    spec.standard = parse_standard(object.value("standard"));
+  }
+
+  if(object.contains("libraries")) {
+    spec.libraries = parse_libraries(object.value("libraries"));
+  }
+
+  if(object.contains("flags")) {
+    spec.has_flags = object.value("flags").toBool();
+  }
+
+  if(object.contains("perf")) {
+    QStringList options;
+    for(const auto &entry : object.value("perf").toArray()) {
+      options.append(entry.toString());
+    }
+    spec.perf = parse_perf_options(options);
+  }
+
+  if(object.contains("modules")) {
+    spec.modules = object.value("modules").toBool();
+  }
+
+  if(object.contains("toolchain")) {
+    spec.toolchain = parse_toolchain(object.value("toolchain").toObject());
+  }
+
+  if(object.contains("compiler")) {
+    spec.compiler = parse_compiler_family(object.value("compiler").toString());
+  }
+
+  return spec;
+}
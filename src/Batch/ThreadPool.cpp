@@ -0,0 +1,134 @@
+#include "Nexpp/Batch/ThreadPool.h"
+
+#include <algorithm>
+
+namespace {
+thread_local const ThreadPool *current_pool  = nullptr;
+thread_local std::size_t       current_index = 0;
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t thread_count)
+{
+  thread_count = std::max<std::size_t>(thread_count, 1);
+
+  m_queues.reserve(thread_count);
+  for(std::size_t i = 0; i < thread_count; ++i) {
+    m_queues.push_back(std::make_unique<WorkQueue>());
+  }
+
+  m_workers.reserve(thread_count);
+  for(std::size_t i = 0; i < thread_count; ++i) {
+    m_workers.emplace_back([this, i] { run_worker(i); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard lock(m_state_mutex);
+    m_stopping = true;
+  }
+  m_work_available.notify_all();
+
+  for(auto &worker : m_workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+  std::size_t target = 0;
+  {
+    std::lock_guard lock(m_state_mutex);
+    ++m_queued;
+    ++m_pending;
+    target = current_pool == this ? current_index
+                                  : m_next++ % m_queues.size();
+  }
+
+  {
+    std::lock_guard lock(m_queues[target]->mutex);
+    m_queues[target]->tasks.push_back(std::move(task));
+  }
+  m_work_available.notify_one();
+}
+
+void ThreadPool::wait_idle()
+{
+  std::unique_lock lock(m_state_mutex);
+  m_idle.wait(lock, [this] { return m_pending == 0; });
+}
+
+std::size_t ThreadPool::size() const
+{
+  return m_workers.size();
+}
+
+void ThreadPool::run_worker(std::size_t index)
+{
+  current_pool  = this;
+  current_index = index;
+
+  while(true) {
+    std::function<void()> task;
+
+    if(pop_local(index, task) || steal(index, task)) {
+      {
+        std::lock_guard lock(m_state_mutex);
+        --m_queued;
+      }
+
+      // Tasks report their own failures. An escaping exception must neither
+      // terminate the process nor leave wait_idle() waiting forever.
+      try {
+        task();
+      } catch(...) {
+      }
+
+      std::lock_guard lock(m_state_mutex);
+      if(--m_pending == 0) {
+        m_idle.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock lock(m_state_mutex);
+    m_work_available.wait(lock, [this] {
+      return m_stopping || m_queued > 0;
+    });
+
+    if(m_stopping && m_queued == 0) {
+      return;
+    }
+  }
+}
+
+bool ThreadPool::pop_local(std::size_t index, std::function<void()> &task)
+{
+  WorkQueue       &queue = *m_queues[index];
+  std::lock_guard lock(queue.mutex);
+  if(queue.tasks.empty()) {
+    return false;
+  }
+
+  task = std::move(queue.tasks.back());
+  queue.tasks.pop_back();
+  return true;
+}
+
+bool ThreadPool::steal(std::size_t thief, std::function<void()> &task)
+{
+  for(std::size_t offset = 1; offset < m_queues.size(); ++offset) {
+    WorkQueue       &victim = *m_queues[(thief + offset) % m_queues.size()];
+    std::lock_guard lock(victim.mutex);
+    if(victim.tasks.empty()) {
+      continue;
+    }
+
+    task = std::move(victim.tasks.front());
+    victim.tasks.pop_front();
+    return true;
+  }
+
+  return false;
+}
@@ -1,8 +1,20 @@
 #include "Nexpp/CommandLine/CommandLine.h"
 #include <qlogging.h>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
 
-CommandLine::CommandLine(const QApplication &application)
+#include "Nexpp/Server/GeneratorServer.h"
+#include "Nexpp/Toolchain/ToolchainProbe.h"
+#include "Nexpp/Trace/Trace.h"
+#include "Nexpp/Types/Library.h"
+
+CommandLine::CommandLine(const QCoreApplication &application)
+    : CommandLine(application.arguments())
+{
+}
+
+CommandLine::CommandLine(const QStringList &arguments)
 {
   m_parser.setApplicationDescription(
       "Nexpp - A tool to simplify the generation of modern C++ project "
@@ -12,11 +24,55 @@ CommandLine::CommandLine(const QApplication &application)
   m_parser.addVersionOption();
 
   setup_options();
-  m_parser.process(application);
+  m_parser.process(arguments);
 
   consume_options();
 }
 
+AppMode CommandLine::peek_mode(int argc, char **argv)
+{
+  for(int i = 1; i < argc; ++i) {
+    const std::string_view argument = argv[i];
+    std::string_view       value;
+
+    if((argument == "-m" || argument == "--mode") && i + 1 < argc) {
+      value = argv[i + 1];
+    } else if(argument.starts_with("--mode=")) {
+      value = argument.substr(7);
+    } else if(argument.starts_with("-m") && argument.size() > 2 &&
+              !argument.starts_with("--")) {
+      value = argument.substr(2);
+    } else {
+      continue;
+    }
+
+    const QString mode =
+        QString::fromUtf8(value.data(), static_cast<qsizetype>(value.size()))
+            .toLower();
+
+    if(mode == "gui") {
+      return AppMode::GUI;
+    }
+
+    return mode == "serve" ? AppMode::Server : AppMode::CLI;
+  }
+
+  return AppMode::CLI;
+}
+
+bool CommandLine::peek_trace(int argc, char **argv)
+{
+  for(int i = 1; i < argc; ++i) {
+    const std::string_view argument = argv[i];
+    if((argument == "--trace" && i + 1 < argc) ||
+       argument.starts_with("--trace=")) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 void CommandLine::setup_options()
 {
   add_mode_option();
@@ -25,17 +81,35 @@ void CommandLine::setup_options()
   add_libraries_option();
   add_standards_option();
   add_flags_option();
+  add_perf_option();
+  add_modules_option();
+  add_compiler_option();
+  add_no_probe_option();
+  add_manifest_option();
+  add_workspace_option();
+  add_jobs_option();
+  add_sync_option();
+  add_io_backend_option();
+  add_skeleton_cache_option();
+  add_socket_option();
+  add_connect_option();
+  add_archive_option();
+  add_archive_format_option();
+  add_dry_run_option();
+  add_import_gtest_option();
+  add_trace_option();
+  add_stats_options();
 }
 
 void CommandLine::add_mode_option()
 {
   QCommandLineOption mode_option(
       QStringList() << "m" << "mode",
-      QApplication::translate(
-          "main", "Defines how Nexpp will run: graphical interface (gui) or "
-                  "command line interface (cli)."
+      QCoreApplication::translate(
+          "main", "Defines how Nexpp will run: graphical interface (gui), "
+                  "command line interface (cli) or generator daemon (serve)."
       ),
-      QApplication::translate("main", "cli/gui")
+      QCoreApplication::translate("main", "cli/gui/serve")
   );
   m_parser.addOption(mode_option);
 }
@@ -44,8 +118,8 @@ void CommandLine::add_project_name_option()
 {
   QCommandLineOption project_name_option(
       QStringList() << "n" << "name",
-      QApplication::translate("main", "The name of your project"),
-      QApplication::translate("main", "Project name")
+      QCoreApplication::translate("main", "The name of your project"),
+      QCoreApplication::translate("main", "Project name")
   );
   m_parser.addOption(project_name_option);
 }
@@ -54,23 +128,22 @@ void CommandLine::add_destination_option()
 {
   QCommandLineOption destination_option(
       QStringList() << "d" << "destination",
-      QApplication::translate(
+      QCoreApplication::translate(
           "main", "Specifies the output directory where the generated project "
                   "will be created."
       ),
-      QApplication::translate("main", "path")
+      QCoreApplication::translate("main", "path")
   );
   m_parser.addOption(destination_option);
 }
 
 void CommandLine::add_libraries_option()
 {
-  const QStringList allowed_libraries = {"qt", "gtest"};
   m_parser.addOption(create_option_with_allowed_values(
       QStringList() << "l" << "libraries",
       "Specifies the libraries to include in the generated project. Multiple "
       "values can be provided, separated by commas.",
-      "libraries", allowed_libraries
+      "libraries", known_libraries()
   ));
 }
 
@@ -89,7 +162,7 @@ void CommandLine::add_flags_option()
 {
   QCommandLineOption flags_option(
       QStringList() << "f" << "flags",
-      QApplication::translate(
+      QCoreApplication::translate(
           "main", "Enables additional strict compile-time flags (e.g., "
                   "warnings as errors, extra warnings)."
       )
@@ -97,6 +170,242 @@ void CommandLine::add_flags_option()
   m_parser.addOption(flags_option);
 }
 
+void CommandLine::add_perf_option()
+{
+  m_parser.addOption(create_option_with_allowed_values(
+      QStringList() << "perf",
+      "Adds performance build options to the generated CMakeLists: "
+      "link-time optimization for Release (lto), opt-in unity builds (unity) "
+      "and precompiled standard headers (pch). Multiple values can be "
+      "provided, separated by commas.",
+      "options", known_perf_options()
+  ));
+}
+
+void CommandLine::add_modules_option()
+{
+  QCommandLineOption modules_option(
+      QStringList() << "modules",
+      QCoreApplication::translate(
+          "main", "Lays the project out as C++20 named modules (a primary "
+                  "interface and a partition) built through CMake file sets, "
+                  "with a script timing it against the header layout. "
+                  "Requires C++20 or later."
+      )
+  );
+  m_parser.addOption(modules_option);
+}
+
+void CommandLine::add_compiler_option()
+{
+  m_parser.addOption(create_option_with_allowed_values(
+      QStringList() << "compiler",
+      "Selects the compiler family used by the generated CMakePresets.json. "
+      "Defaults to the family of the compiler found on this machine.",
+      "family", known_compiler_families()
+  ));
+}
+
+void CommandLine::add_no_probe_option()
+{
+  QCommandLineOption no_probe_option(
+      QStringList() << "no-probe",
+      QCoreApplication::translate(
+          "main", "Skips toolchain probing: the generated CMake uses neither "
+                  "compiler launchers (ccache, sccache) nor fast linkers "
+                  "(mold, lld), and the presets use the default compiler."
+      )
+  );
+  m_parser.addOption(no_probe_option);
+}
+
+void CommandLine::add_manifest_option()
+{
+  QCommandLineOption manifest_option(
+      QStringList() << "manifest",
+      QCoreApplication::translate(
+          "main", "Generates every project described in the given JSON "
+                  "manifest in a single run."
+      ),
+      QCoreApplication::translate("main", "file")
+  );
+  m_parser.addOption(manifest_option);
+}
+
+void CommandLine::add_workspace_option()
+{
+  QCommandLineOption workspace_option(
+      QStringList() << "workspace",
+      QCoreApplication::translate(
+          "main", "Generates the requested projects as components of a single "
+                  "CMake workspace with this name, configured and built in one "
+                  "pass from its root."
+      ),
+      QCoreApplication::translate("main", "name")
+  );
+  m_parser.addOption(workspace_option);
+}
+
+void CommandLine::add_jobs_option()
+{
+  QCommandLineOption jobs_option(
+      QStringList() << "j" << "jobs",
+      QCoreApplication::translate(
+          "main", "Number of worker threads used in manifest mode. Defaults "
+                  "to the number of cores."
+      ),
+      QCoreApplication::translate("main", "count")
+  );
+  m_parser.addOption(jobs_option);
+}
+
+void CommandLine::add_sync_option()
+{
+  const QStringList allowed_policies = {"none", "project", "file"};
+  m_parser.addOption(create_option_with_allowed_values(
+      QStringList() << "sync",
+      "Selects how generated files are made durable before being published. "
+      "Defaults to one sync per project.",
+      "policy", allowed_policies
+  ));
+}
+
+void CommandLine::add_io_backend_option()
+{
+  const QStringList allowed_backends = {"sync", "uring"};
+  m_parser.addOption(create_option_with_allowed_values(
+      QStringList() << "io",
+      "Selects how generated files are written. 'uring' batches file "
+      "creation through io_uring and falls back to 'sync' when unavailable. "
+      "Defaults to 'sync'.",
+      "backend", allowed_backends
+  ));
+}
+
+void CommandLine::add_skeleton_cache_option()
+{
+  QCommandLineOption skeleton_cache_option(
+      QStringList() << "skeleton-cache",
+      QCoreApplication::translate(
+          "main", "Keeps one skeleton per distinct standard/libraries/flags "
+                  "combination in this directory. When the file system "
+                  "supports reflinks, new projects clone its "
+                  "name-independent files instead of writing them."
+      ),
+      QCoreApplication::translate("main", "directory")
+  );
+  m_parser.addOption(skeleton_cache_option);
+}
+
+void CommandLine::add_socket_option()
+{
+  QCommandLineOption socket_option(
+      QStringList() << "socket",
+      QCoreApplication::translate(
+          "main", "Unix socket used by the generator daemon. Defaults to "
+                  "nexpp.sock in $XDG_RUNTIME_DIR."
+      ),
+      QCoreApplication::translate("main", "path")
+  );
+  m_parser.addOption(socket_option);
+}
+
+void CommandLine::add_connect_option()
+{
+  QCommandLineOption connect_option(
+      QStringList() << "connect",
+      QCoreApplication::translate(
+          "main", "Sends the generation request to a running daemon, "
+                  "generating in-process when none is listening."
+      )
+  );
+  m_parser.addOption(connect_option);
+}
+
+void CommandLine::add_archive_option()
+{
+  QCommandLineOption archive_option(
+      QStringList() << "archive",
+      QCoreApplication::translate(
+          "main", "Streams the generated project into an archive instead of "
+                  "writing it to disk. Use '-' for standard output."
+      ),
+      QCoreApplication::translate("main", "file")
+  );
+  m_parser.addOption(archive_option);
+}
+
+void CommandLine::add_archive_format_option()
+{
+  const QStringList allowed_formats = {"tar", "zip"};
+  m_parser.addOption(create_option_with_allowed_values(
+      QStringList() << "archive-format",
+      "Selects the archive format. Defaults to 'zip' for .zip files and "
+      "'tar' otherwise.",
+      "format", allowed_formats
+  ));
+}
+
+void CommandLine::add_dry_run_option()
+{
+  QCommandLineOption dry_run_option(
+      QStringList() << "dry-run",
+      QCoreApplication::translate(
+          "main", "Prints a unified diff of what would be generated against "
+                  "the destination contents, without writing anything."
+      )
+  );
+  m_parser.addOption(dry_run_option);
+}
+
+void CommandLine::add_import_gtest_option()
+{
+  QCommandLineOption import_gtest_option(
+      QStringList() << "import-gtest",
+      QCoreApplication::translate(
+          "main", "Imports a googletest source archive into the shared "
+                  "dependency store, so generated gtest projects build "
+                  "offline."
+      ),
+      QCoreApplication::translate("main", "archive")
+  );
+  m_parser.addOption(import_gtest_option);
+}
+
+void CommandLine::add_trace_option()
+{
+  QCommandLineOption trace_option(
+      QStringList() << "trace",
+      QCoreApplication::translate(
+          "main", "Writes a Chrome trace-event JSON of parsing, rendering and "
+                  "file I/O phases to the given file (Perfetto compatible)."
+      ),
+      QCoreApplication::translate("main", "file")
+  );
+  m_parser.addOption(trace_option);
+}
+
+void CommandLine::add_stats_options()
+{
+  QCommandLineOption stats_option(
+      QStringList() << "stats",
+      QCoreApplication::translate(
+          "main", "Prints totals (projects, files, directories, bytes, "
+                  "syscalls) and p50/p95/p99/max latencies after the run."
+      )
+  );
+  m_parser.addOption(stats_option);
+
+  QCommandLineOption stats_json_option(
+      QStringList() << "stats-json",
+      QCoreApplication::translate(
+          "main", "Writes the run statistics as JSON to the given file."
+      ),
+      QCoreApplication::translate("main", "file")
+  );
+  m_parser.addOption(stats_json_option);
+}
+
 QCommandLineOption CommandLine::create_option_with_allowed_values(
     const QStringList &names, const QString &description,
     const QString &value_name, const QStringList &allowed_values
@@ -129,6 +438,26 @@ QStringList CommandLine::get_libraries() const
   return m_libraries;
 }
 
+PerfOptions CommandLine::get_perf_options() const
+{
+  return m_perf;
+}
+
+bool CommandLine::has_modules() const
+{
+  return m_modules;
+}
+
+CompilerFamily CommandLine::get_compiler() const
+{
+  return m_has_compiler ? m_compiler : ToolchainProbe::detect_compiler_family();
+}
+
+bool CommandLine::should_probe_toolchain() const
+{
+  return m_probe;
+}
+
 Standard CommandLine::get_standard() const
 {
   return m_standard;
@@ -139,26 +468,149 @@ bool CommandLine::has_flags() const
   return m_has_flags;
 }
 
+QString CommandLine::get_manifest() const
+{
+  return m_manifest;
+}
+
+QString CommandLine::get_workspace() const
+{
+  return m_workspace;
+}
+
+std::size_t CommandLine::get_jobs() const
+{
+  return m_jobs;
+}
+
+SyncPolicy CommandLine::get_sync_policy() const
+{
+  return m_sync_policy;
+}
+
+IoBackend CommandLine::get_io_backend() const
+{
+  return m_io_backend;
+}
+
+QString CommandLine::get_skeleton_cache() const
+{
+  return m_skeleton_cache;
+}
+
+QString CommandLine::get_socket() const
+{
+  return m_socket;
+}
+
+bool CommandLine::should_connect() const
+{
+  return m_connect;
+}
+
+QString CommandLine::get_gtest_import() const
+{
+  return m_gtest_import;
+}
+
+QString CommandLine::get_trace() const
+{
+  return m_trace;
+}
+
+bool CommandLine::should_print_stats() const
+{
+  return m_stats;
+}
+
+QString CommandLine::get_stats_json() const
+{
+  return m_stats_json;
+}
+
+QString CommandLine::get_archive() const
+{
+  return m_archive;
+}
+
+ArchiveFormat CommandLine::get_archive_format() const
+{
+  return m_archive_format;
+}
+
+bool CommandLine::is_dry_run() const
+{
+  return m_dry_run;
+}
+
+ProjectSpec CommandLine::get_project_spec() const
+{
+  ProjectSpec spec;
+  spec.name        = m_project_name.toStdString();
+  spec.destination = m_destination.toStdString();
+  spec.standard    = m_standard;
+  spec.has_flags   = m_has_flags;
+  spec.perf        = m_perf;
+  spec.modules     = m_modules;
+  spec.compiler    = get_compiler();
+
+  for(const auto &library : m_libraries) {
+    spec.libraries.push_back(library.toStdString());
+  }
+
+  return spec;
+}
+
+GenerationOptions CommandLine::get_generation_options() const
+{
+  GenerationOptions options;
+  options.sync_policy    = m_sync_policy;
+  options.io_backend     = m_io_backend;
+  options.skeleton_cache = m_skeleton_cache.toStdString();
+  return options;
+}
+
 void CommandLine::consume_options()
 {
+  NEXPP_TRACE_SCOPE("CommandLine::consume_options");
+
   QString mode_value = m_parser.value("m");
   if(mode_value.isEmpty()) {
     m_mode = AppMode::CLI;
   } else {
-    if(mode_value.toLower() != "gui" && mode_value.toLower() != "cli") {
+    mode_value = mode_value.toLower();
+    if(mode_value != "gui" && mode_value != "cli" && mode_value != "serve") {
       throw std::runtime_error("Mode argument is invalid");
     }
 
-    m_mode = (mode_value.toLower() == "gui") ? AppMode::GUI : AppMode::CLI;
+    m_mode = mode_value == "gui"     ? AppMode::GUI
+           : mode_value == "serve" ? AppMode::Server
+                                   : AppMode::CLI;
   }
 
-  if(m_parser.value("n").isEmpty()) {
+  m_manifest     = m_parser.value("manifest");
+  m_workspace    = m_parser.value("workspace");
+  m_gtest_import = m_parser.value("import-gtest");
+
+  // The GUI asks for the name in its own form and validates it there.
+  if(m_parser.value("n").isEmpty() && m_manifest.isEmpty() &&
+     m_gtest_import.isEmpty() && m_mode != AppMode::Server &&
+     m_mode != AppMode::GUI) {
     throw std::runtime_error("Project name is required (-n) !");
   }
 
   m_project_name = m_parser.value("n");
 
-  if(m_parser.value("d").isEmpty()) {
+  m_archive = m_parser.value("archive");
+
+  // A workspace is a tree of components, not a single project to stream.
+  if(!m_workspace.isEmpty() && !m_archive.isEmpty()) {
+    throw std::runtime_error("--archive cannot be combined with --workspace");
+  }
+
+  if(m_parser.value("d").isEmpty() && m_manifest.isEmpty() &&
+     m_archive.isEmpty() && m_mode != AppMode::Server &&
+     m_mode != AppMode::GUI) {
     qWarning(
     ) << "Destination value not provided, creating on current directory...";
   }
@@ -173,7 +625,7 @@ void CommandLine::consume_options()
 
     for(const auto &lib : libs) {
       QString lower_lib = lib.toLower();
-      if(lower_lib != "qt" && lower_lib != "gtest") {
+      if(!is_known_library(lower_lib)) {
         throw std::runtime_error("Unrecognized library: " + lib.toStdString());
       }
       bool already_present = std::any_of(
@@ -205,4 +657,79 @@ void CommandLine::consume_options()
       standard.isEmpty() ? Standard::CPP23 : from_int(standard.toInt());
 
   m_has_flags = m_parser.isSet("f");
+
+  m_perf      = parse_perf_options(
+      m_parser.isSet("perf") ? m_parser.value("perf").split(",") : QStringList()
+  );
+
+  m_modules   = m_parser.isSet("modules");
+
+  if(m_modules && m_standard < Standard::CPP20) {
+    throw std::runtime_error("C++20 modules need the C++20 or C++23 standard");
+  }
+
+  m_has_compiler = m_parser.isSet("compiler");
+  m_compiler     = m_has_compiler
+                     ? parse_compiler_family(m_parser.value("compiler"))
+                     : CompilerFamily::GCC;
+
+  m_probe        = !m_parser.isSet("no-probe");
+
+  m_jobs         = std::thread::hardware_concurrency();
+
+  if(m_parser.isSet("j")) {
+    bool      valid = false;
+    const int jobs  = m_parser.value("j").toInt(&valid);
+    if(!valid || jobs <= 0) {
+      throw std::runtime_error("Jobs argument is invalid");
+    }
+
+    m_jobs = static_cast<std::size_t>(jobs);
+  }
+
+  const QString sync_value = m_parser.value("sync").toLower();
+  if(sync_value.isEmpty() || sync_value == "project") {
+    m_sync_policy = SyncPolicy::PerProject;
+  } else if(sync_value == "none") {
+    m_sync_policy = SyncPolicy::None;
+  } else if(sync_value == "file") {
+    m_sync_policy = SyncPolicy::PerFile;
+  } else {
+    throw std::runtime_error("Sync argument is invalid");
+  }
+
+  const QString io_value = m_parser.value("io").toLower();
+  if(io_value.isEmpty() || io_value == "sync") {
+    m_io_backend = IoBackend::Sync;
+  } else if(io_value == "uring") {
+    m_io_backend = IoBackend::Uring;
+  } else {
+    throw std::runtime_error("IO backend argument is invalid");
+  }
+
+  m_skeleton_cache = m_parser.value("skeleton-cache");
+
+  m_socket  = m_parser.value("socket").isEmpty()
+                  ? QString::fromStdString(
+                        GeneratorServer::default_socket_path().string()
+                    )
+                  : m_parser.value("socket");
+  m_connect = m_parser.isSet("connect");
+  m_dry_run = m_parser.isSet("dry-run");
+  m_trace      = m_parser.value("trace");
+  m_stats      = m_parser.isSet("stats");
+  m_stats_json = m_parser.value("stats-json");
+
+  const QString format_value = m_parser.value("archive-format").toLower();
+  if(format_value.isEmpty()) {
+    m_archive_format = m_archive.toLower().endsWith(".zip")
+                           ? ArchiveFormat::Zip
+                           : ArchiveFormat::Tar;
+  } else if(format_value == "tar") {
+    m_archive_format = ArchiveFormat::Tar;
+  } else if(format_value == "zip") {
+    m_archive_format = ArchiveFormat::Zip;
+  } else {
+    throw std::runtime_error("Archive format argument is invalid");
+  }
 }
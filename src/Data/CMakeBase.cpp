@@ -1,55 +1,1267 @@
-#include <QString>
-
 #include "Nexpp/Data/CMakeBase.h"
 
+#include <cctype>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "Nexpp/Dependencies/Dependency.h"
+#include "Nexpp/Template/Template.h"
+#include "Nexpp/Trace/Trace.h"
+
+namespace {
+using ProjectConfig = Template<
+    "cmake_minimum_required(VERSION 3.28)\n"
+    "project(%1)\n"
+    "\n"
+    "set(CMAKE_CXX_STANDARD %2)\n">;
+
+using LauncherConfig = Template<
+    "\n"
+    "find_program(%1_COMPILER_LAUNCHER %2)\n"
+    "if(%1_COMPILER_LAUNCHER AND NOT CMAKE_CXX_COMPILER_LAUNCHER)\n"
+    "  set(CMAKE_C_COMPILER_LAUNCHER ${%1_COMPILER_LAUNCHER})\n"
+    "  set(CMAKE_CXX_COMPILER_LAUNCHER ${%1_COMPILER_LAUNCHER})\n"
+    "endif()\n">;
+
+using LinkerConfig = Template<
+    "\n"
+    "include(CheckLinkerFlag)\n"
+    "check_linker_flag(CXX -fuse-ld=%2 %1_FAST_LINKER_SUPPORTED)\n"
+    "if(%1_FAST_LINKER_SUPPORTED)\n"
+    "  add_link_options(-fuse-ld=%2)\n"
+    "endif()\n">;
+
+using TargetConfig = Template<
+    "\n"
+    "add_executable(\n"
+    "  %1\n"
+    "  src/main.cpp\n"
+    ")\n"
+    "\n"
+    "target_include_directories(\n"
+    "  %1\n"
+    "  PRIVATE\n"
+    "  ${CMAKE_CURRENT_SOURCE_DIR}/include\n"
+    ")\n">;
+
+using ModulesTargetConfig = Template<
+    "\n"
+    "add_executable(\n"
+    "  %1\n"
+    "  src/main.cpp\n"
+    ")\n"
+    "\n"
+    "target_sources(\n"
+    "  %1\n"
+    "  PRIVATE\n"
+    "  FILE_SET CXX_MODULES\n"
+    "  FILES\n"
+    "  src/%1.cppm\n"
+    "  src/%1-greeting.cppm\n"
+    ")\n"
+    "\n"
+    "target_include_directories(\n"
+    "  %1\n"
+    "  PRIVATE\n"
+    "  ${CMAKE_CURRENT_SOURCE_DIR}/include\n"
+    ")\n"
+    "\n"
+    "option(%2_IMPORT_STD \"Use import std; where the toolchain supports it\" "
+    "OFF)\n"
+    "if(%2_IMPORT_STD)\n"
+    "  if(CMAKE_CXX_STANDARD IN_LIST CMAKE_CXX_COMPILER_IMPORT_STD)\n"
+    "    set_target_properties(%1 PROPERTIES CXX_MODULE_STD ON)\n"
+    "    target_compile_definitions(%1 PRIVATE %3_IMPORT_STD)\n"
+    "  else()\n"
+    "    message(\n"
+    "      STATUS\n"
+    "      \"import std is unavailable for C++${CMAKE_CXX_STANDARD}, using \"\n"
+    "      \"#include instead (it needs CMAKE_EXPERIMENTAL_CXX_IMPORT_STD)\"\n"
+    "    )\n"
+    "  endif()\n"
+    "endif()\n">;
+
+using FlagsConfig = Template<
+    "\n"
+    "target_compile_options(\n"
+    "  %1\n"
+    "  %2\n"
+    "  -Wall\n"
+    "  -Wextra\n"
+    "  -Wpedantic\n"
+    "  -Werror\n"
+    "  -Wshadow\n"
+    "  -Wnon-virtual-dtor\n"
+    "  -Wold-style-cast\n"
+    "  -Wcast-align\n"
+    "  -Wunused\n"
+    "  -Wconversion\n"
+    "  -Wsign-conversion\n"
+    "  -Wnull-dereference\n"
+    "  -Wdouble-promotion\n"
+    "  -Wimplicit-fallthrough\n"
+    ")\n">;
+
+using IpoConfig = Template<
+    "\n"
+    "option(%2_ENABLE_IPO \"Enable link-time optimization for Release builds\" "
+    "ON)\n"
+    "if(%2_ENABLE_IPO)\n"
+    "  include(CheckIPOSupported)\n"
+    "  check_ipo_supported(\n"
+    "    RESULT %2_IPO_SUPPORTED\n"
+    "    OUTPUT %2_IPO_OUTPUT\n"
+    "    LANGUAGES CXX\n"
+    "  )\n"
+    "  if(%2_IPO_SUPPORTED)\n"
+    "    set_property(\n"
+    "      TARGET %1\n"
+    "      PROPERTY INTERPROCEDURAL_OPTIMIZATION_RELEASE ON\n"
+    "    )\n"
+    "  else()\n"
+    "    message(WARNING \"IPO is not supported: ${%2_IPO_OUTPUT}\")\n"
+    "  endif()\n"
+    "endif()\n">;
+
+using UnityConfig = Template<
+    "\n"
+    "option(%2_ENABLE_UNITY_BUILD \"Compile sources in unity (jumbo) batches\" "
+    "OFF)\n"
+    "set_target_properties(\n"
+    "  %1\n"
+    "  PROPERTIES UNITY_BUILD ${%2_ENABLE_UNITY_BUILD}\n"
+    ")\n">;
+
+using PchConfig = Template<
+    "\n"
+    "option(%2_ENABLE_PCH \"Precompile the standard library headers\" ON)\n"
+    "if(%2_ENABLE_PCH)\n"
+    "  target_precompile_headers(\n"
+    "    %1\n"
+    "    PRIVATE\n"
+    "%3"
+    "  )\n"
+    "endif()\n">;
+
+using PchHeader = Template<"    <%1>\n">;
+
+using BenchmarkFetch = Template<
+    "\n"
+    "include(FetchContent)\n"
+    "set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL \"\" FORCE)\n"
+    "set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL \"\" FORCE)\n"
+    "FetchContent_Declare(\n"
+    "  googlebenchmark\n"
+    "  URL https://github.com/google/benchmark/archive/refs/tags/v1.9.1.zip\n"
+    ")\n"
+    "FetchContent_MakeAvailable(googlebenchmark)\n">;
+
+using BenchmarkTarget = Template<
+    "\n"
+    "add_executable(\n"
+    "  %1_bench\n"
+    "  bench/%1_bench.cpp\n"
+    ")\n"
+    "\n"
+    "target_link_libraries(\n"
+    "  %1_bench\n"
+    "  PRIVATE\n"
+    "  benchmark::benchmark_main\n"
+    ")\n"
+    "\n"
+    "set_target_properties(\n"
+    "  %1_bench\n"
+    "  PROPERTIES RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/bench$<0:>\n"
+    ")\n">;
+
+using BenchmarkRun = Template<
+    "\n"
+    "set(\n"
+    "  %2_BENCHMARK_RESULTS ${CMAKE_BINARY_DIR}/benchmark_results.json\n"
+    "  CACHE FILEPATH \"JSON report written by run_benchmarks\"\n"
+    ")\n"
+    "get_property(%2_MULTI_CONFIG GLOBAL PROPERTY GENERATOR_IS_MULTI_CONFIG)\n"
+    "\n"
+    "if(CMAKE_BUILD_TYPE STREQUAL \"Release\" AND NOT %2_MULTI_CONFIG)\n"
+    "  add_custom_target(\n"
+    "    run_benchmarks\n"
+    "    COMMAND %1_bench\n"
+    "      --benchmark_out=${%2_BENCHMARK_RESULTS}\n"
+    "      --benchmark_out_format=json\n"
+    "    DEPENDS %1_bench\n"
+    "    USES_TERMINAL\n"
+    "    VERBATIM\n"
+    "  )\n"
+    "else()\n"
+    "  set(%2_BENCHMARK_BINARY_DIR ${CMAKE_BINARY_DIR}/bench-release)\n"
+    "  add_custom_target(\n"
+    "    run_benchmarks\n"
+    "    COMMAND ${CMAKE_COMMAND}\n"
+    "      -S ${CMAKE_SOURCE_DIR}\n"
+    "      -B ${%2_BENCHMARK_BINARY_DIR}\n"
+    "      -G ${CMAKE_GENERATOR}\n"
+    "      -DCMAKE_BUILD_TYPE=Release\n"
+    "      -DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}\n"
+    "    COMMAND ${CMAKE_COMMAND}\n"
+    "      --build ${%2_BENCHMARK_BINARY_DIR}\n"
+    "      --config Release\n"
+    "      --target %1_bench\n"
+    "    COMMAND ${%2_BENCHMARK_BINARY_DIR}/bench/%1_bench\n"
+    "      --benchmark_out=${%2_BENCHMARK_RESULTS}\n"
+    "      --benchmark_out_format=json\n"
+    "    USES_TERMINAL\n"
+    "    VERBATIM\n"
+    "  )\n"
+    "endif()\n">;
+
+using QtFind = Template<
+    "\n"
+    "find_package(Qt6 REQUIRED COMPONENTS Core)\n">;
+
+using QtLink = Template<
+    "\n"
+    "target_link_libraries(\n"
+    "  %1\n"
+    "  PRIVATE\n"
+    "  Qt6::Core\n"
+    ")\n">;
+
+using GTestProvide = Template<
+    "\n"
+    "enable_testing()\n"
+    "include(${CMAKE_CURRENT_SOURCE_DIR}/cmake/Dependencies.cmake)\n"
+    "nexpp_provide_googletest()\n">;
+
+using GTestTarget = Template<
+    "\n"
+    "add_executable(\n"
+    "  %1_tests\n"
+    "  tests/%1_test.cpp\n"
+    ")\n"
+    "\n"
+    "target_link_libraries(\n"
+    "  %1_tests\n"
+    "  PRIVATE\n"
+    "  GTest::gtest_main\n"
+    ")\n">;
+
+using GTestDiscover = Template<
+    "\n"
+    "include(GoogleTest)\n"
+    "gtest_discover_tests(%1_tests)\n">;
+
+using DependenciesModule = Template<
+    "if(DEFINED ENV{NEXPP_DEPS_STORE})\n"
+    "  set(NEXPP_DEPS_STORE_DEFAULT $ENV{NEXPP_DEPS_STORE})\n"
+    "elseif(DEFINED ENV{XDG_DATA_HOME})\n"
+    "  set(NEXPP_DEPS_STORE_DEFAULT $ENV{XDG_DATA_HOME}/nexpp/deps)\n"
+    "elseif(DEFINED ENV{HOME})\n"
+    "  set(NEXPP_DEPS_STORE_DEFAULT $ENV{HOME}/.local/share/nexpp/deps)\n"
+    "else()\n"
+    "  set(NEXPP_DEPS_STORE_DEFAULT ${CMAKE_BINARY_DIR}/nexpp-deps)\n"
+    "endif()\n"
+    "\n"
+    "set(\n"
+    "  NEXPP_DEPS_STORE ${NEXPP_DEPS_STORE_DEFAULT}\n"
+    "  CACHE PATH \"Dependency store shared by Nexpp-generated projects\"\n"
+    ")\n"
+    "\n"
+    "function(nexpp_provide_googletest)\n"
+    "  set(name %1)\n"
+    "  set(sources ${NEXPP_DEPS_STORE}/sources)\n"
+    "  set(packages ${NEXPP_DEPS_STORE}/packages)\n"
+    "  set(source_dir ${sources}/${name})\n"
+    "  string(REGEX MATCH \"^[0-9]+\" major ${CMAKE_CXX_COMPILER_VERSION})\n"
+    "  set(standard cxx${CMAKE_CXX_STANDARD})\n"
+    "  set(toolchain ${CMAKE_CXX_COMPILER_ID}-${major}-${standard})\n"
+    "  set(package_dir ${packages}/${name}/${toolchain})\n"
+    "\n"
+    "  if(NOT EXISTS ${package_dir}/.nexpp-complete)\n"
+    "    file(MAKE_DIRECTORY ${sources} ${packages})\n"
+    "    file(LOCK ${packages}/${name}.lock GUARD FUNCTION TIMEOUT 3600)\n"
+    "\n"
+    "    if(NOT EXISTS ${source_dir}/CMakeLists.txt)\n"
+    "      set(archive ${sources}/${name}.tar.gz)\n"
+    "      message(STATUS \"Downloading ${name} into ${sources}\")\n"
+    "      file(\n"
+    "        DOWNLOAD %2 ${archive}\n"
+    "        EXPECTED_HASH SHA256=%3\n"
+    "        STATUS status\n"
+    "      )\n"
+    "      list(GET status 0 status_code)\n"
+    "      if(NOT status_code EQUAL 0)\n"
+    "        file(REMOVE ${archive})\n"
+    "        message(\n"
+    "          FATAL_ERROR\n"
+    "          \"Cannot download ${name}. On offline hosts, import it \"\n"
+    "          \"once with: nexpp --import-gtest <googletest archive>\"\n"
+    "        )\n"
+    "      endif()\n"
+    "      file(ARCHIVE_EXTRACT INPUT ${archive} DESTINATION ${sources})\n"
+    "      file(REMOVE ${archive})\n"
+    "    endif()\n"
+    "\n"
+    "    if(NOT EXISTS ${package_dir}/.nexpp-complete)\n"
+    "      message(STATUS \"Building ${name} into ${package_dir}\")\n"
+    "      set(build_dir ${package_dir}-build)\n"
+    "      execute_process(\n"
+    "        COMMAND ${CMAKE_COMMAND}\n"
+    "          -S ${source_dir}\n"
+    "          -B ${build_dir}\n"
+    "          -G ${CMAKE_GENERATOR}\n"
+    "          -DCMAKE_BUILD_TYPE=Release\n"
+    "          -DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}\n"
+    "          -DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}\n"
+    "          -DCMAKE_CXX_STANDARD=${CMAKE_CXX_STANDARD}\n"
+    "          -DCMAKE_INSTALL_PREFIX=${package_dir}\n"
+    "          -DCMAKE_POSITION_INDEPENDENT_CODE=ON\n"
+    "        RESULT_VARIABLE result\n"
+    "      )\n"
+    "      if(result EQUAL 0)\n"
+    "        execute_process(\n"
+    "          COMMAND ${CMAKE_COMMAND}\n"
+    "            --build ${build_dir}\n"
+    "            --config Release\n"
+    "            --target install\n"
+    "          RESULT_VARIABLE result\n"
+    "        )\n"
+    "      endif()\n"
+    "      file(REMOVE_RECURSE ${build_dir})\n"
+    "      if(NOT result EQUAL 0)\n"
+    "        message(FATAL_ERROR \"Building ${name} failed\")\n"
+    "      endif()\n"
+    "      file(TOUCH ${package_dir}/.nexpp-complete)\n"
+    "    endif()\n"
+    "  endif()\n"
+    "\n"
+    "  find_package(\n"
+    "    GTest CONFIG REQUIRED\n"
+    "    PATHS ${package_dir}\n"
+    "    NO_DEFAULT_PATH\n"
+    "  )\n"
+    "endfunction()\n">;
+
+using PgoInclude = Template<
+    "\n"
+    "include(${CMAKE_CURRENT_SOURCE_DIR}/cmake/Pgo.cmake)\n">;
+
+using WorkspaceOptions = Template<
+    "\n"
+    "add_library(%1_options INTERFACE)\n">;
+
+using WorkspaceIpo = Template<
+    "\n"
+    "option(%1_ENABLE_IPO \"Enable link-time optimization for Release builds\" "
+    "ON)\n"
+    "if(%1_ENABLE_IPO)\n"
+    "  include(CheckIPOSupported)\n"
+    "  check_ipo_supported(\n"
+    "    RESULT %1_IPO_SUPPORTED\n"
+    "    OUTPUT %1_IPO_OUTPUT\n"
+    "    LANGUAGES CXX\n"
+    "  )\n"
+    "  if(NOT %1_IPO_SUPPORTED)\n"
+    "    message(WARNING \"IPO is not supported: ${%1_IPO_OUTPUT}\")\n"
+    "  endif()\n"
+    "endif()\n">;
+
+using WorkspaceUnity = Template<
+    "\n"
+    "option(%1_ENABLE_UNITY_BUILD \"Compile sources in unity (jumbo) batches\" "
+    "OFF)\n">;
+
+using WorkspacePch = Template<
+    "\n"
+    "option(%2_ENABLE_PCH \"Precompile the standard library headers\" ON)\n"
+    "if(%2_ENABLE_PCH)\n"
+    "  add_library(\n"
+    "    %1_pch\n"
+    "    OBJECT\n"
+    "    common/pch.cpp\n"
+    "  )\n"
+    "  target_link_libraries(\n"
+    "    %1_pch\n"
+    "    PRIVATE\n"
+    "    %1_options\n"
+    "  )\n"
+    "  target_precompile_headers(\n"
+    "    %1_pch\n"
+    "    PRIVATE\n"
+    "%3"
+    "  )\n"
+    "endif()\n">;
+
+using WorkspaceGoogleTest = Template<"include(GoogleTest)\n">;
+
+using WorkspaceComponents = Template<"\n">;
+
+using WorkspaceComponent = Template<"add_subdirectory(%1)\n">;
+
+using ComponentHeader = Template<
+    "# Component of the %1 workspace: configure it from the workspace root.\n">;
+
+using ComponentOptions = Template<
+    "\n"
+    "target_link_libraries(\n"
+    "  %1\n"
+    "  PRIVATE\n"
+    "  %2_options\n"
+    ")\n">;
+
+using ComponentIpo = Template<
+    "\n"
+    "if(%2_IPO_SUPPORTED)\n"
+    "  set_property(\n"
+    "    TARGET %1\n"
+    "    PROPERTY INTERPROCEDURAL_OPTIMIZATION_RELEASE ON\n"
+    "  )\n"
+    "endif()\n">;
+
+using ComponentUnity = Template<
+    "\n"
+    "set_target_properties(\n"
+    "  %1\n"
+    "  PROPERTIES UNITY_BUILD ${%2_ENABLE_UNITY_BUILD}\n"
+    ")\n">;
+
+using ComponentPch = Template<
+    "\n"
+    "if(%3_ENABLE_PCH)\n"
+    "  target_precompile_headers(%1 REUSE_FROM %2_pch)\n"
+    "endif()\n">;
+
+using ComponentDiscover = Template<
+    "\n"
+    "gtest_discover_tests(%1_tests)\n">;
+
+using LayoutComparison = Template<
+    "# Times clean builds of this modules layout against the classic header\n"
+    "# layout of the same project, generated with the same options but\n"
+    "# without --modules:\n"
+    "#\n"
+    "#   nexpp -n %1%2 -d /tmp/classic\n"
+    "#   cmake -D CLASSIC_SOURCE_DIR=/tmp/classic/%1 -P "
+    "cmake/CompareLayouts.cmake\n"
+    "#\n"
+    "# RUNS (default 3) sets the builds timed per layout and GENERATOR "
+    "(default\n"
+    "# Ninja) the generator; modules need Ninja 1.11 or Visual Studio.\n"
+    "cmake_minimum_required(VERSION 3.28)\n"
+    "\n"
+    "if(NOT DEFINED CLASSIC_SOURCE_DIR)\n"
+    "  message(FATAL_ERROR \"Set CLASSIC_SOURCE_DIR to the header layout "
+    "project\")\n"
+    "endif()\n"
+    "if(NOT DEFINED RUNS)\n"
+    "  set(RUNS 3)\n"
+    "endif()\n"
+    "if(NOT DEFINED GENERATOR)\n"
+    "  set(GENERATOR Ninja)\n"
+    "endif()\n"
+    "\n"
+    "get_filename_component(MODULES_SOURCE_DIR ${CMAKE_CURRENT_LIST_DIR} "
+    "DIRECTORY)\n"
+    "set(COMPARISON_DIR ${MODULES_SOURCE_DIR}/build/layout-comparison)\n"
+    "\n"
+    "function(time_layout layout source_dir)\n"
+    "  set(binary_dir ${COMPARISON_DIR}/${layout})\n"
+    "  file(REMOVE_RECURSE ${binary_dir})\n"
+    "  execute_process(\n"
+    "    COMMAND ${CMAKE_COMMAND}\n"
+    "      -S ${source_dir}\n"
+    "      -B ${binary_dir}\n"
+    "      -G ${GENERATOR}\n"
+    "      -DCMAKE_BUILD_TYPE=Release\n"
+    "    RESULT_VARIABLE result\n"
+    "    OUTPUT_QUIET\n"
+    "  )\n"
+    "  if(NOT result EQUAL 0)\n"
+    "    message(FATAL_ERROR \"Cannot configure the ${layout} layout\")\n"
+    "  endif()\n"
+    "\n"
+    "  set(best \"\")\n"
+    "  set(total 0)\n"
+    "  foreach(run RANGE 1 ${RUNS})\n"
+    "    execute_process(\n"
+    "      COMMAND ${CMAKE_COMMAND} --build ${binary_dir} --target clean\n"
+    "      OUTPUT_QUIET\n"
+    "    )\n"
+    "    string(TIMESTAMP start \"%s%f\" UTC)\n"
+    "    execute_process(\n"
+    "      COMMAND ${CMAKE_COMMAND} --build ${binary_dir}\n"
+    "      RESULT_VARIABLE result\n"
+    "      OUTPUT_QUIET\n"
+    "    )\n"
+    "    string(TIMESTAMP stop \"%s%f\" UTC)\n"
+    "    if(NOT result EQUAL 0)\n"
+    "      message(FATAL_ERROR \"Building the ${layout} layout failed\")\n"
+    "    endif()\n"
+    "\n"
+    "    math(EXPR elapsed \"(${stop} - ${start}) / 1000\")\n"
+    "    math(EXPR total \"${total} + ${elapsed}\")\n"
+    "    if(best STREQUAL \"\" OR elapsed LESS best)\n"
+    "      set(best ${elapsed})\n"
+    "    endif()\n"
+    "  endforeach()\n"
+    "\n"
+    "  math(EXPR average \"${total} / ${RUNS}\")\n"
+    "  message(\n"
+    "    STATUS\n"
+    "    \"${layout}: best ${best} ms, average ${average} ms over ${RUNS} \"\n"
+    "    \"clean builds\"\n"
+    "  )\n"
+    "  set(${layout}_best ${best} PARENT_SCOPE)\n"
+    "endfunction()\n"
+    "\n"
+    "time_layout(headers ${CLASSIC_SOURCE_DIR})\n"
+    "time_layout(modules ${MODULES_SOURCE_DIR})\n"
+    "\n"
+    "if(modules_best GREATER 0)\n"
+    "  math(EXPR ratio \"${headers_best} * 100 / ${modules_best}\")\n"
+    "  message(STATUS \"headers/modules best build time: ${ratio}%%\")\n"
+    "endif()\n">;
+
+using PgoModule = Template<
+    "set(%2_PGO_MODE OFF CACHE STRING \"Profile-guided optimization stage\")\n"
+    "set_property(CACHE %2_PGO_MODE PROPERTY STRINGS OFF GENERATE USE)\n"
+    "set(\n"
+    "  %2_PGO_DIR ${CMAKE_BINARY_DIR}/pgo-profile\n"
+    "  CACHE PATH \"Directory holding the profile-guided optimization data\"\n"
+    ")\n"
+    "\n"
+    "if(TARGET %1_bench)\n"
+    "  set(%2_PGO_TARGETS %1 %1_bench)\n"
+    "  set(%2_PGO_TRAINING %1_bench)\n"
+    "elseif(TARGET %1_tests)\n"
+    "  set(%2_PGO_TARGETS %1 %1_tests)\n"
+    "  set(%2_PGO_TRAINING %1_tests)\n"
+    "else()\n"
+    "  set(%2_PGO_TARGETS %1)\n"
+    "  set(%2_PGO_TRAINING %1)\n"
+    "endif()\n"
+    "\n"
+    "if(CMAKE_CXX_COMPILER_ID MATCHES \"Clang\")\n"
+    "  set(%2_PGO_PROFILE ${%2_PGO_DIR}/merged.profdata)\n"
+    "  set(%2_PGO_GENERATE_FLAGS -fprofile-generate=${%2_PGO_DIR}/raw)\n"
+    "  set(\n"
+    "    %2_PGO_USE_FLAGS\n"
+    "    -fprofile-use=${%2_PGO_PROFILE}\n"
+    "    -Wno-profile-instr-out-of-date\n"
+    "  )\n"
+    "else()\n"
+    "  set(%2_PGO_PROFILE ${%2_PGO_DIR})\n"
+    "  set(\n"
+    "    %2_PGO_GENERATE_FLAGS\n"
+    "    -fprofile-generate=${%2_PGO_DIR}\n"
+    "    -fprofile-update=atomic\n"
+    "  )\n"
+    "  set(\n"
+    "    %2_PGO_USE_FLAGS\n"
+    "    -fprofile-use=${%2_PGO_DIR}\n"
+    "    -fprofile-partial-training\n"
+    "    -Wno-missing-profile\n"
+    "  )\n"
+    "  if(CMAKE_CXX_COMPILER_VERSION VERSION_GREATER_EQUAL 12)\n"
+    "    list(\n"
+    "      APPEND %2_PGO_GENERATE_FLAGS\n"
+    "      -fprofile-prefix-path=${CMAKE_BINARY_DIR}\n"
+    "    )\n"
+    "    list(\n"
+    "      APPEND %2_PGO_USE_FLAGS\n"
+    "      -fprofile-prefix-path=${CMAKE_BINARY_DIR}\n"
+    "    )\n"
+    "  endif()\n"
+    "endif()\n"
+    "\n"
+    "if(%2_PGO_MODE STREQUAL \"GENERATE\")\n"
+    "  foreach(%2_PGO_TARGET IN LISTS %2_PGO_TARGETS)\n"
+    "    target_compile_options(\n"
+    "      ${%2_PGO_TARGET} PRIVATE ${%2_PGO_GENERATE_FLAGS}\n"
+    "    )\n"
+    "    target_link_options(\n"
+    "      ${%2_PGO_TARGET} PRIVATE ${%2_PGO_GENERATE_FLAGS}\n"
+    "    )\n"
+    "  endforeach()\n"
+    "\n"
+    "  set(%2_PGO_MERGE)\n"
+    "  if(CMAKE_CXX_COMPILER_ID MATCHES \"Clang\")\n"
+    "    get_filename_component(\n"
+    "      %2_COMPILER_DIR ${CMAKE_CXX_COMPILER} DIRECTORY\n"
+    "    )\n"
+    "    find_program(\n"
+    "      %2_LLVM_PROFDATA\n"
+    "      NAMES llvm-profdata\n"
+    "      HINTS ${%2_COMPILER_DIR}\n"
+    "      REQUIRED\n"
+    "    )\n"
+    "    set(\n"
+    "      %2_PGO_MERGE\n"
+    "      COMMAND ${%2_LLVM_PROFDATA} merge\n"
+    "        -output=${%2_PGO_PROFILE}\n"
+    "        ${%2_PGO_DIR}/raw\n"
+    "    )\n"
+    "  endif()\n"
+    "\n"
+    "  add_custom_target(\n"
+    "    pgo_train\n"
+    "    COMMAND ${CMAKE_COMMAND} -E rm -rf ${%2_PGO_DIR}\n"
+    "    COMMAND ${CMAKE_COMMAND} -E make_directory ${%2_PGO_DIR}\n"
+    "    COMMAND ${%2_PGO_TRAINING}\n"
+    "    ${%2_PGO_MERGE}\n"
+    "    DEPENDS ${%2_PGO_TRAINING}\n"
+    "    USES_TERMINAL\n"
+    "    VERBATIM\n"
+    "  )\n"
+    "elseif(%2_PGO_MODE STREQUAL \"USE\")\n"
+    "  if(NOT EXISTS ${%2_PGO_PROFILE})\n"
+    "    message(\n"
+    "      FATAL_ERROR\n"
+    "      \"No profile data in ${%2_PGO_DIR}: build the pgo_train target \"\n"
+    "      \"of the pgo-instrument preset first\"\n"
+    "    )\n"
+    "  endif()\n"
+    "\n"
+    "  foreach(%2_PGO_TARGET IN LISTS %2_PGO_TARGETS)\n"
+    "    target_compile_options(\n"
+    "      ${%2_PGO_TARGET} PRIVATE ${%2_PGO_USE_FLAGS}\n"
+    "    )\n"
+    "  endforeach()\n"
+    "endif()\n">;
+
+using Presets = Template<
+    "{\n"
+    "  \"version\": 6,\n"
+    "  \"cmakeMinimumRequired\": {\n"
+    "    \"major\": 3,\n"
+    "    \"minor\": 28,\n"
+    "    \"patch\": 0\n"
+    "  },\n"
+    "  \"configurePresets\": [\n"
+    "    {\n"
+    "      \"name\": \"base\",\n"
+    "      \"hidden\": true,\n"
+    "      \"generator\": \"Ninja\",\n"
+    "      \"binaryDir\": \"${sourceDir}/build/${presetName}\",\n"
+    "      \"cacheVariables\": {\n"
+    "        \"CMAKE_C_COMPILER\": \"%1\",\n"
+    "        \"CMAKE_CXX_COMPILER\": \"%2\",\n"
+    "        \"CMAKE_EXPORT_COMPILE_COMMANDS\": \"ON\"\n"
+    "      }\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"debug\",\n"
+    "      \"displayName\": \"Debug\",\n"
+    "      \"inherits\": \"base\",\n"
+    "      \"cacheVariables\": {\n"
+    "        \"CMAKE_BUILD_TYPE\": \"Debug\"\n"
+    "      }\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"release\",\n"
+    "      \"displayName\": \"Release\",\n"
+    "      \"inherits\": \"base\",\n"
+    "      \"cacheVariables\": {\n"
+    "        \"CMAKE_BUILD_TYPE\": \"Release\"\n"
+    "      }\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"relwithdebinfo\",\n"
+    "      \"displayName\": \"Release with debug info\",\n"
+    "      \"inherits\": \"base\",\n"
+    "      \"cacheVariables\": {\n"
+    "        \"CMAKE_BUILD_TYPE\": \"RelWithDebInfo\"\n"
+    "      }\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"pgo\",\n"
+    "      \"hidden\": true,\n"
+    "      \"inherits\": \"release\",\n"
+    "      \"cacheVariables\": {\n"
+    "        \"%3_PGO_DIR\": \"${sourceDir}/build/pgo-profile\"\n"
+    "      }\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"pgo-instrument\",\n"
+    "      \"displayName\": \"PGO: instrumented Release\",\n"
+    "      \"inherits\": \"pgo\",\n"
+    "      \"cacheVariables\": {\n"
+    "        \"%3_PGO_MODE\": \"GENERATE\"\n"
+    "      }\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"pgo-use\",\n"
+    "      \"displayName\": \"PGO: profile-optimized Release\",\n"
+    "      \"inherits\": \"pgo\",\n"
+    "      \"cacheVariables\": {\n"
+    "        \"%3_PGO_MODE\": \"USE\"\n"
+    "      }\n"
+    "    }\n"
+    "  ],\n"
+    "  \"buildPresets\": [\n"
+    "    {\n"
+    "      \"name\": \"debug\",\n"
+    "      \"configurePreset\": \"debug\"\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"release\",\n"
+    "      \"configurePreset\": \"release\"\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"relwithdebinfo\",\n"
+    "      \"configurePreset\": \"relwithdebinfo\"\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"pgo-instrument\",\n"
+    "      \"configurePreset\": \"pgo-instrument\"\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"pgo-train\",\n"
+    "      \"configurePreset\": \"pgo-instrument\",\n"
+    "      \"targets\": [\"pgo_train\"]\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"pgo-use\",\n"
+    "      \"configurePreset\": \"pgo-use\"\n"
+    "    }\n"
+    "  ],\n"
+    "  \"workflowPresets\": [\n"
+    "    {\n"
+    "      \"name\": \"pgo-instrument\",\n"
+    "      \"steps\": [\n"
+    "        {\n"
+    "          \"type\": \"configure\",\n"
+    "          \"name\": \"pgo-instrument\"\n"
+    "        },\n"
+    "        {\n"
+    "          \"type\": \"build\",\n"
+    "          \"name\": \"pgo-train\"\n"
+    "        }\n"
+    "      ]\n"
+    "    },\n"
+    "    {\n"
+    "      \"name\": \"pgo-use\",\n"
+    "      \"steps\": [\n"
+    "        {\n"
+    "          \"type\": \"configure\",\n"
+    "          \"name\": \"pgo-use\"\n"
+    "        },\n"
+    "        {\n"
+    "          \"type\": \"build\",\n"
+    "          \"name\": \"pgo-use\"\n"
+    "        }\n"
+    "      ]\n"
+    "    }\n"
+    "  ]\n"
+    "}\n">;
+
+std::string c_driver_for(std::string cxx)
+{
+  if(const auto at = cxx.find("clang++"); at != std::string::npos) {
+    return cxx.replace(at, 7, "clang");
+  }
+
+  if(const auto at = cxx.find("g++"); at != std::string::npos) {
+    return cxx.replace(at, 3, "gcc");
+  }
+
+  return cxx;
+}
+
+constexpr auto segment_count =
+    static_cast<std::size_t>(ConfigSegment::Count);
+
+struct SegmentContext
+{
+  SegmentContext(
+      const ProjectSpec &project, const std::vector<std::string> &pch_headers,
+      bool pgo_module = false
+  )
+      : spec(project),
+        prefix(CMakeBase::option_prefix(project.name)),
+        has_pch(project.perf.pch && !pch_headers.empty()),
+        has_pgo_module(pgo_module)
+  {
+    if(has_pch) {
+      for(const auto &header : pch_headers) {
+        PchHeader::append_to(headers, header);
+      }
+    }
+  }
+
+  const ProjectSpec &spec;
+  std::string        prefix;
+  std::string        headers;
+  bool               has_pch        = false;
+  bool               has_pgo_module = false;
+};
+
+// Returns the segment size when output is null, renders into it otherwise.
+template<typename Config, typename Output, typename... Args>
+std::size_t emit_template(Output *output, const Args &...args)
+{
+  if(output == nullptr) {
+    return Config::size(args...);
+  }
+
+  if constexpr(std::is_same_v<Output, std::string>) {
+    Config::append_to(*output, args...);
+  } else {
+    Config::write_to(*output, args...);
+  }
+  return 0;
+}
+
+template<typename Output>
+std::size_t emit_qt(Output *config, const std::string &name)
+{
+  std::size_t size = emit_template<QtFind>(config);
+  size += emit_template<QtLink>(config, name);
+  return size;
+}
+
+template<typename Output>
+std::size_t emit_gtest(Output *config, const std::string &name)
+{
+  std::size_t size = emit_template<GTestProvide>(config);
+  size += emit_template<GTestTarget>(config, name);
+  size += emit_template<GTestDiscover>(config, name);
+  return size;
+}
+
+template<typename Output>
+std::size_t emit_benchmark(
+    Output *config, const std::string &name, const std::string &prefix
+)
+{
+  std::size_t size = emit_template<BenchmarkFetch>(config);
+  size += emit_template<BenchmarkTarget>(config, name);
+  size += emit_template<BenchmarkRun>(config, name, prefix);
+  return size;
+}
+
+template<typename Output>
+std::size_t emit_segment(
+    ConfigSegment segment, const SegmentContext &context, Output *config
+)
+{
+  const ProjectSpec &spec      = context.spec;
+  const Toolchain   &toolchain = spec.toolchain;
+  const std::string &prefix    = context.prefix;
+
+  switch(segment) {
+  case ConfigSegment::Project:
+    return emit_template<ProjectConfig>(config, spec.name, spec.standard);
+  case ConfigSegment::Launcher:
+    return toolchain.launcher.empty() ? 0
+                                      : emit_template<LauncherConfig>(
+                                            config, prefix, toolchain.launcher
+                                        );
+  case ConfigSegment::Linker:
+    return toolchain.linker.empty()
+               ? 0
+               : emit_template<LinkerConfig>(config, prefix, toolchain.linker);
+  case ConfigSegment::Target:
+    return spec.modules ? emit_template<ModulesTargetConfig>(
+                              config, spec.name, prefix, prefix
+                          )
+                        : emit_template<TargetConfig>(config, spec.name);
+  case ConfigSegment::Flags:
+    return spec.has_flags
+               ? emit_template<FlagsConfig>(config, spec.name, "PRIVATE")
+               : 0;
+  case ConfigSegment::Ipo:
+    return spec.perf.ipo ? emit_template<IpoConfig>(config, spec.name, prefix)
+                         : 0;
+  case ConfigSegment::Unity:
+    return spec.perf.unity
+               ? emit_template<UnityConfig>(config, spec.name, prefix)
+               : 0;
+  case ConfigSegment::Pch:
+    return context.has_pch ? emit_template<PchConfig>(
+                                 config, spec.name, prefix, context.headers
+                             )
+                           : 0;
+  case ConfigSegment::Qt:
+    return spec.has_library("qt") ? emit_qt(config, spec.name) : 0;
+  case ConfigSegment::GTest:
+    return spec.has_library("gtest") ? emit_gtest(config, spec.name) : 0;
+  case ConfigSegment::Benchmark:
+    return spec.has_library("benchmark")
+               ? emit_benchmark(config, spec.name, prefix)
+               : 0;
+  case ConfigSegment::PgoInclude:
+    return context.has_pgo_module ? emit_template<PgoInclude>(config) : 0;
+  default:
+    return 0;
+  }
+}
+
+std::size_t config_size(const SegmentContext &context)
+{
+  std::size_t size = 0;
+  for(std::size_t segment = 0; segment < segment_count; ++segment) {
+    size += emit_segment<std::string>(
+        static_cast<ConfigSegment>(segment), context, nullptr
+    );
+  }
+  return size;
+}
+
+// The root of a workspace configures the toolchain, the options any component
+// uses and every dependency once, then adds each project as a component.
+template<typename Output>
+std::size_t emit_workspace(
+    const SegmentContext &context, const std::vector<ProjectSpec> &projects,
+    Output *config
+)
+{
+  const ProjectSpec &workspace = context.spec;
+  const std::string &prefix    = context.prefix;
+
+  std::size_t        size      = 0;
+  for(const auto segment :
+      {ConfigSegment::Project, ConfigSegment::Launcher,
+       ConfigSegment::Linker}) {
+    size += emit_segment(segment, context, config);
+  }
+
+  size += emit_template<WorkspaceOptions>(config, workspace.name);
+  if(workspace.perf.ipo) {
+    size += emit_template<WorkspaceIpo>(config, prefix);
+  }
+  if(workspace.perf.unity) {
+    size += emit_template<WorkspaceUnity>(config, prefix);
+  }
+  if(context.has_pch) {
+    size += emit_template<WorkspacePch>(
+        config, workspace.name, prefix, context.headers
+    );
+  }
+  if(workspace.has_library("qt")) {
+    size += emit_template<QtFind>(config);
+  }
+  if(workspace.has_library("gtest")) {
+    size += emit_template<GTestProvide>(config);
+    size += emit_template<WorkspaceGoogleTest>(config);
+  }
+  if(workspace.has_library("benchmark")) {
+    size += emit_template<BenchmarkFetch>(config);
+  }
+
+  size += emit_template<WorkspaceComponents>(config);
+  for(const auto &project : projects) {
+    size += emit_template<WorkspaceComponent>(config, project.name);
+  }
+  return size;
+}
+
+// A component opts into the workspace options its own spec enables.
+template<typename Output>
+std::size_t emit_component(
+    const ProjectSpec &spec, const SegmentContext &workspace, Output *config
+)
+{
+  const std::string &name           = spec.name;
+  const std::string &workspace_name = workspace.spec.name;
+
+  std::size_t size = emit_template<ComponentHeader>(config, workspace_name);
+  if(spec.modules) {
+    size += emit_template<ModulesTargetConfig>(
+        config, name, workspace.prefix, CMakeBase::option_prefix(name)
+    );
+  } else {
+    size += emit_template<TargetConfig>(config, name);
+  }
+  size += emit_template<ComponentOptions>(config, name, workspace_name);
+  if(spec.has_flags) {
+    size += emit_template<FlagsConfig>(config, name, "PRIVATE");
+  }
+  if(spec.perf.ipo) {
+    size += emit_template<ComponentIpo>(config, name, workspace.prefix);
+  }
+  if(spec.perf.unity) {
+    size += emit_template<ComponentUnity>(config, name, workspace.prefix);
+  }
+  if(spec.perf.pch && workspace.has_pch) {
+    size += emit_template<ComponentPch>(
+        config, name, workspace_name, workspace.prefix
+    );
+  }
+  if(spec.has_library("qt")) {
+    size += emit_template<QtLink>(config, name);
+  }
+  if(spec.has_library("gtest")) {
+    size += emit_template<GTestTarget>(config, name);
+    size += emit_template<ComponentDiscover>(config, name);
+  }
+  if(spec.has_library("benchmark")) {
+    size += emit_template<BenchmarkTarget>(config, name);
+  }
+  return size;
+}
+
+// The nexpp options that regenerate spec as it is, apart from its name,
+// destination and --modules.
+std::string generation_options(const ProjectSpec &spec)
+{
+  std::string options = " -s ";
+  options += to_string_view(spec.standard);
+
+  for(std::size_t i = 0; i < spec.libraries.size(); ++i) {
+    options += i == 0 ? " -l " : ",";
+    options += spec.libraries[i];
+  }
+
+  if(spec.has_flags) {
+    options += " -f";
+  }
+
+  const std::pair<bool, std::string_view> perf[] = {
+      {spec.perf.ipo, "lto"}, {spec.perf.unity, "unity"}, {spec.perf.pch, "pch"}
+  };
+  std::string_view separator = " --perf ";
+  for(const auto &[enabled, option] : perf) {
+    if(enabled) {
+      options += separator;
+      options += option;
+      separator = ",";
+    }
+  }
+
+  options += " --compiler ";
+  options += spec.compiler == CompilerFamily::Clang ? "clang" : "gcc";
+  if(spec.toolchain == Toolchain {}) {
+    options += " --no-probe";
+  }
+  return options;
+}
+} // namespace
+
 std::string CMakeBase::setup_config(
     const std::string &project_name, Standard cpp_standard, bool has_flags
 ) const
 {
-  QString base_config = QString(
-                            "cmake_minimum_required(VERSION 3.28)\n"
-                            "project(%1)\n"
-                            "\n"
-                            "set(CMAKE_CXX_STANDARD %2)\n"
-                            "\n"
-                            "add_executable(\n"
-                            "  %1\n"
-                            "  src/main.cpp\n"
-                            ")\n"
-                            "\n"
-                            "target_include_directories(\n"
-                            "  %1\n"
-                            "  PRIVATE\n"
-                            "  ${CMAKE_CURRENT_SOURCE_DIR}/include\n"
-                            ")\n"
-  )
-                            .arg(project_name)
-                            .arg(to_string(cpp_standard));
-
-  if(has_flags) {
-    base_config.append(QString(
-                           "\n"
-                           "target_compile_options(\n"
-                           "  %1\n"
-                           "  PRIVATE\n"
-                           "  -Wall\n"
-                           "  -Wextra\n"
-                           "  -Wpedantic\n"
-                           "  -Werror\n"
-                           "  -Wshadow\n"
-                           "  -Wnon-virtual-dtor\n"
-                           "  -Wold-style-cast\n"
-                           "  -Wcast-align\n"
-                           "  -Wunused\n"
-                           "  -Wconversion\n"
-                           "  -Wsign-conversion\n"
-                           "  -Wnull-dereference\n"
-                           "  -Wdouble-promotion\n"
-                           "  -Wimplicit-falltrough\n"
-                           ")\n"
-    )
-                           .arg(project_name));
-  }
-
-  return base_config.toStdString();
+  ProjectSpec spec;
+  spec.name      = project_name;
+  spec.standard  = cpp_standard;
+  spec.has_flags = has_flags;
+  return setup_config(spec);
+}
+
+std::string CMakeBase::setup_config(
+    const ProjectSpec              &spec,
+    const std::vector<std::string> &precompiled_headers, bool pgo_module
+) const
+{
+  NEXPP_TRACE_SCOPE("CMakeBase::setup_config", spec.name);
+
+  const SegmentContext context(spec, precompiled_headers, pgo_module);
+
+  std::string          config;
+  config.reserve(config_size(context));
+  for(std::size_t segment = 0; segment < segment_count; ++segment) {
+    emit_segment(static_cast<ConfigSegment>(segment), context, &config);
+  }
+
+  return config;
+}
+
+void CMakeBase::write_config(
+    OutputSink &sink, const ProjectSpec &spec,
+    const std::vector<std::string> &precompiled_headers, bool pgo_module
+) const
+{
+  NEXPP_TRACE_SCOPE("CMakeBase::write_config", spec.name);
+
+  const SegmentContext context(spec, precompiled_headers, pgo_module);
+
+  sink.reserve(config_size(context));
+  for(std::size_t segment = 0; segment < segment_count; ++segment) {
+    emit_segment(static_cast<ConfigSegment>(segment), context, &sink);
+  }
+}
+
+std::string CMakeBase::setup_segment(
+    ConfigSegment segment, const ProjectSpec &spec,
+    const std::vector<std::string> &precompiled_headers, bool pgo_module
+) const
+{
+  const SegmentContext context(spec, precompiled_headers, pgo_module);
+
+  std::string          text;
+  text.reserve(emit_segment<std::string>(segment, context, nullptr));
+  emit_segment(segment, context, &text);
+  return text;
+}
+
+std::string CMakeBase::setup_pgo_module(const ProjectSpec &spec) const
+{
+  std::string module;
+  StringSink  sink(module);
+  write_pgo_module(sink, spec);
+  return module;
+}
+
+std::string CMakeBase::setup_dependencies_module() const
+{
+  std::string module;
+  StringSink  sink(module);
+  write_dependencies_module(sink);
+  return module;
+}
+
+std::string CMakeBase::setup_presets(const ProjectSpec &spec) const
+{
+  std::string presets;
+  StringSink  sink(presets);
+  write_presets(sink, spec);
+  return presets;
+}
+
+void CMakeBase::write_pgo_module(
+    OutputSink &sink, const ProjectSpec &spec
+) const
+{
+  NEXPP_TRACE_SCOPE("CMakeBase::write_pgo_module", spec.name);
+
+  const std::string prefix = option_prefix(spec.name);
+  sink.reserve(PgoModule::size(spec.name, prefix));
+  PgoModule::write_to(sink, spec.name, prefix);
+}
+
+void CMakeBase::write_dependencies_module(OutputSink &sink) const
+{
+  NEXPP_TRACE_SCOPE("CMakeBase::write_dependencies_module");
+
+  static const std::string directory = googletest_dependency.directory_name();
+  sink.reserve(DependenciesModule::size(
+      directory, googletest_dependency.url, googletest_dependency.sha256
+  ));
+  DependenciesModule::write_to(
+      sink, directory, googletest_dependency.url, googletest_dependency.sha256
+  );
+}
+
+void CMakeBase::write_presets(OutputSink &sink, const ProjectSpec &spec) const
+{
+  NEXPP_TRACE_SCOPE("CMakeBase::write_presets", spec.name);
+
+  const std::string cxx    = spec.toolchain.compiler.empty()
+                                 ? std::string(cxx_compiler(spec.compiler))
+                                 : spec.toolchain.compiler;
+  const std::string c      = c_driver_for(cxx);
+  const std::string prefix = option_prefix(spec.name);
+
+  sink.reserve(Presets::size(c, cxx, prefix));
+  Presets::write_to(sink, c, cxx, prefix);
+}
+
+std::string CMakeBase::setup_layout_comparison(const ProjectSpec &spec) const
+{
+  std::string script;
+  StringSink  sink(script);
+  write_layout_comparison(sink, spec);
+  return script;
+}
+
+std::string CMakeBase::setup_workspace_config(
+    const ProjectSpec &workspace, const std::vector<ProjectSpec> &projects,
+    const std::vector<std::string> &precompiled_headers
+) const
+{
+  std::string config;
+  StringSink  sink(config);
+  write_workspace_config(sink, workspace, projects, precompiled_headers);
+  return config;
+}
+
+std::string CMakeBase::setup_component_config(
+    const ProjectSpec &spec, const ProjectSpec &workspace,
+    const std::vector<std::string> &precompiled_headers
+) const
+{
+  std::string config;
+  StringSink  sink(config);
+  write_component_config(sink, spec, workspace, precompiled_headers);
+  return config;
+}
+
+void CMakeBase::write_layout_comparison(
+    OutputSink &sink, const ProjectSpec &spec
+) const
+{
+  NEXPP_TRACE_SCOPE("CMakeBase::write_layout_comparison", spec.name);
+
+  const std::string options = generation_options(spec);
+
+  sink.reserve(LayoutComparison::size(spec.name, options));
+  LayoutComparison::write_to(sink, spec.name, options);
+}
+
+void CMakeBase::write_workspace_config(
+    OutputSink &sink, const ProjectSpec &workspace,
+    const std::vector<ProjectSpec> &projects,
+    const std::vector<std::string> &precompiled_headers
+) const
+{
+  NEXPP_TRACE_SCOPE("CMakeBase::write_workspace_config", workspace.name);
+
+  const SegmentContext context(workspace, precompiled_headers);
+
+  sink.reserve(emit_workspace<std::string>(context, projects, nullptr));
+  emit_workspace(context, projects, &sink);
+}
+
+void CMakeBase::write_component_config(
+    OutputSink &sink, const ProjectSpec &spec, const ProjectSpec &workspace,
+    const std::vector<std::string> &precompiled_headers
+) const
+{
+  NEXPP_TRACE_SCOPE("CMakeBase::write_component_config", spec.name);
+
+  const SegmentContext context(workspace, precompiled_headers);
+
+  sink.reserve(emit_component<std::string>(spec, context, nullptr));
+  emit_component(spec, context, &sink);
+}
+
+std::string CMakeBase::option_prefix(const std::string &project_name)
+{
+  std::string prefix;
+  prefix.reserve(project_name.size());
+
+  for(const char character : project_name) {
+    const auto byte = static_cast<unsigned char>(character);
+    prefix += std::isalnum(byte) ? static_cast<char>(std::toupper(byte)) : '_';
+  }
+
+  return prefix;
+}
+
+SpecFields CMakeBase::segment_dependencies(ConfigSegment segment) noexcept
+{
+  switch(segment) {
+  case ConfigSegment::Project:
+    return SpecField::Name | SpecField::Standard;
+  case ConfigSegment::Launcher:
+  case ConfigSegment::Linker:
+    return SpecField::Name | SpecField::Toolchain;
+  case ConfigSegment::Target:
+    return SpecField::Name | SpecField::Modules;
+  case ConfigSegment::Flags:
+    return SpecField::Name | SpecField::Flags;
+  case ConfigSegment::Ipo:
+  case ConfigSegment::Unity:
+    return SpecField::Name | SpecField::Perf;
+  case ConfigSegment::Pch:
+    // The precompiled headers are the ones main.cpp includes.
+    return SpecField::Name | SpecField::Perf | SpecField::Modules;
+  case ConfigSegment::Qt:
+  case ConfigSegment::GTest:
+  case ConfigSegment::Benchmark:
+    return SpecField::Name | SpecField::Libraries;
+  default:
+    return 0;
+  }
 }
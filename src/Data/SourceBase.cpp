@@ -0,0 +1,243 @@
+#include "Nexpp/Data/SourceBase.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "Nexpp/Data/CMakeBase.h"
+#include "Nexpp/Template/Template.h"
+
+namespace {
+using MainSource = Template<
+    "#include <iostream>\n"
+    "\n"
+    "int main()\n"
+    "{\n"
+    "  std::cout << \"Hello from %1!\" << std::endl;\n"
+    "  return 0;\n"
+    "}\n">;
+
+using ModuleMainSource = Template<
+    "import %1;\n"
+    "\n"
+    "int main()\n"
+    "{\n"
+    "  %1::greet();\n"
+    "  return 0;\n"
+    "}\n">;
+
+using ModuleInterfaceSource = Template<
+    "export module %1;\n"
+    "\n"
+    "export import :greeting;\n">;
+
+using ModulePartitionSource = Template<
+    "module;\n"
+    "\n"
+    "#ifndef %3_IMPORT_STD\n"
+    "#include <iostream>\n"
+    "#endif\n"
+    "\n"
+    "export module %2:greeting;\n"
+    "\n"
+    "#ifdef %3_IMPORT_STD\n"
+    "import std;\n"
+    "#endif\n"
+    "\n"
+    "export namespace %2 {\n"
+    "void greet()\n"
+    "{\n"
+    "  std::cout << \"Hello from %1!\" << std::endl;\n"
+    "}\n"
+    "} // namespace %2\n">;
+
+using BenchmarkSource = Template<
+    "#include <benchmark/benchmark.h>\n"
+    "\n"
+    "#include <cstddef>\n"
+    "#include <cstdint>\n"
+    "#include <numeric>\n"
+    "#include <vector>\n"
+    "\n"
+    "namespace {\n"
+    "class SampleFixture : public benchmark::Fixture\n"
+    "{\n"
+    "public:\n"
+    "  void SetUp(benchmark::State &state) override\n"
+    "  {\n"
+    "    values.assign(static_cast<std::size_t>(state.range(0)), 1);\n"
+    "  }\n"
+    "\n"
+    "  void TearDown(benchmark::State &) override\n"
+    "  {\n"
+    "    values.clear();\n"
+    "  }\n"
+    "\n"
+    "  std::vector<std::int64_t> values;\n"
+    "};\n"
+    "} // namespace\n"
+    "\n"
+    "BENCHMARK_DEFINE_F(SampleFixture, Accumulate)(benchmark::State &state)\n"
+    "{\n"
+    "  for(auto _ : state) {\n"
+    "    benchmark::DoNotOptimize(\n"
+    "        std::accumulate(values.begin(), values.end(), std::int64_t {0})\n"
+    "    );\n"
+    "  }\n"
+    "  state.SetItemsProcessed(state.iterations() * state.range(0));\n"
+    "}\n"
+    "\n"
+    "BENCHMARK_REGISTER_F(SampleFixture, Accumulate)->Range(8, 8 << 10);\n">;
+
+using TestSource = Template<
+    "#include <gtest/gtest.h>\n"
+    "\n"
+    "#include <numeric>\n"
+    "#include <vector>\n"
+    "\n"
+    "TEST(SampleTest, AccumulatesValues)\n"
+    "{\n"
+    "  const std::vector<int> values = {1, 2, 3, 4};\n"
+    "  EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 10);\n"
+    "}\n">;
+
+using PchSource = Template<
+    "// Compiled once with the precompiled headers that every workspace\n"
+    "// component reuses.\n">;
+} // namespace
+
+std::string SourceBase::setup_main(const std::string &project_name) const
+{
+  return MainSource::render(project_name);
+}
+
+std::string SourceBase::setup_module_main(const std::string &project_name) const
+{
+  return ModuleMainSource::render(module_name(project_name));
+}
+
+std::string
+    SourceBase::setup_module_interface(const std::string &project_name) const
+{
+  return ModuleInterfaceSource::render(module_name(project_name));
+}
+
+std::string
+    SourceBase::setup_module_partition(const std::string &project_name) const
+{
+  return ModulePartitionSource::render(
+      project_name, module_name(project_name),
+      CMakeBase::option_prefix(project_name)
+  );
+}
+
+std::string SourceBase::setup_benchmark() const
+{
+  return BenchmarkSource::render();
+}
+
+std::string SourceBase::setup_test() const
+{
+  return TestSource::render();
+}
+
+std::string SourceBase::setup_pch_source() const
+{
+  return PchSource::render();
+}
+
+void SourceBase::write_main(
+    OutputSink &sink, const std::string &project_name
+) const
+{
+  sink.reserve(MainSource::size(project_name));
+  MainSource::write_to(sink, project_name);
+}
+
+void SourceBase::write_module_main(
+    OutputSink &sink, const std::string &project_name
+) const
+{
+  const std::string module = module_name(project_name);
+  sink.reserve(ModuleMainSource::size(module));
+  ModuleMainSource::write_to(sink, module);
+}
+
+void SourceBase::write_module_interface(
+    OutputSink &sink, const std::string &project_name
+) const
+{
+  const std::string module = module_name(project_name);
+  sink.reserve(ModuleInterfaceSource::size(module));
+  ModuleInterfaceSource::write_to(sink, module);
+}
+
+void SourceBase::write_module_partition(
+    OutputSink &sink, const std::string &project_name
+) const
+{
+  const std::string module = module_name(project_name);
+  const std::string prefix = CMakeBase::option_prefix(project_name);
+  sink.reserve(ModulePartitionSource::size(project_name, module, prefix));
+  ModulePartitionSource::write_to(sink, project_name, module, prefix);
+}
+
+void SourceBase::write_benchmark(OutputSink &sink) const
+{
+  sink.reserve(BenchmarkSource::size());
+  BenchmarkSource::write_to(sink);
+}
+
+void SourceBase::write_test(OutputSink &sink) const
+{
+  sink.reserve(TestSource::size());
+  TestSource::write_to(sink);
+}
+
+void SourceBase::write_pch_source(OutputSink &sink) const
+{
+  sink.reserve(PchSource::size());
+  PchSource::write_to(sink);
+}
+
+std::vector<std::string>
+    SourceBase::standard_headers(std::string_view source)
+{
+  static constexpr std::string_view directive = "#include <";
+
+  std::vector<std::string>          headers;
+  for(std::size_t position = source.find(directive);
+      position != std::string_view::npos;
+      position = source.find(directive, position + 1)) {
+    const std::size_t begin = position + directive.size();
+    const std::size_t end   = source.find('>', begin);
+    if(end == std::string_view::npos) {
+      break;
+    }
+
+    const std::string_view header = source.substr(begin, end - begin);
+    if(!header.empty() &&
+       std::all_of(header.begin(), header.end(), [](char character) {
+         return (character >= 'a' && character <= 'z') || character == '_';
+       })) {
+      headers.emplace_back(header);
+    }
+  }
+
+  return headers;
+}
+
+std::string SourceBase::module_name(std::string_view project_name)
+{
+  std::string module;
+  module.reserve(project_name.size() + 1);
+
+  for(const char character : project_name) {
+    const auto byte = static_cast<unsigned char>(character);
+    if(module.empty() && std::isdigit(byte)) {
+      module += '_';
+    }
+    module += std::isalnum(byte) ? static_cast<char>(std::tolower(byte)) : '_';
+  }
+
+  return module;
+}
@@ -0,0 +1,187 @@
+#include "Nexpp/Dependencies/DependencyStore.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <spawn.h>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "Nexpp/FileSystem/FileDescriptor.h"
+#include "Nexpp/Toolchain/ToolchainProbe.h"
+
+extern char **environ;
+
+namespace {
+int run_program(std::vector<std::string> arguments)
+{
+  std::vector<char *> argv;
+  for(auto &argument : arguments) {
+    argv.push_back(argument.data());
+  }
+  argv.push_back(nullptr);
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(
+      &actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0
+  );
+
+  pid_t     pid     = 0;
+  const int spawned = posix_spawn(
+      &pid, argv.front(), &actions, nullptr, argv.data(), environ
+  );
+  posix_spawn_file_actions_destroy(&actions);
+  if(spawned != 0) {
+    return -1;
+  }
+
+  int status = 0;
+  while(::waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+  }
+
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+// Takes the lock that generated projects hold through CMake's file(LOCK) while
+// they download and build a dependency in the store. It is released when the
+// returned descriptor is closed.
+FileDescriptor lock_package(const std::filesystem::path &lock_path)
+{
+  std::filesystem::create_directories(lock_path.parent_path());
+
+  FileDescriptor lock(
+      ::open(lock_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644)
+  );
+  if(!lock.is_valid()) {
+    throw std::system_error(
+        errno, std::generic_category(), "Cannot open " + lock_path.string()
+    );
+  }
+
+  struct flock region {};
+  region.l_type   = F_WRLCK;
+  region.l_whence = SEEK_SET;
+  while(::fcntl(lock.get(), F_SETLKW, &region) != 0) {
+    if(errno != EINTR) {
+      throw std::system_error(
+          errno, std::generic_category(), "Cannot lock " + lock_path.string()
+      );
+    }
+  }
+
+  return lock;
+}
+
+std::filesystem::path find_source_root(const std::filesystem::path &staging)
+{
+  if(std::filesystem::exists(staging / "CMakeLists.txt")) {
+    return staging;
+  }
+
+  std::vector<std::filesystem::path> entries;
+  for(const auto &entry : std::filesystem::directory_iterator(staging)) {
+    entries.push_back(entry.path());
+  }
+
+  if(entries.size() != 1 || !std::filesystem::is_directory(entries.front()) ||
+     !std::filesystem::exists(entries.front() / "CMakeLists.txt")) {
+    throw std::runtime_error(
+        "Dependency archive does not contain a CMake project"
+    );
+  }
+
+  return entries.front();
+}
+} // namespace
+
+DependencyStore::DependencyStore(std::filesystem::path root)
+    : m_root(std::move(root))
+{
+}
+
+const std::filesystem::path &DependencyStore::root() const
+{
+  return m_root;
+}
+
+std::filesystem::path
+    DependencyStore::source_dir(const Dependency &dependency) const
+{
+  return m_root / "sources" / dependency.directory_name();
+}
+
+bool DependencyStore::has_source(const Dependency &dependency) const
+{
+  return std::filesystem::exists(source_dir(dependency) / "CMakeLists.txt");
+}
+
+std::filesystem::path DependencyStore::import_source(
+    const Dependency &dependency, const std::filesystem::path &archive
+) const
+{
+  if(!std::filesystem::is_regular_file(archive)) {
+    throw std::runtime_error(
+        "Cannot open dependency archive: " + archive.string()
+    );
+  }
+
+  const auto cmake = ToolchainProbe::find_program("cmake");
+  if(!cmake) {
+    throw std::runtime_error("cmake is required to import dependencies");
+  }
+
+  const std::filesystem::path staging =
+      m_root / "sources" / (".import-" + std::to_string(::getpid()));
+  std::filesystem::remove_all(staging);
+  std::filesystem::create_directories(staging);
+
+  try {
+    const int status = run_program(
+        {cmake->string(), "-E", "chdir", staging.string(), cmake->string(),
+         "-E", "tar", "xf", std::filesystem::absolute(archive).string()}
+    );
+    if(status != 0) {
+      throw std::runtime_error(
+          "Cannot extract dependency archive: " + archive.string()
+      );
+    }
+
+    const std::filesystem::path target = source_dir(dependency);
+    const FileDescriptor        lock   = lock_package(
+        m_root / "packages" / (dependency.directory_name() + ".lock")
+    );
+    std::filesystem::remove_all(target);
+    std::filesystem::rename(find_source_root(staging), target);
+    std::filesystem::remove_all(staging);
+    return target;
+  } catch(...) {
+    std::filesystem::remove_all(staging);
+    throw;
+  }
+}
+
+std::filesystem::path DependencyStore::default_root()
+{
+  if(const char *store = std::getenv("NEXPP_DEPS_STORE");
+     store != nullptr && *store != '\0') {
+    return store;
+  }
+
+  if(const char *data_home = std::getenv("XDG_DATA_HOME");
+     data_home != nullptr && *data_home != '\0') {
+    return std::filesystem::path(data_home) / "nexpp" / "deps";
+  }
+
+  if(const char *home = std::getenv("HOME"); home != nullptr && *home != '\0') {
+    return std::filesystem::path(home) / ".local" / "share" / "nexpp" /
+           "deps";
+  }
+
+  return std::filesystem::temp_directory_path() /
+         ("nexpp-" + std::to_string(::getuid())) / "deps";
+}
@@ -0,0 +1,158 @@
+#include "Nexpp/FileSystem/FileCloner.h"
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <string>
+#include <string_view>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+#include "Nexpp/FileSystem/FileDescriptor.h"
+#include "Nexpp/Stats/RunStats.h"
+#include "Nexpp/Trace/Trace.h"
+
+namespace {
+constexpr std::size_t copy_buffer_size = 16 * 1024;
+
+[[noreturn]] void throw_errno(const std::string &action, std::string_view path)
+{
+  throw std::system_error(
+      errno, std::generic_category(), action + " " + std::string(path)
+  );
+}
+
+bool is_unsupported(int error)
+{
+  return error == EXDEV || error == ENOSYS || error == EOPNOTSUPP ||
+         error == EINVAL;
+}
+
+// Returns false when the kernel cannot copy between these files at all.
+bool copy_range(
+    int source_fd, int target_fd, std::uint64_t size, const char *source
+)
+{
+  std::uint64_t copied = 0;
+  while(copied < size) {
+    RunStats::add(StatCounter::Syscalls);
+    const ssize_t result = ::copy_file_range(
+        source_fd, nullptr, target_fd, nullptr, size - copied, 0
+    );
+    if(result < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      if(copied == 0 && is_unsupported(errno)) {
+        return false;
+      }
+      throw_errno("Cannot copy", source);
+    }
+    if(result == 0) {
+      break;
+    }
+    copied += static_cast<std::uint64_t>(result);
+  }
+  return true;
+}
+
+void copy_buffered(int source_fd, int target_fd, const char *source)
+{
+  std::array<char, copy_buffer_size> buffer;
+
+  for(;;) {
+    RunStats::add(StatCounter::Syscalls);
+    const ssize_t count = ::read(source_fd, buffer.data(), buffer.size());
+    if(count < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      throw_errno("Cannot read", source);
+    }
+    if(count == 0) {
+      return;
+    }
+
+    std::string_view pending(buffer.data(), static_cast<std::size_t>(count));
+    while(!pending.empty()) {
+      RunStats::add(StatCounter::Syscalls);
+      const ssize_t written =
+          ::write(target_fd, pending.data(), pending.size());
+      if(written < 0) {
+        if(errno == EINTR) {
+          continue;
+        }
+        throw_errno("Cannot copy", source);
+      }
+      pending.remove_prefix(static_cast<std::size_t>(written));
+    }
+  }
+}
+} // namespace
+
+CloneMethod FileCloner::clone(
+    const char *source, int directory_fd, const char *target, bool sync
+)
+{
+  NEXPP_TRACE_SCOPE("FileCloner::clone", target);
+
+  FileDescriptor from(::open(source, O_RDONLY | O_CLOEXEC));
+  if(!from.is_valid()) {
+    throw_errno("Cannot open clone source", source);
+  }
+
+  struct stat status {};
+  if(::fstat(from.get(), &status) != 0) {
+    throw_errno("Cannot stat clone source", source);
+  }
+
+  FileDescriptor to(::openat(
+      directory_fd, target,
+      O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW | O_CLOEXEC, 0644
+  ));
+  if(!to.is_valid()) {
+    throw_errno("Cannot create file", target);
+  }
+
+  CloneMethod         method = CloneMethod::Reflink;
+  const std::uint64_t size   = static_cast<std::uint64_t>(status.st_size);
+  if(::ioctl(to.get(), FICLONE, from.get()) != 0) {
+    method = CloneMethod::CopyRange;
+    if(!copy_range(from.get(), to.get(), size, source)) {
+      method = CloneMethod::Copy;
+      copy_buffered(from.get(), to.get(), source);
+    }
+    RunStats::add(StatCounter::BytesWritten, size);
+  }
+
+  if(sync && ::fsync(to.get()) != 0) {
+    throw_errno("Cannot sync file", target);
+  }
+
+  if(::close(to.release()) != 0) {
+    throw_errno("Cannot close file", target);
+  }
+
+  RunStats::add(StatCounter::Files);
+  RunStats::add(StatCounter::ClonedFiles);
+  RunStats::add(StatCounter::Syscalls, 6 + (sync ? 1 : 0));
+  return method;
+}
+
+bool FileCloner::supports_reflink(const char *directory)
+{
+  NEXPP_TRACE_SCOPE("FileCloner::supports_reflink", directory);
+
+  const int      flags = O_TMPFILE | O_RDWR | O_CLOEXEC;
+  FileDescriptor source(::open(directory, flags, 0600));
+  FileDescriptor target(::open(directory, flags, 0600));
+  if(!source.is_valid() || !target.is_valid() ||
+     ::write(source.get(), "x", 1) != 1) {
+    return false;
+  }
+  return ::ioctl(target.get(), FICLONE, source.get()) == 0;
+}
@@ -0,0 +1,80 @@
+#include "Nexpp/FileSystem/FileSink.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+
+namespace {
+[[noreturn]] void
+    throw_errno(const std::string &action, const std::filesystem::path &path)
+{
+  throw std::system_error(
+      errno, std::generic_category(), action + " " + path.string()
+  );
+}
+} // namespace
+
+FileSink::FileSink(const std::filesystem::path &path, Mode mode)
+    : m_path(path),
+      m_file(::open(
+          path.c_str(),
+          O_WRONLY | O_CREAT | O_CLOEXEC |
+              (mode == Mode::Append ? O_APPEND : O_TRUNC),
+          0644
+      ))
+{
+  if(!m_file.is_valid()) {
+    throw_errno("Cannot open file", m_path);
+  }
+}
+
+void FileSink::write(std::string_view data)
+{
+  if(data.size() > buffer_size - m_buffered) {
+    flush();
+  }
+
+  if(data.size() >= buffer_size) {
+    write_through(data);
+    return;
+  }
+
+  std::memcpy(m_buffer.data() + m_buffered, data.data(), data.size());
+  m_buffered += data.size();
+}
+
+void FileSink::close(bool sync)
+{
+  flush();
+
+  if(sync && ::fsync(m_file.get()) != 0) {
+    throw_errno("Cannot sync file", m_path);
+  }
+
+  if(::close(m_file.release()) != 0) {
+    throw_errno("Cannot close file", m_path);
+  }
+}
+
+void FileSink::flush()
+{
+  write_through(std::string_view(m_buffer.data(), m_buffered));
+  m_buffered = 0;
+}
+
+void FileSink::write_through(std::string_view data)
+{
+  while(!data.empty()) {
+    const ssize_t written = ::write(m_file.get(), data.data(), data.size());
+    if(written < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      throw_errno("Cannot write file", m_path);
+    }
+    data.remove_prefix(static_cast<std::size_t>(written));
+  }
+}
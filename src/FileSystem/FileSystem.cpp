@@ -2,38 +2,78 @@
 
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <stdexcept>
 
-void FileSystem::create_folder(
+#include "Nexpp/FileSystem/FileSink.h"
+#include "Nexpp/Trace/Trace.h"
+
+void DiskFileSystem::create_folder(
     std::filesystem::path path, std::string folder_name
 )
 {
   std::filesystem::create_directory(path / folder_name);
 }
 
-void FileSystem::create_file(std::filesystem::path path, std::string filename)
+void DiskFileSystem::create_file(std::filesystem::path path, std::string filename)
 {
   path /= filename;
   std::ofstream ofs(path);
+  if(!ofs) {
+    throw std::runtime_error("Cannot create file: " + path.string());
+  }
   ofs.close();
 }
 
-void FileSystem::put_in_file(std::filesystem::path path, std::string content)
+void DiskFileSystem::put_in_file(
+    std::filesystem::path path, std::string_view content
+)
 {
-  std::ofstream ofs(path);
-  ofs << content;
-  ofs.close();
+  NEXPP_TRACE_SCOPE("DiskFileSystem::put_in_file", path.native());
+
+  FileSink file(path);
+  file.write(content);
+  file.close();
 }
 
-void FileSystem::append_in_file(std::filesystem::path path, std::string content)
+void DiskFileSystem::append_in_file(
+    std::filesystem::path path, std::string_view content
+)
 {
-  std::ofstream ofs(path, std::ios::app);
-  ofs << content;
-  ofs.close();
+  FileSink file(path, FileSink::Mode::Append);
+  file.write(content);
+  file.close();
 }
 
-void FileSystem::create_symlink(
+void DiskFileSystem::create_symlink(
     std::filesystem::path origin, std::filesystem::path destination
 )
 {
   std::filesystem::create_symlink(origin, destination);
 }
+
+bool DiskFileSystem::exists(const std::filesystem::path &path) const
+{
+  std::error_code error;
+  return std::filesystem::exists(std::filesystem::symlink_status(path, error));
+}
+
+std::optional<std::string>
+    DiskFileSystem::read_file(const std::filesystem::path &path) const
+{
+  NEXPP_TRACE_SCOPE("DiskFileSystem::read_file", path.native());
+
+  std::error_code error;
+  if(!std::filesystem::is_regular_file(path, error)) {
+    return std::nullopt;
+  }
+
+  std::ifstream ifs(path, std::ios::binary);
+  if(!ifs) {
+    return std::nullopt;
+  }
+
+  return std::string(
+      (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+  );
+}
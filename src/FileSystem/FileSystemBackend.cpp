@@ -0,0 +1,143 @@
+#include "Nexpp/FileSystem/FileSystemBackend.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <string_view>
+#include <system_error>
+#include <unistd.h>
+
+#include "Nexpp/FileSystem/FileCloner.h"
+#include "Nexpp/FileSystem/FileDescriptor.h"
+#include "Nexpp/FileSystem/UringFileSystemBackend.h"
+#include "Nexpp/Stats/RunStats.h"
+#include "Nexpp/Trace/Trace.h"
+
+namespace {
+[[noreturn]] void
+    throw_errno(const std::string &action, const std::filesystem::path &path)
+{
+  throw std::system_error(
+      errno, std::generic_category(), action + " " + path.string()
+  );
+}
+} // namespace
+
+void FileSystemBackend::clone_file(
+    const std::filesystem::path &source, const std::filesystem::path &target,
+    bool sync
+)
+{
+  FileCloner::clone(source.c_str(), AT_FDCWD, target.c_str(), sync);
+}
+
+void FileSystemBackend::create_symlink(
+    const std::filesystem::path &target, const std::filesystem::path &link
+)
+{
+  std::filesystem::create_symlink(target, link);
+}
+
+void FileSystemBackend::write_layout(
+    const std::filesystem::path &root, const LayoutTree &layout, bool sync
+)
+{
+  layout.for_each([&](const auto &path, const LayoutNode &node) {
+    switch(node.kind) {
+    case LayoutKind::Folder:
+      create_folder(root / path);
+      break;
+    case LayoutKind::File:
+      write_file(root / path, node.content, sync);
+      break;
+    case LayoutKind::Symlink:
+      create_symlink(std::filesystem::path(node.content), root / path);
+      break;
+    case LayoutKind::Clone:
+      clone_file(std::filesystem::path(node.content), root / path, sync);
+      break;
+    }
+  });
+}
+
+void SyncFileSystemBackend::create_folder(const std::filesystem::path &path)
+{
+  if(std::filesystem::create_directories(path)) {
+    RunStats::add(StatCounter::Directories);
+  }
+}
+
+void SyncFileSystemBackend::write_file(
+    const std::filesystem::path &path, std::string_view content, bool sync
+)
+{
+  NEXPP_TRACE_SCOPE("SyncFileSystemBackend::write_file", path.native());
+  const LatencyTimer timer(StatLatency::FileWrite);
+
+  FileDescriptor file(
+      ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)
+  );
+  if(!file.is_valid()) {
+    throw_errno("Cannot create file", path);
+  }
+
+  std::uint64_t    syscalls  = 2;
+  std::string_view remaining = content;
+  while(!remaining.empty()) {
+    ++syscalls;
+    const ssize_t written =
+        ::write(file.get(), remaining.data(), remaining.size());
+    if(written < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      throw_errno("Cannot write file", path);
+    }
+    remaining.remove_prefix(static_cast<std::size_t>(written));
+  }
+
+  if(sync && ::fsync(file.get()) != 0) {
+    throw_errno("Cannot sync file", path);
+  }
+
+  if(::close(file.release()) != 0) {
+    throw_errno("Cannot close file", path);
+  }
+
+  RunStats::add(StatCounter::Files);
+  RunStats::add(StatCounter::BytesWritten, content.size());
+  RunStats::add(StatCounter::Syscalls, syscalls + (sync ? 1 : 0));
+}
+
+void SyncFileSystemBackend::write_layout(
+    const std::filesystem::path &root, const LayoutTree &layout, bool sync
+)
+{
+  FileDescriptor directory(
+      ::open(root.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)
+  );
+  if(!directory.is_valid()) {
+    throw_errno("Cannot open directory", root);
+  }
+
+  layout.materialize(directory.get(), sync);
+}
+
+void SyncFileSystemBackend::flush() {}
+
+void SyncFileSystemBackend::discard() noexcept {}
+
+const char *SyncFileSystemBackend::name() const
+{
+  return "sync";
+}
+
+std::unique_ptr<FileSystemBackend> make_file_system_backend(IoBackend backend)
+{
+  if(backend == IoBackend::Uring) {
+    if(auto uring = UringFileSystemBackend::create()) {
+      return uring;
+    }
+  }
+
+  return std::make_unique<SyncFileSystemBackend>();
+}
@@ -0,0 +1,316 @@
+#include "Nexpp/FileSystem/LayoutTree.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string_view>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+#include "Nexpp/FileSystem/FileCloner.h"
+#include "Nexpp/FileSystem/FileDescriptor.h"
+#include "Nexpp/Generator/ContentHasher.h"
+#include "Nexpp/Stats/RunStats.h"
+#include "Nexpp/Trace/Trace.h"
+
+namespace {
+[[noreturn]] void throw_errno(const std::string &action, std::string_view path)
+{
+  throw std::system_error(
+      errno, std::generic_category(), action + " " + std::string(path)
+  );
+}
+
+std::uint64_t
+    write_all(int fd, std::string_view content, std::string_view path)
+{
+  std::uint64_t calls = 0;
+  while(!content.empty()) {
+    ++calls;
+    const ssize_t written = ::write(fd, content.data(), content.size());
+    if(written < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      throw_errno("Cannot write file", path);
+    }
+    content.remove_prefix(static_cast<std::size_t>(written));
+  }
+  return calls;
+}
+
+void materialize_file(
+    int directory_fd, const LayoutNode &node, std::string_view path, bool sync
+)
+{
+  NEXPP_TRACE_SCOPE("LayoutTree::write_file", path);
+  const LatencyTimer timer(StatLatency::FileWrite);
+
+  FileDescriptor file(::openat(
+      directory_fd, node.name.c_str(),
+      O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW | O_CLOEXEC, 0644
+  ));
+  if(!file.is_valid()) {
+    throw_errno("Cannot create file", path);
+  }
+
+  const std::uint64_t writes = write_all(file.get(), node.content, path);
+
+  if(sync && ::fsync(file.get()) != 0) {
+    throw_errno("Cannot sync file", path);
+  }
+
+  if(::close(file.release()) != 0) {
+    throw_errno("Cannot close file", path);
+  }
+
+  RunStats::add(StatCounter::Files);
+  RunStats::add(StatCounter::BytesWritten, node.content.size());
+  RunStats::add(StatCounter::Syscalls, 2 + writes + (sync ? 1 : 0));
+}
+
+void materialize_symlink(
+    int directory_fd, const LayoutNode &node, std::string_view path
+)
+{
+  RunStats::add(StatCounter::Syscalls);
+  if(::symlinkat(node.content.c_str(), directory_fd, node.name.c_str()) == 0) {
+    return;
+  }
+
+  RunStats::add(StatCounter::Syscalls, 2);
+
+  if(errno != EEXIST || ::unlinkat(directory_fd, node.name.c_str(), 0) != 0 ||
+     ::symlinkat(node.content.c_str(), directory_fd, node.name.c_str()) != 0) {
+    throw_errno("Cannot create symlink", path);
+  }
+}
+
+// The relative path is only needed for errors and trace spans, so one buffer
+// is extended and truncated while walking instead of building a path per node.
+void materialize_children(
+    int directory_fd, const LayoutNode &folder, std::pmr::string &path,
+    bool sync
+)
+{
+  const std::size_t parent_size = path.size();
+
+  for(const auto &child : folder.children) {
+    path.resize(parent_size);
+    if(parent_size != 0) {
+      path += '/';
+    }
+    path += child.name;
+
+    switch(child.kind) {
+    case LayoutKind::Folder: {
+      if(::mkdirat(directory_fd, child.name.c_str(), 0755) == 0) {
+        RunStats::add(StatCounter::Directories);
+      } else if(errno != EEXIST) {
+        throw_errno("Cannot create folder", path);
+      }
+
+      FileDescriptor child_fd(::openat(
+          directory_fd, child.name.c_str(),
+          O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC
+      ));
+      if(!child_fd.is_valid()) {
+        throw_errno("Cannot open folder", path);
+      }
+
+      RunStats::add(StatCounter::Syscalls, 3);
+      materialize_children(child_fd.get(), child, path, sync);
+      break;
+    }
+    case LayoutKind::File:
+      materialize_file(directory_fd, child, path, sync);
+      break;
+    case LayoutKind::Symlink:
+      materialize_symlink(directory_fd, child, path);
+      break;
+    case LayoutKind::Clone:
+      FileCloner::clone(
+          child.content.c_str(), directory_fd, child.name.c_str(), sync
+      );
+      break;
+    }
+  }
+
+  path.resize(parent_size);
+}
+
+void visit_children(
+    const LayoutNode &folder, std::pmr::string &path,
+    const LayoutTree::Visitor &visitor
+)
+{
+  const std::size_t parent_size = path.size();
+
+  for(const auto &child : folder.children) {
+    path.resize(parent_size);
+    if(parent_size != 0) {
+      path += '/';
+    }
+    path += child.name;
+
+    visitor(path, child);
+    if(child.kind == LayoutKind::Folder) {
+      visit_children(child, path, visitor);
+    }
+  }
+
+  path.resize(parent_size);
+}
+
+void hash_children(const LayoutNode &folder, ContentHasher &hasher)
+{
+  for(const auto &child : folder.children) {
+    const auto          kind = static_cast<char>(child.kind);
+    const std::uint64_t size = child.content.size();
+
+    hasher.update(std::string_view(&kind, 1));
+    hasher.update(std::string_view(child.name.c_str(), child.name.size() + 1));
+    hasher.update(std::string_view(
+        reinterpret_cast<const char *>(&size), sizeof(size)
+    ));
+    hasher.update(child.content);
+
+    if(child.kind == LayoutKind::Folder) {
+      hash_children(child, hasher);
+      hasher.update("/");
+    }
+  }
+}
+} // namespace
+
+LayoutTree::LayoutTree(std::pmr::memory_resource *resource) : m_root(resource)
+{
+}
+
+void LayoutTree::add_folder(std::string_view path)
+{
+  insert(path, LayoutKind::Folder, {});
+}
+
+void LayoutTree::add_file(std::string_view path, std::pmr::string content)
+{
+  insert(path, LayoutKind::File, std::move(content));
+}
+
+void LayoutTree::add_symlink(
+    std::string_view path, const std::filesystem::path &target
+)
+{
+  insert(
+      path, LayoutKind::Symlink,
+      std::pmr::string(target.native(), m_root.children.get_allocator())
+  );
+}
+
+void LayoutTree::add_clone(
+    std::string_view path, const std::filesystem::path &source
+)
+{
+  insert(
+      path, LayoutKind::Clone,
+      std::pmr::string(source.native(), m_root.children.get_allocator())
+  );
+}
+
+const LayoutNode &LayoutTree::root() const
+{
+  return m_root;
+}
+
+bool LayoutTree::empty() const
+{
+  return m_size == 0;
+}
+
+std::size_t LayoutTree::size() const
+{
+  return m_size;
+}
+
+void LayoutTree::for_each(const Visitor &visitor) const
+{
+  std::pmr::string path(m_root.children.get_allocator());
+  visit_children(m_root, path, visitor);
+}
+
+std::uint64_t LayoutTree::hash() const
+{
+  ContentHasher hasher;
+  hash_children(m_root, hasher);
+  return hasher.digest();
+}
+
+void LayoutTree::materialize(int directory_fd, bool sync) const
+{
+  NEXPP_TRACE_SCOPE("LayoutTree::materialize");
+  std::pmr::string path(m_root.children.get_allocator());
+  materialize_children(directory_fd, m_root, path, sync);
+}
+
+LayoutNode &LayoutTree::insert(
+    std::string_view path, LayoutKind kind, std::pmr::string content
+)
+{
+  if(path.empty() || path.front() == '/') {
+    throw std::runtime_error(
+        "Layout entry must be a relative path: " + std::string(path)
+    );
+  }
+
+  LayoutNode      *parent    = &m_root;
+  std::string_view remaining = path;
+  bool             is_last   = false;
+  while(!is_last) {
+    const std::size_t      slash = remaining.find('/');
+    const std::string_view name  = remaining.substr(0, slash);
+    is_last = slash == std::string_view::npos;
+    remaining.remove_prefix(is_last ? remaining.size() : slash + 1);
+
+    if(name.empty() || name == "." || name == "..") {
+      throw std::runtime_error("Invalid layout entry: " + std::string(path));
+    }
+
+    auto &children = parent->children;
+    auto  found    = std::lower_bound(
+        children.begin(), children.end(), name,
+        [](const LayoutNode &node, std::string_view key) {
+          return node.name < key;
+        }
+    );
+
+    if(found != children.end() && found->name == name) {
+      if(is_last && kind == LayoutKind::Folder &&
+         found->kind == LayoutKind::Folder) {
+        return *found;
+      }
+
+      if(is_last || found->kind != LayoutKind::Folder) {
+        throw std::runtime_error(
+            "Conflicting layout entry: " + std::string(path)
+        );
+      }
+
+      parent = &*found;
+      continue;
+    }
+
+    LayoutNode node(children.get_allocator());
+    node.kind = is_last ? kind : LayoutKind::Folder;
+    node.name = name;
+    if(is_last) {
+      node.content = std::move(content);
+    }
+
+    parent = &*children.insert(found, std::move(node));
+    ++m_size;
+  }
+
+  return *parent;
+}
@@ -0,0 +1,206 @@
+#include "Nexpp/FileSystem/MemoryFileSystem.h"
+
+#include <stdexcept>
+
+namespace {
+constexpr int         max_symlink_hops     = 40;
+constexpr std::size_t min_compaction_bytes = 64 * 1024;
+} // namespace
+
+void MemoryFileSystem::create_folder(
+    std::filesystem::path path, std::string folder_name
+)
+{
+  const std::filesystem::path folder = normalize(path / folder_name);
+  require_parent(folder);
+
+  if(m_files.contains(folder) || m_symlinks.contains(folder)) {
+    throw std::runtime_error("Cannot create folder: " + folder.string());
+  }
+  m_folders.insert(folder);
+}
+
+void MemoryFileSystem::create_file(
+    std::filesystem::path path, std::string filename
+)
+{
+  const std::filesystem::path file = resolve(normalize(path / filename));
+  require_parent(file);
+  store(file, {});
+}
+
+void MemoryFileSystem::put_in_file(
+    std::filesystem::path path, std::string_view content
+)
+{
+  const std::filesystem::path file = resolve(normalize(path));
+  require_parent(file);
+  store(file, content);
+}
+
+void MemoryFileSystem::append_in_file(
+    std::filesystem::path path, std::string_view content
+)
+{
+  const std::filesystem::path file = resolve(normalize(path));
+  require_parent(file);
+
+  const auto existing = m_files.find(file);
+  if(existing == m_files.end()) {
+    store(file, content);
+    return;
+  }
+
+  Extent &extent = existing->second;
+  if(extent.offset + extent.size == m_arena.size()) {
+    m_arena.insert(m_arena.end(), content.begin(), content.end());
+    extent.size  += content.size();
+    m_live_bytes += content.size();
+    return;
+  }
+
+  std::string combined(m_arena.data() + extent.offset, extent.size);
+  combined += content;
+  store(file, combined);
+}
+
+void MemoryFileSystem::create_symlink(
+    std::filesystem::path origin, std::filesystem::path destination
+)
+{
+  const std::filesystem::path link = normalize(destination);
+  require_parent(link);
+
+  if(exists(link)) {
+    throw std::runtime_error("Cannot create symlink: " + link.string());
+  }
+  m_symlinks.emplace(link, normalize(origin));
+}
+
+bool MemoryFileSystem::exists(const std::filesystem::path &path) const
+{
+  const std::filesystem::path normalized = normalize(path);
+  return normalized.empty() || normalized == normalized.root_path() ||
+         m_files.contains(normalized) || m_folders.contains(normalized) ||
+         m_symlinks.contains(normalized);
+}
+
+std::optional<std::string>
+    MemoryFileSystem::read_file(const std::filesystem::path &path) const
+{
+  const auto view = view_file(path);
+  if(!view) {
+    return std::nullopt;
+  }
+  return std::string(*view);
+}
+
+std::optional<std::string_view>
+    MemoryFileSystem::view_file(const std::filesystem::path &path) const
+{
+  const auto file = m_files.find(resolve(normalize(path)));
+  if(file == m_files.end()) {
+    return std::nullopt;
+  }
+  return std::string_view(
+      m_arena.data() + file->second.offset, file->second.size
+  );
+}
+
+std::size_t MemoryFileSystem::arena_size() const
+{
+  return m_arena.size();
+}
+
+std::size_t MemoryFileSystem::live_bytes() const
+{
+  return m_live_bytes;
+}
+
+void MemoryFileSystem::clear()
+{
+  m_arena.clear();
+  m_files.clear();
+  m_folders.clear();
+  m_symlinks.clear();
+  m_live_bytes = 0;
+}
+
+std::filesystem::path
+    MemoryFileSystem::normalize(const std::filesystem::path &path)
+{
+  std::filesystem::path normalized = path.lexically_normal();
+  if(!normalized.empty() && !normalized.has_filename() &&
+     normalized != normalized.root_path()) {
+    normalized = normalized.parent_path();
+  }
+  return normalized == "." ? std::filesystem::path() : normalized;
+}
+
+std::filesystem::path
+    MemoryFileSystem::resolve(std::filesystem::path path) const
+{
+  for(int hop = 0; hop < max_symlink_hops; ++hop) {
+    const auto link = m_symlinks.find(path);
+    if(link == m_symlinks.end()) {
+      return path;
+    }
+
+    path = link->second.is_absolute()
+               ? link->second
+               : normalize(path.parent_path() / link->second);
+  }
+
+  throw std::runtime_error(
+      "Too many levels of symbolic links: " + path.string()
+  );
+}
+
+void MemoryFileSystem::require_parent(const std::filesystem::path &path) const
+{
+  const std::filesystem::path parent = resolve(path.parent_path());
+  if(!parent.empty() && parent != parent.root_path() &&
+     !m_folders.contains(parent)) {
+    throw std::runtime_error("No such directory: " + parent.string());
+  }
+}
+
+void MemoryFileSystem::store(
+    const std::filesystem::path &path, std::string_view content
+)
+{
+  if(m_folders.contains(path)) {
+    throw std::runtime_error("Is a directory: " + path.string());
+  }
+
+  auto [entry, inserted] = m_files.try_emplace(path);
+  if(!inserted) {
+    m_live_bytes -= entry->second.size;
+  }
+
+  entry->second = Extent {m_arena.size(), content.size()};
+  m_arena.insert(m_arena.end(), content.begin(), content.end());
+  m_live_bytes += content.size();
+
+  if(m_arena.size() > min_compaction_bytes &&
+     m_arena.size() > 2 * m_live_bytes) {
+    compact();
+  }
+}
+
+void MemoryFileSystem::compact()
+{
+  std::vector<char> arena;
+  arena.reserve(m_live_bytes);
+
+  for(auto &[path, extent] : m_files) {
+    const auto begin =
+        m_arena.begin() + static_cast<std::ptrdiff_t>(extent.offset);
+    extent.offset = arena.size();
+    arena.insert(
+        arena.end(), begin, begin + static_cast<std::ptrdiff_t>(extent.size)
+    );
+  }
+
+  m_arena = std::move(arena);
+}
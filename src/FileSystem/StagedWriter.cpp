@@ -0,0 +1,325 @@
+#include "Nexpp/FileSystem/StagedWriter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <fcntl.h>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+#include "Nexpp/FileSystem/FileDescriptor.h"
+#include "Nexpp/Stats/RunStats.h"
+#include "Nexpp/Trace/Trace.h"
+
+namespace {
+std::atomic<unsigned> staging_counter = 0;
+SyncFileSystemBackend default_backend;
+
+[[noreturn]] void
+    throw_errno(const std::string &action, const std::filesystem::path &path)
+{
+  throw std::system_error(
+      errno, std::generic_category(), action + " " + path.string()
+  );
+}
+
+FileDescriptor open_directory(const std::filesystem::path &path)
+{
+  FileDescriptor directory(
+      ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)
+  );
+  if(!directory.is_valid()) {
+    throw_errno("Cannot open directory", path);
+  }
+  return directory;
+}
+
+void sync_directory(const std::filesystem::path &path)
+{
+  FileDescriptor directory = open_directory(path);
+  if(::fsync(directory.get()) != 0) {
+    throw_errno("Cannot sync directory", path);
+  }
+  RunStats::add(StatCounter::Syscalls, 3);
+}
+
+// Symlinks are skipped: the directory sync that follows makes them durable.
+void sync_file_data(const std::filesystem::path &path)
+{
+  FileDescriptor file(::open(path.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC));
+  if(!file.is_valid()) {
+    if(errno == ELOOP) {
+      return;
+    }
+    throw_errno("Cannot open file", path);
+  }
+  if(::fdatasync(file.get()) != 0) {
+    throw_errno("Cannot sync file", path);
+  }
+  RunStats::add(StatCounter::Syscalls, 3);
+}
+
+struct PublishedFile
+{
+  std::filesystem::path target;
+  std::filesystem::path backup;
+  bool                  had_target;
+};
+
+void create_missing_directories(
+    const std::filesystem::path        &path,
+    std::vector<std::filesystem::path> &created
+)
+{
+  if(path.empty() || std::filesystem::exists(path)) {
+    return;
+  }
+
+  create_missing_directories(path.parent_path(), created);
+  std::filesystem::create_directory(path);
+  created.push_back(path);
+}
+
+// Restores the destination as it was before publishing started: replaced
+// files come back, new files and directories disappear.
+void undo_publish(
+    const std::vector<PublishedFile>         &published,
+    const std::vector<std::filesystem::path> &created
+) noexcept
+{
+  for(auto file = published.rbegin(); file != published.rend(); ++file) {
+    if(file->had_target) {
+      ::rename(file->backup.c_str(), file->target.c_str());
+    } else {
+      ::unlink(file->target.c_str());
+    }
+  }
+
+  std::error_code error;
+  for(auto folder = created.rbegin(); folder != created.rend(); ++folder) {
+    std::filesystem::remove(*folder, error);
+  }
+}
+
+// Generated roots are normal already in the common case, which then keeps
+// lexically_normal() from rebuilding them component by component.
+bool is_normal(const std::filesystem::path &path)
+{
+  if(!path.has_filename() || path.native().find("//") != std::string::npos) {
+    return false;
+  }
+  return std::ranges::none_of(path, [](const std::filesystem::path &part) {
+    return part.native() == "." || part.native() == "..";
+  });
+}
+
+std::filesystem::path normalize_destination(std::filesystem::path destination)
+{
+  if(is_normal(destination)) {
+    return destination;
+  }
+
+  destination = destination.lexically_normal();
+  if(!destination.has_filename()) {
+    destination = destination.parent_path();
+  }
+  return destination;
+}
+} // namespace
+
+StagedWriter::StagedWriter(std::filesystem::path destination, SyncPolicy policy)
+    : StagedWriter(std::move(destination), policy, default_backend)
+{
+}
+
+StagedWriter::StagedWriter(
+    std::filesystem::path destination, SyncPolicy policy,
+    FileSystemBackend &backend, std::pmr::memory_resource *resource
+)
+    : m_destination(normalize_destination(std::move(destination))),
+      m_policy(policy), m_backend(backend), m_folders(resource),
+      m_files(resource), m_contents(resource)
+{
+  // The staging folder sits next to the destination as
+  // <parent>/.<name>.nexpp-staging-<pid>-<counter>, built in one string.
+  const std::string_view target    = m_destination.native();
+  const std::size_t      separator = target.rfind('/');
+  const std::string_view parent =
+      target.substr(0, separator == std::string_view::npos ? 0 : separator + 1);
+
+  const std::string pid     = std::to_string(::getpid());
+  const std::string counter = std::to_string(staging_counter++);
+
+  std::string staging;
+  staging.reserve(target.size() + pid.size() + counter.size() + 18);
+  staging += parent;
+  staging += '.';
+  staging += target.substr(parent.size());
+  staging += ".nexpp-staging-";
+  staging += pid;
+  staging += '-';
+  staging += counter;
+
+  // The parent usually exists, so it is only created when mkdir says so.
+  RunStats::add(StatCounter::Syscalls);
+  if(::mkdir(staging.c_str(), 0755) != 0) {
+    if(errno != ENOENT || parent.empty()) {
+      throw_errno("Cannot create staging folder", staging);
+    }
+    std::filesystem::create_directories(m_destination.parent_path());
+    RunStats::add(StatCounter::Syscalls);
+    if(::mkdir(staging.c_str(), 0755) != 0) {
+      throw_errno("Cannot create staging folder", staging);
+    }
+  }
+
+  m_staging = std::move(staging);
+}
+
+StagedWriter::~StagedWriter()
+{
+  rollback();
+}
+
+void StagedWriter::create_folder(const std::filesystem::path &relative_path)
+{
+  m_backend.create_folder(m_staging / relative_path);
+  m_folders.emplace_back(relative_path.native());
+}
+
+void StagedWriter::write_file(
+    const std::filesystem::path &relative_path, std::string content
+)
+{
+  // The backend keeps a view until flush(); the deque never relocates it.
+  m_backend.write_file(
+      m_staging / relative_path, m_contents.emplace_back(std::move(content)),
+      m_policy == SyncPolicy::PerFile
+  );
+  m_files.emplace_back(relative_path.native());
+}
+
+void StagedWriter::write_layout(const LayoutTree &layout)
+{
+  m_backend.write_layout(m_staging, layout, m_policy == SyncPolicy::PerFile);
+
+  layout.for_each([this](const auto &path, const LayoutNode &node) {
+    if(node.kind == LayoutKind::Folder) {
+      m_folders.emplace_back(path);
+    } else {
+      m_files.emplace_back(path);
+    }
+  });
+}
+
+void StagedWriter::commit()
+{
+  NEXPP_TRACE_SCOPE("StagedWriter::commit", m_destination.native());
+
+  if(m_finished) {
+    throw std::logic_error("Staged project was already committed");
+  }
+
+  m_backend.flush();
+  sync_staged_tree();
+
+  RunStats::add(StatCounter::Syscalls);
+  if(::rename(m_staging.c_str(), m_destination.c_str()) == 0) {
+    m_finished = true;
+  } else if(errno == ENOTEMPTY || errno == EEXIST) {
+    publish_into_existing();
+    rollback();
+  } else {
+    throw_errno("Cannot publish project to", m_destination);
+  }
+
+  if(m_policy != SyncPolicy::None) {
+    const std::filesystem::path parent = m_destination.parent_path();
+    sync_directory(parent.empty() ? std::filesystem::path(".") : parent);
+  }
+}
+
+void StagedWriter::rollback() noexcept
+{
+  if(m_finished) {
+    return;
+  }
+
+  m_backend.discard();
+
+  std::error_code error;
+  std::filesystem::remove_all(m_staging, error);
+  m_finished = true;
+}
+
+const std::filesystem::path &StagedWriter::staging_path() const
+{
+  return m_staging;
+}
+
+void StagedWriter::sync_staged_tree() const
+{
+  if(m_policy == SyncPolicy::None) {
+    return;
+  }
+
+  // Only this project's files are flushed. syncfs() would also wait for
+  // every other dirty page on the file system, once per project.
+  if(m_policy == SyncPolicy::PerProject) {
+    for(const auto &file : m_files) {
+      sync_file_data(m_staging / file);
+    }
+  }
+
+  for(const auto &folder : m_folders) {
+    sync_directory(m_staging / folder);
+  }
+  sync_directory(m_staging);
+}
+
+void StagedWriter::publish_into_existing() const
+{
+  // Files replaced in the destination are parked under the staging tree, so
+  // a failure partway through can put every one of them back.
+  const std::filesystem::path        replaced = m_staging / ".nexpp-replaced";
+  std::vector<std::filesystem::path> created;
+  std::vector<PublishedFile>         published;
+
+  try {
+    for(const auto &folder : m_folders) {
+      create_missing_directories(m_destination / folder, created);
+    }
+
+    for(const auto &file : m_files) {
+      const std::filesystem::path target = m_destination / file;
+      const std::filesystem::path backup = replaced / file;
+      create_missing_directories(target.parent_path(), created);
+      std::filesystem::create_directories(backup.parent_path());
+
+      RunStats::add(StatCounter::Syscalls);
+      const bool had_target = ::rename(target.c_str(), backup.c_str()) == 0;
+      if(!had_target && errno != ENOENT) {
+        throw_errno("Cannot replace file", target);
+      }
+      published.push_back({target, backup, had_target});
+
+      RunStats::add(StatCounter::Syscalls);
+      if(::rename((m_staging / file).c_str(), target.c_str()) != 0) {
+        throw_errno("Cannot publish file to", target);
+      }
+    }
+  } catch(...) {
+    undo_publish(published, created);
+    throw;
+  }
+
+  if(m_policy != SyncPolicy::None) {
+    for(const auto &folder : m_folders) {
+      sync_directory(m_destination / folder);
+    }
+    sync_directory(m_destination);
+  }
+}
@@ -0,0 +1,562 @@
+#include "Nexpp/FileSystem/UringFileSystemBackend.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+#include "Nexpp/FileSystem/FileCloner.h"
+#include "Nexpp/FileSystem/FileDescriptor.h"
+#include "Nexpp/Stats/RunStats.h"
+#include "Nexpp/Trace/Trace.h"
+
+namespace {
+enum class Operation : std::uint64_t
+{
+  Mkdir,
+  Open,
+  Write,
+  Sync,
+  Close,
+  Symlink
+};
+
+std::uint64_t encode(std::size_t index, Operation operation)
+{
+  return (static_cast<std::uint64_t>(index) << 3) |
+         static_cast<std::uint64_t>(operation);
+}
+
+std::size_t decode_index(std::uint64_t user_data)
+{
+  return static_cast<std::size_t>(user_data >> 3);
+}
+
+Operation decode_operation(std::uint64_t user_data)
+{
+  return static_cast<Operation>(user_data & 7);
+}
+
+int io_uring_setup(unsigned entries, io_uring_params *params)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete)
+{
+  return static_cast<int>(::syscall(
+      __NR_io_uring_enter, fd, to_submit, min_complete,
+      IORING_ENTER_GETEVENTS, nullptr, 0
+  ));
+}
+
+int io_uring_register(int fd, unsigned opcode, void *arg, unsigned count)
+{
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_register, fd, opcode, arg, count)
+  );
+}
+
+std::size_t path_depth(const std::filesystem::path &path)
+{
+  return static_cast<std::size_t>(std::distance(path.begin(), path.end()));
+}
+
+class Mapping
+{
+public:
+  Mapping() = default;
+
+  Mapping(int fd, std::size_t size, off_t offset) : m_size(size)
+  {
+    m_address = ::mmap(
+        nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+        offset
+    );
+  }
+
+  ~Mapping()
+  {
+    if(is_valid()) {
+      ::munmap(m_address, m_size);
+    }
+  }
+
+  Mapping(const Mapping &)            = delete;
+  Mapping &operator=(const Mapping &) = delete;
+
+  Mapping &operator=(Mapping &&other) noexcept
+  {
+    std::swap(m_address, other.m_address);
+    std::swap(m_size, other.m_size);
+    return *this;
+  }
+
+  bool is_valid() const
+  {
+    return m_address != MAP_FAILED;
+  }
+
+  template<typename T>
+  T *at(std::uint32_t offset) const
+  {
+    return reinterpret_cast<T *>(static_cast<char *>(m_address) + offset);
+  }
+
+private:
+  void       *m_address = MAP_FAILED;
+  std::size_t m_size    = 0;
+};
+} // namespace
+
+struct UringFileSystemBackend::Ring
+{
+  FileDescriptor           fd;
+  Mapping                  sq_ring;
+  Mapping                  cq_ring;
+  Mapping                  sqe_ring;
+
+  unsigned                 entries    = 0;
+  unsigned                *sq_tail    = nullptr;
+  unsigned                *sq_mask    = nullptr;
+  unsigned                *sq_array   = nullptr;
+  io_uring_sqe            *sqes       = nullptr;
+  unsigned                *cq_head    = nullptr;
+  unsigned                *cq_tail    = nullptr;
+  unsigned                *cq_mask    = nullptr;
+  io_uring_cqe            *cqes       = nullptr;
+
+  unsigned                 local_tail = 0;
+  unsigned                 queued     = 0;
+  bool                     symlinkat  = false;
+
+  io_uring_sqe            &next_sqe()
+  {
+    const unsigned index = local_tail & *sq_mask;
+    io_uring_sqe  &sqe   = sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sq_array[index] = index;
+    ++local_tail;
+    ++queued;
+    return sqe;
+  }
+
+  template<typename Handler>
+  void submit_and_wait(Handler &&handler)
+  {
+    std::atomic_ref<unsigned>(*sq_tail).store(
+        local_tail, std::memory_order_release
+    );
+
+    unsigned           to_submit = queued;
+    unsigned           completed = 0;
+    std::exception_ptr failure;
+
+    while(completed < queued) {
+      const int submitted = io_uring_enter(fd.get(), to_submit, 1);
+      RunStats::add(StatCounter::Syscalls);
+      if(submitted < 0) {
+        if(errno == EINTR) {
+          continue;
+        }
+        throw std::system_error(
+            errno, std::generic_category(), "io_uring_enter failed"
+        );
+      }
+      to_submit -= static_cast<unsigned>(submitted);
+
+      unsigned       head = *cq_head;
+      const unsigned tail =
+          std::atomic_ref<unsigned>(*cq_tail).load(std::memory_order_acquire);
+      for(; head != tail; ++head) {
+        const io_uring_cqe &cqe = cqes[head & *cq_mask];
+        // A throwing handler must not strand the remaining completions in
+        // the ring, so the first exception waits until it is drained.
+        try {
+          handler(cqe.user_data, cqe.res);
+        } catch(...) {
+          if(!failure) {
+            failure = std::current_exception();
+          }
+        }
+        ++completed;
+      }
+      std::atomic_ref<unsigned>(*cq_head).store(
+          head, std::memory_order_release
+      );
+    }
+
+    queued = 0;
+    if(failure) {
+      std::rethrow_exception(failure);
+    }
+  }
+};
+
+std::unique_ptr<UringFileSystemBackend>
+    UringFileSystemBackend::create(unsigned queue_depth)
+{
+  io_uring_params params {};
+  const int       fd = io_uring_setup(queue_depth, &params);
+  if(fd < 0) {
+    return nullptr;
+  }
+
+  auto ring = std::make_unique<Ring>();
+  ring->fd.reset(fd);
+
+  alignas(io_uring_probe) std::byte probe_storage
+      [sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op)] {};
+  auto *probe = reinterpret_cast<io_uring_probe *>(probe_storage);
+  if(io_uring_register(fd, IORING_REGISTER_PROBE, probe, 256) < 0) {
+    return nullptr;
+  }
+
+  for(const unsigned operation :
+      {IORING_OP_MKDIRAT, IORING_OP_OPENAT, IORING_OP_WRITE, IORING_OP_FSYNC,
+       IORING_OP_CLOSE}) {
+    if(operation > probe->last_op ||
+       !(probe->ops[operation].flags & IO_URING_OP_SUPPORTED)) {
+      return nullptr;
+    }
+  }
+
+  std::size_t sq_size =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  std::size_t cq_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if(single_mmap) {
+    sq_size = cq_size = std::max(sq_size, cq_size);
+  }
+
+  ring->sq_ring = Mapping(fd, sq_size, IORING_OFF_SQ_RING);
+  if(!single_mmap) {
+    ring->cq_ring = Mapping(fd, cq_size, IORING_OFF_CQ_RING);
+  }
+  ring->sqe_ring = Mapping(
+      fd, params.sq_entries * sizeof(io_uring_sqe), IORING_OFF_SQES
+  );
+
+  const Mapping &cq_mapping = single_mmap ? ring->sq_ring : ring->cq_ring;
+  if(!ring->sq_ring.is_valid() || !cq_mapping.is_valid() ||
+     !ring->sqe_ring.is_valid()) {
+    return nullptr;
+  }
+
+  ring->entries    = params.sq_entries;
+  ring->sq_tail    = ring->sq_ring.at<unsigned>(params.sq_off.tail);
+  ring->sq_mask    = ring->sq_ring.at<unsigned>(params.sq_off.ring_mask);
+  ring->sq_array   = ring->sq_ring.at<unsigned>(params.sq_off.array);
+  ring->sqes       = ring->sqe_ring.at<io_uring_sqe>(0);
+  ring->cq_head    = cq_mapping.at<unsigned>(params.cq_off.head);
+  ring->cq_tail    = cq_mapping.at<unsigned>(params.cq_off.tail);
+  ring->cq_mask    = cq_mapping.at<unsigned>(params.cq_off.ring_mask);
+  ring->cqes       = cq_mapping.at<io_uring_cqe>(params.cq_off.cqes);
+  ring->local_tail = *ring->sq_tail;
+  // Symlinks fall back to symlink(2) on kernels without IORING_OP_SYMLINKAT.
+  ring->symlinkat  = IORING_OP_SYMLINKAT <= probe->last_op &&
+                    (probe->ops[IORING_OP_SYMLINKAT].flags &
+                     IO_URING_OP_SUPPORTED);
+
+  return std::unique_ptr<UringFileSystemBackend>(
+      new UringFileSystemBackend(std::move(ring))
+  );
+}
+
+UringFileSystemBackend::UringFileSystemBackend(std::unique_ptr<Ring> ring)
+    : m_ring(std::move(ring))
+{
+}
+
+UringFileSystemBackend::~UringFileSystemBackend() = default;
+
+void UringFileSystemBackend::create_folder(const std::filesystem::path &path)
+{
+  m_folders.push_back(path);
+}
+
+void UringFileSystemBackend::write_file(
+    const std::filesystem::path &path, std::string_view content, bool sync
+)
+{
+  PendingFile file;
+  file.path    = path;
+  file.content = content;
+  file.sync    = sync;
+  m_files.push_back(std::move(file));
+}
+
+void UringFileSystemBackend::clone_file(
+    const std::filesystem::path &source, const std::filesystem::path &target,
+    bool sync
+)
+{
+  m_clones.push_back({source, target, sync});
+}
+
+void UringFileSystemBackend::create_symlink(
+    const std::filesystem::path &target, const std::filesystem::path &link
+)
+{
+  m_symlinks.push_back({target, link});
+}
+
+void UringFileSystemBackend::flush()
+{
+  NEXPP_TRACE_SCOPE("UringFileSystemBackend::flush");
+
+  try {
+    flush_folders();
+    flush_symlinks();
+
+    const std::size_t chunk = std::max(m_ring->entries / 3, 1u);
+    for(std::size_t first = 0; first < m_files.size(); first += chunk) {
+      flush_files(first, std::min(first + chunk, m_files.size()));
+    }
+
+    flush_clones();
+  } catch(...) {
+    for(auto &file : m_files) {
+      if(file.fd >= 0 && !file.closed) {
+        ::close(file.fd);
+      }
+    }
+    discard();
+    throw;
+  }
+
+  discard();
+
+  if(m_error) {
+    const std::error_code error = std::exchange(m_error, {});
+    throw std::system_error(error, "Cannot write " + m_error_path.string());
+  }
+}
+
+void UringFileSystemBackend::discard() noexcept
+{
+  m_folders.clear();
+  m_symlinks.clear();
+  m_files.clear();
+  m_clones.clear();
+}
+
+const char *UringFileSystemBackend::name() const
+{
+  return "io_uring";
+}
+
+void UringFileSystemBackend::flush_folders()
+{
+  std::stable_sort(
+      m_folders.begin(), m_folders.end(),
+      [](const auto &left, const auto &right) {
+        return path_depth(left) < path_depth(right);
+      }
+  );
+
+  auto on_completion = [this](std::uint64_t user_data, int result) {
+    const std::filesystem::path &folder = m_folders[decode_index(user_data)];
+    if(result >= 0) {
+      RunStats::add(StatCounter::Directories);
+    } else if(result == -ENOENT) {
+      std::error_code error;
+      std::filesystem::create_directories(folder, error);
+      record_error(error.value(), folder);
+    } else if(result != -EEXIST) {
+      record_error(-result, folder);
+    }
+  };
+
+  std::size_t index = 0;
+  while(index < m_folders.size()) {
+    const std::size_t depth = path_depth(m_folders[index]);
+
+    while(index < m_folders.size() && path_depth(m_folders[index]) == depth &&
+          m_ring->queued < m_ring->entries) {
+      io_uring_sqe &sqe = m_ring->next_sqe();
+      sqe.opcode        = IORING_OP_MKDIRAT;
+      sqe.fd            = AT_FDCWD;
+      sqe.addr =
+          reinterpret_cast<std::uint64_t>(m_folders[index].c_str());
+      sqe.len           = 0755;
+      sqe.user_data     = encode(index, Operation::Mkdir);
+      ++index;
+    }
+
+    m_ring->submit_and_wait(on_completion);
+  }
+}
+
+void UringFileSystemBackend::flush_symlinks()
+{
+  if(!m_ring->symlinkat) {
+    for(const auto &symlink : m_symlinks) {
+      std::error_code error;
+      std::filesystem::create_symlink(symlink.target, symlink.link, error);
+      record_error(error.value(), symlink.link);
+    }
+    return;
+  }
+
+  auto on_completion = [this](std::uint64_t user_data, int result) {
+    if(result < 0) {
+      record_error(-result, m_symlinks[decode_index(user_data)].link);
+    }
+  };
+
+  for(std::size_t index = 0; index < m_symlinks.size(); ++index) {
+    if(m_ring->queued == m_ring->entries) {
+      m_ring->submit_and_wait(on_completion);
+    }
+
+    const PendingSymlink &symlink = m_symlinks[index];
+    io_uring_sqe         &sqe     = m_ring->next_sqe();
+    sqe.opcode                    = IORING_OP_SYMLINKAT;
+    sqe.fd                        = AT_FDCWD;
+    sqe.addr  = reinterpret_cast<std::uint64_t>(symlink.target.c_str());
+    sqe.addr2 = reinterpret_cast<std::uint64_t>(symlink.link.c_str());
+    sqe.user_data = encode(index, Operation::Symlink);
+  }
+
+  m_ring->submit_and_wait(on_completion);
+}
+
+void UringFileSystemBackend::flush_clones()
+{
+  for(const auto &clone : m_clones) {
+    FileCloner::clone(
+        clone.source.c_str(), AT_FDCWD, clone.target.c_str(), clone.sync
+    );
+  }
+}
+
+void UringFileSystemBackend::flush_files(std::size_t first, std::size_t last)
+{
+  for(std::size_t index = first; index < last; ++index) {
+    io_uring_sqe &sqe = m_ring->next_sqe();
+    sqe.opcode        = IORING_OP_OPENAT;
+    sqe.fd            = AT_FDCWD;
+    sqe.addr =
+        reinterpret_cast<std::uint64_t>(m_files[index].path.c_str());
+    sqe.len           = 0644;
+    sqe.open_flags    = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+    sqe.user_data     = encode(index, Operation::Open);
+  }
+
+  auto on_completion = [this](std::uint64_t user_data, int result) {
+    PendingFile &file = m_files[decode_index(user_data)];
+
+    switch(decode_operation(user_data)) {
+    case Operation::Open:
+      file.fd = result;
+      break;
+    case Operation::Write:
+      if(result > 0) {
+        file.written += static_cast<std::size_t>(result);
+      }
+      break;
+    case Operation::Close:
+      file.closed = result != -ECANCELED;
+      break;
+    case Operation::Mkdir:
+    case Operation::Sync:
+    case Operation::Symlink:
+      break;
+    }
+
+    if(result < 0 && result != -ECANCELED) {
+      record_error(-result, file.path);
+    }
+  };
+
+  m_ring->submit_and_wait(on_completion);
+
+  for(std::size_t index = first; index < last; ++index) {
+    PendingFile &file = m_files[index];
+    if(file.fd < 0) {
+      continue;
+    }
+
+    io_uring_sqe &write = m_ring->next_sqe();
+    write.opcode        = IORING_OP_WRITE;
+    write.fd            = file.fd;
+    write.addr          = reinterpret_cast<std::uint64_t>(file.content.data());
+    write.len           = static_cast<std::uint32_t>(file.content.size());
+    write.flags         = IOSQE_IO_LINK;
+    write.user_data     = encode(index, Operation::Write);
+
+    if(file.sync) {
+      io_uring_sqe &sync = m_ring->next_sqe();
+      sync.opcode        = IORING_OP_FSYNC;
+      sync.fd            = file.fd;
+      sync.flags         = IOSQE_IO_LINK;
+      sync.user_data     = encode(index, Operation::Sync);
+    }
+
+    io_uring_sqe &close = m_ring->next_sqe();
+    close.opcode        = IORING_OP_CLOSE;
+    close.fd            = file.fd;
+    close.user_data     = encode(index, Operation::Close);
+  }
+
+  m_ring->submit_and_wait(on_completion);
+
+  for(std::size_t index = first; index < last; ++index) {
+    finish_file(m_files[index]);
+  }
+}
+
+void UringFileSystemBackend::finish_file(PendingFile &file)
+{
+  if(file.fd >= 0) {
+    RunStats::add(StatCounter::Files);
+    RunStats::add(StatCounter::BytesWritten, file.content.size());
+  }
+
+  if(file.fd < 0 || file.closed) {
+    return;
+  }
+
+  std::string_view remaining = file.content;
+  remaining.remove_prefix(file.written);
+
+  while(!remaining.empty()) {
+    const ssize_t written = ::write(file.fd, remaining.data(), remaining.size());
+    if(written < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+    remaining.remove_prefix(static_cast<std::size_t>(written));
+  }
+
+  if(!remaining.empty() || (file.sync && ::fsync(file.fd) != 0)) {
+    record_error(errno, file.path);
+  }
+
+  ::close(file.fd);
+  file.closed = true;
+}
+
+// Only the first failure is kept. flush() throws it once the queued
+// operations are done, so the ring is never left holding completions.
+void UringFileSystemBackend::record_error(
+    int error, const std::filesystem::path &path
+)
+{
+  if(error != 0 && !m_error) {
+    m_error      = std::error_code(error, std::generic_category());
+    m_error_path = path;
+  }
+}
@@ -0,0 +1,135 @@
+#include "Nexpp/Generator/ContentHasher.h"
+
+#include <bit>
+#include <cstring>
+
+namespace {
+constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+std::uint64_t           read64(const unsigned char *data)
+{
+  std::uint64_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+std::uint32_t read32(const unsigned char *data)
+{
+  std::uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+std::uint64_t round(std::uint64_t accumulator, std::uint64_t input)
+{
+  accumulator += input * kPrime2;
+  accumulator  = std::rotl(accumulator, 31);
+  return accumulator * kPrime1;
+}
+
+std::uint64_t merge(std::uint64_t accumulator, std::uint64_t lane)
+{
+  accumulator ^= round(0, lane);
+  return accumulator * kPrime1 + kPrime4;
+}
+} // namespace
+
+ContentHasher::ContentHasher(std::uint64_t seed)
+    : m_seed(seed),
+      m_lanes {seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1}
+{
+}
+
+void ContentHasher::update(std::string_view data)
+{
+  auto       *input = reinterpret_cast<const unsigned char *>(data.data());
+  std::size_t size  = data.size();
+  m_length         += size;
+
+  if(m_buffered + size < sizeof(m_buffer)) {
+    std::memcpy(m_buffer + m_buffered, input, size);
+    m_buffered += size;
+    return;
+  }
+
+  if(m_buffered > 0) {
+    const std::size_t fill = sizeof(m_buffer) - m_buffered;
+    std::memcpy(m_buffer + m_buffered, input, fill);
+    for(std::size_t lane = 0; lane < 4; ++lane) {
+      m_lanes[lane] = round(m_lanes[lane], read64(m_buffer + lane * 8));
+    }
+    input      += fill;
+    size       -= fill;
+    m_buffered  = 0;
+  }
+
+  while(size >= sizeof(m_buffer)) {
+    for(std::size_t lane = 0; lane < 4; ++lane) {
+      m_lanes[lane] = round(m_lanes[lane], read64(input + lane * 8));
+    }
+    input += sizeof(m_buffer);
+    size  -= sizeof(m_buffer);
+  }
+
+  std::memcpy(m_buffer, input, size);
+  m_buffered = size;
+}
+
+std::uint64_t ContentHasher::digest() const
+{
+  std::uint64_t hash;
+
+  if(m_length >= sizeof(m_buffer)) {
+    hash = std::rotl(m_lanes[0], 1) + std::rotl(m_lanes[1], 7) +
+           std::rotl(m_lanes[2], 12) + std::rotl(m_lanes[3], 18);
+    for(const std::uint64_t lane : m_lanes) {
+      hash = merge(hash, lane);
+    }
+  } else {
+    hash = m_seed + kPrime5;
+  }
+
+  hash                       += m_length;
+
+  const unsigned char *input  = m_buffer;
+  std::size_t          size   = m_buffered;
+
+  while(size >= 8) {
+    hash  ^= round(0, read64(input));
+    hash   = std::rotl(hash, 27) * kPrime1 + kPrime4;
+    input += 8;
+    size  -= 8;
+  }
+
+  if(size >= 4) {
+    hash  ^= read32(input) * kPrime1;
+    hash   = std::rotl(hash, 23) * kPrime2 + kPrime3;
+    input += 4;
+    size  -= 4;
+  }
+
+  while(size > 0) {
+    hash ^= *input * kPrime5;
+    hash  = std::rotl(hash, 11) * kPrime1;
+    ++input;
+    --size;
+  }
+
+  hash ^= hash >> 33;
+  hash *= kPrime2;
+  hash ^= hash >> 29;
+  hash *= kPrime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+std::uint64_t ContentHasher::hash(std::string_view data)
+{
+  ContentHasher hasher;
+  hasher.update(data);
+  return hasher.digest();
+}
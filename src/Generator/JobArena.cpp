@@ -0,0 +1,96 @@
+#include "Nexpp/Generator/JobArena.h"
+
+#include <bit>
+#include <memory>
+#include <optional>
+
+namespace {
+constexpr std::size_t initial_capacity = 64 * 1024;
+
+class OverflowResource final : public std::pmr::memory_resource
+{
+public:
+  std::size_t bytes() const noexcept
+  {
+    return m_bytes;
+  }
+
+  void reset() noexcept
+  {
+    m_bytes = 0;
+  }
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    m_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment)
+      override
+  {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource &other
+  ) const noexcept override
+  {
+    return this == &other;
+  }
+
+  std::size_t m_bytes = 0;
+};
+
+using MonotonicArena = std::pmr::monotonic_buffer_resource;
+
+struct ThreadArena
+{
+  std::size_t                   depth    = 0;
+  std::size_t                   capacity = initial_capacity;
+  std::unique_ptr<std::byte[]>  block;
+  OverflowResource              overflow;
+  std::optional<MonotonicArena> arena;
+};
+
+thread_local ThreadArena thread_arena;
+} // namespace
+
+JobArena::Scope::Scope()
+{
+  ThreadArena &local = thread_arena;
+  if(local.depth++ != 0) {
+    return;
+  }
+
+  if(!local.block) {
+    local.block = std::make_unique_for_overwrite<std::byte[]>(local.capacity);
+  }
+  local.arena.emplace(local.block.get(), local.capacity, &local.overflow);
+}
+
+JobArena::Scope::~Scope()
+{
+  ThreadArena &local = thread_arena;
+  if(--local.depth != 0) {
+    return;
+  }
+
+  local.arena.reset();
+  if(local.overflow.bytes() != 0) {
+    local.capacity = std::bit_ceil(local.capacity + local.overflow.bytes());
+    local.block.reset();
+    local.overflow.reset();
+  }
+}
+
+std::pmr::memory_resource *JobArena::current() noexcept
+{
+  ThreadArena &local = thread_arena;
+  return local.depth != 0 ? &*local.arena : std::pmr::get_default_resource();
+}
+
+std::size_t JobArena::capacity() noexcept
+{
+  return thread_arena.capacity;
+}
@@ -0,0 +1,118 @@
+#include "Nexpp/Generator/LockFile.h"
+
+#include <charconv>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+constexpr std::string_view kHeader  = "# nexpp-lock v1";
+constexpr std::string_view kPadding = "0000000000000000";
+} // namespace
+
+LockFile::LockFile(std::pmr::memory_resource *resource) : m_entries(resource)
+{
+}
+
+LockFile LockFile::load(const std::filesystem::path &project_root)
+{
+  std::ifstream ifs(project_root / file_name, std::ios::binary);
+  if(!ifs) {
+    return {};
+  }
+
+  const std::string content(
+      (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+  );
+  return parse(content);
+}
+
+LockFile LockFile::parse(std::string_view content)
+{
+  LockFile lock;
+
+  while(!content.empty()) {
+    const std::size_t end  = content.find('\n');
+    std::string_view  line = content.substr(0, end);
+    content.remove_prefix(end == std::string_view::npos ? content.size()
+                                                         : end + 1);
+
+    if(line.empty() || line.front() == '#') {
+      continue;
+    }
+
+    std::uint64_t     hash   = 0;
+    const auto        result = std::from_chars(
+        line.data(), line.data() + line.size(), hash, 16
+    );
+    const std::size_t hash_size =
+        static_cast<std::size_t>(result.ptr - line.data());
+
+    if(result.ec != std::errc() || hash_size + 2 >= line.size() ||
+       line.substr(hash_size, 2) != "  ") {
+      throw std::runtime_error(
+          "Corrupted lock file entry: " + std::string(line)
+      );
+    }
+
+    lock.m_entries[std::pmr::string(line.substr(hash_size + 2))] = hash;
+  }
+
+  return lock;
+}
+
+std::optional<std::uint64_t> LockFile::find(std::string_view path) const
+{
+  const auto entry = m_entries.find(path);
+  if(entry == m_entries.end()) {
+    return std::nullopt;
+  }
+  return entry->second;
+}
+
+void LockFile::set(std::string_view path, std::uint64_t hash)
+{
+  m_entries.insert_or_assign(
+      std::pmr::string(path, m_entries.get_allocator()), hash
+  );
+}
+
+const LockFile::Entries &LockFile::entries() const
+{
+  return m_entries;
+}
+
+std::string LockFile::serialize() const
+{
+  std::string content;
+  StringSink  sink(content);
+  write_to(sink);
+  return content;
+}
+
+void LockFile::write_to(OutputSink &sink) const
+{
+  constexpr std::size_t entry_overhead = 16 + 2 + 1;
+
+  std::size_t           size = kHeader.size() + 1;
+  for(const auto &entry : m_entries) {
+    size += entry.first.size() + entry_overhead;
+  }
+
+  sink.reserve(size);
+  sink.write(kHeader);
+  sink.write("\n");
+
+  for(const auto &[path, hash] : m_entries) {
+    char       digits[16];
+    const auto result =
+        std::to_chars(digits, digits + sizeof(digits), hash, 16);
+    const auto length = static_cast<std::size_t>(result.ptr - digits);
+
+    sink.write(kPadding.substr(0, sizeof(digits) - length));
+    sink.write(std::string_view(digits, length));
+    sink.write("  ");
+    sink.write(path);
+    sink.write("\n");
+  }
+}
@@ -0,0 +1,60 @@
+#include "Nexpp/Generator/PathList.h"
+
+PathList::PathList(std::initializer_list<std::string_view> paths)
+{
+  std::size_t bytes = 0;
+  for(const auto path : paths) {
+    bytes += path.size();
+  }
+
+  reserve(paths.size(), bytes);
+  for(const auto path : paths) {
+    push_back(path);
+  }
+}
+
+void PathList::reserve(std::size_t count, std::size_t bytes)
+{
+  m_offsets.reserve(count);
+  m_buffer.reserve(bytes + count);
+}
+
+void PathList::push_back(std::string_view path)
+{
+  m_offsets.push_back(m_buffer.size());
+  m_buffer.append(path);
+  m_buffer.push_back('\0');
+}
+
+bool PathList::empty() const noexcept
+{
+  return m_offsets.empty();
+}
+
+std::size_t PathList::size() const noexcept
+{
+  return m_offsets.size();
+}
+
+std::string_view PathList::front() const
+{
+  return (*this)[0];
+}
+
+std::string_view PathList::operator[](std::size_t index) const
+{
+  const std::size_t begin = m_offsets[index];
+  const std::size_t end   = index + 1 < m_offsets.size() ? m_offsets[index + 1]
+                                                         : m_buffer.size();
+  return std::string_view(m_buffer).substr(begin, end - begin - 1);
+}
+
+PathList::const_iterator PathList::begin() const noexcept
+{
+  return {this, 0};
+}
+
+PathList::const_iterator PathList::end() const noexcept
+{
+  return {this, m_offsets.size()};
+}
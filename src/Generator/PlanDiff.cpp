@@ -0,0 +1,236 @@
+#include "Nexpp/Generator/PlanDiff.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Nexpp/Generator/ContentHasher.h"
+#include "Nexpp/Generator/LockFile.h"
+
+namespace {
+constexpr std::size_t max_lcs_cells = 4 * 1024 * 1024;
+
+enum class Edit
+{
+  Keep,
+  Remove,
+  Add
+};
+
+struct Operation
+{
+  Edit        edit;
+  std::size_t before = 0;
+  std::size_t after  = 0;
+};
+
+std::vector<std::string_view> split_lines(std::string_view text)
+{
+  std::vector<std::string_view> lines;
+  while(!text.empty()) {
+    const std::size_t end = text.find('\n');
+    const std::size_t length =
+        end == std::string_view::npos ? text.size() : end + 1;
+    lines.push_back(text.substr(0, length));
+    text.remove_prefix(length);
+  }
+  return lines;
+}
+
+std::vector<Operation> diff_lines(
+    const std::vector<std::string_view> &before,
+    const std::vector<std::string_view> &after
+)
+{
+  std::size_t prefix = 0;
+  while(prefix < before.size() && prefix < after.size() &&
+        before[prefix] == after[prefix]) {
+    ++prefix;
+  }
+
+  std::size_t suffix = 0;
+  while(suffix < before.size() - prefix && suffix < after.size() - prefix &&
+        before[before.size() - 1 - suffix] == after[after.size() - 1 - suffix]
+  ) {
+    ++suffix;
+  }
+
+  const std::size_t      rows    = before.size() - prefix - suffix;
+  const std::size_t      columns = after.size() - prefix - suffix;
+
+  std::vector<Operation> operations;
+  for(std::size_t i = 0; i < prefix; ++i) {
+    operations.push_back({Edit::Keep, i, i});
+  }
+
+  if((rows + 1) * (columns + 1) <= max_lcs_cells) {
+    std::vector<std::uint32_t> lcs((rows + 1) * (columns + 1), 0);
+    const auto at = [&](std::size_t row,
+                        std::size_t column) -> std::uint32_t & {
+      return lcs[row * (columns + 1) + column];
+    };
+
+    for(std::size_t row = rows; row-- > 0;) {
+      for(std::size_t column = columns; column-- > 0;) {
+        at(row, column) =
+            before[prefix + row] == after[prefix + column]
+                ? at(row + 1, column + 1) + 1
+                : std::max(at(row + 1, column), at(row, column + 1));
+      }
+    }
+
+    std::size_t row    = 0;
+    std::size_t column = 0;
+    while(row < rows || column < columns) {
+      if(row < rows && column < columns &&
+         before[prefix + row] == after[prefix + column]) {
+        operations.push_back({Edit::Keep, prefix + row++, prefix + column++});
+      } else if(column < columns &&
+                (row == rows || at(row, column + 1) > at(row + 1, column))) {
+        operations.push_back({Edit::Add, prefix + row, prefix + column++});
+      } else {
+        operations.push_back({Edit::Remove, prefix + row++, prefix + column});
+      }
+    }
+  } else {
+    for(std::size_t row = 0; row < rows; ++row) {
+      operations.push_back({Edit::Remove, prefix + row, prefix});
+    }
+    for(std::size_t column = 0; column < columns; ++column) {
+      operations.push_back({Edit::Add, prefix + rows, prefix + column});
+    }
+  }
+
+  for(std::size_t i = 0; i < suffix; ++i) {
+    operations.push_back(
+        {Edit::Keep, before.size() - suffix + i, after.size() - suffix + i}
+    );
+  }
+
+  return operations;
+}
+
+void append_line(std::string &out, char marker, std::string_view line)
+{
+  out += marker;
+  out += line;
+  if(line.empty() || line.back() != '\n') {
+    out += "\n\\ No newline at end of file\n";
+  }
+}
+
+std::string hunk_range(std::size_t start, std::size_t length)
+{
+  return std::to_string(length == 0 ? start : start + 1) + "," +
+         std::to_string(length);
+}
+} // namespace
+
+std::string PlanDiff::project(
+    const std::filesystem::path &root, const ProjectPlan &plan,
+    const FileSystem &file_system
+)
+{
+  const bool     exists = file_system.exists(root);
+  const auto     lock_content =
+      exists ? file_system.read_file(root / LockFile::file_name) : std::nullopt;
+  const LockFile lock =
+      lock_content ? LockFile::parse(*lock_content) : LockFile();
+
+  std::string    out;
+
+  for(const auto &file : plan.files) {
+    const std::filesystem::path path = root / file.path;
+    const auto on_disk = exists ? file_system.read_file(path) : std::nullopt;
+
+    if(on_disk && *on_disk == std::string_view(file.content)) {
+      continue;
+    }
+
+    if(on_disk && ContentHasher::hash(*on_disk) != lock.find(file.path)) {
+      out += "# user-modified, would be kept: " + path.generic_string() + '\n';
+      continue;
+    }
+
+    out += unified(
+        on_disk.value_or(""), file.content,
+        on_disk ? "a/" + path.generic_string() : "/dev/null",
+        "b/" + path.generic_string()
+    );
+  }
+
+  return out;
+}
+
+std::string PlanDiff::unified(
+    std::string_view before, std::string_view after,
+    const std::string &before_label, const std::string &after_label,
+    std::size_t context
+)
+{
+  const auto before_lines = split_lines(before);
+  const auto after_lines  = split_lines(after);
+  const auto operations   = diff_lines(before_lines, after_lines);
+
+  std::string out;
+  std::size_t index = 0;
+
+  while(index < operations.size()) {
+    const auto change = std::find_if(
+        operations.begin() + static_cast<std::ptrdiff_t>(index),
+        operations.end(),
+        [](const Operation &operation) { return operation.edit != Edit::Keep; }
+    );
+    if(change == operations.end()) {
+      break;
+    }
+
+    const auto  first = static_cast<std::size_t>(change - operations.begin());
+    std::size_t begin = first > context ? first - context : 0;
+    std::size_t end   = first;
+    std::size_t kept  = 0;
+
+    while(end < operations.size() && kept <= 2 * context) {
+      kept = operations[end].edit == Edit::Keep ? kept + 1 : 0;
+      ++end;
+    }
+    if(kept > context) {
+      end -= kept - context;
+    }
+    begin = std::max(begin, index);
+
+    std::size_t before_count = 0;
+    std::size_t after_count  = 0;
+    for(std::size_t i = begin; i < end; ++i) {
+      if(operations[i].edit != Edit::Add) {
+        ++before_count;
+      }
+      if(operations[i].edit != Edit::Remove) {
+        ++after_count;
+      }
+    }
+
+    if(out.empty()) {
+      out += "--- " + before_label + '\n';
+      out += "+++ " + after_label + '\n';
+    }
+    out += "@@ -" + hunk_range(operations[begin].before, before_count) +
+           " +" + hunk_range(operations[begin].after, after_count) + " @@\n";
+
+    for(std::size_t i = begin; i < end; ++i) {
+      const Operation &operation = operations[i];
+      if(operation.edit == Edit::Keep) {
+        append_line(out, ' ', before_lines[operation.before]);
+      } else if(operation.edit == Edit::Remove) {
+        append_line(out, '-', before_lines[operation.before]);
+      } else {
+        append_line(out, '+', after_lines[operation.after]);
+      }
+    }
+
+    index = end;
+  }
+
+  return out;
+}
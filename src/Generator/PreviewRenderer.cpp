@@ -0,0 +1,171 @@
+#include "Nexpp/Generator/PreviewRenderer.h"
+
+#include "Nexpp/Trace/Trace.h"
+
+namespace {
+enum PreviewSlot : std::size_t
+{
+  Config,
+  Main,
+  Presets,
+  PgoModule,
+  FixedFiles
+};
+
+// The preview plans cmake/Pgo.cmake, so its configuration includes it.
+constexpr bool pgo_module = true;
+
+constexpr SpecFields main_dependencies = SpecField::Name | SpecField::Modules;
+constexpr SpecFields presets_dependencies =
+    SpecField::Name | SpecField::Compiler | SpecField::Toolchain;
+constexpr SpecFields layout_dependencies =
+    SpecField::Name | SpecField::Libraries | SpecField::Modules;
+
+// With modules, the layout files are the interface, the partition and then
+// the comparison script, whose command line repeats the remaining options.
+constexpr std::size_t comparison_slot = FixedFiles + 2;
+constexpr SpecFields  comparison_dependencies =
+    SpecField::Standard | SpecField::Flags | SpecField::Perf |
+    SpecField::Compiler | SpecField::Toolchain;
+} // namespace
+
+const ProjectPlan &PreviewRenderer::update(const ProjectSpec &spec)
+{
+  NEXPP_TRACE_SCOPE("PreviewRenderer::update", spec.name);
+
+  const SpecFields changed =
+      m_spec ? changed_fields(*m_spec, spec) : all_fields;
+
+  m_rendered = 0;
+  if(changed == 0) {
+    return m_plan;
+  }
+
+  m_spec = spec;
+  if(m_plan.files.empty()) {
+    m_plan.files.resize(FixedFiles);
+    m_plan.files[Config].path    = "CMakeLists.txt";
+    m_plan.files[Main].path      = "src/main.cpp";
+    m_plan.files[Presets].path   = "CMakePresets.json";
+    m_plan.files[PgoModule].path = "cmake/Pgo.cmake";
+  }
+
+  render_files(changed);
+  render_segments(changed);
+  return m_plan;
+}
+
+const ProjectPlan &PreviewRenderer::plan() const
+{
+  return m_plan;
+}
+
+std::size_t PreviewRenderer::rendered_parts() const
+{
+  return m_rendered;
+}
+
+void PreviewRenderer::render_segments(SpecFields changed)
+{
+  bool dirty = false;
+  for(std::size_t index = 0; index < segment_count; ++index) {
+    const auto segment = static_cast<ConfigSegment>(index);
+    if(changed != all_fields &&
+       (CMakeBase::segment_dependencies(segment) & changed) == 0) {
+      continue;
+    }
+
+    m_segments[index] =
+        m_cmake_base.setup_segment(segment, *m_spec, m_headers, pgo_module);
+    dirty = true;
+    ++m_rendered;
+  }
+
+  if(dirty) {
+    assemble_config();
+  }
+}
+
+void PreviewRenderer::render_files(SpecFields changed)
+{
+  const ProjectSpec &spec = *m_spec;
+
+  if((changed & main_dependencies) != 0) {
+    m_plan.files[Main].content =
+        spec.modules ? m_source_base.setup_module_main(spec.name)
+                     : m_source_base.setup_main(spec.name);
+    m_headers = SourceBase::standard_headers(m_plan.files[Main].content);
+    m_plan.files[PgoModule].content = m_cmake_base.setup_pgo_module(spec);
+    m_rendered += 2;
+  }
+
+  if((changed & presets_dependencies) != 0) {
+    m_plan.files[Presets].content = m_cmake_base.setup_presets(spec);
+    ++m_rendered;
+  }
+
+  if((changed & layout_dependencies) == 0) {
+    if(spec.modules && (changed & comparison_dependencies) != 0) {
+      m_plan.files[comparison_slot].content =
+          m_cmake_base.setup_layout_comparison(spec);
+      ++m_rendered;
+    }
+    return;
+  }
+
+  m_plan.folders = {"src", "include", "cmake"};
+  m_plan.files.resize(FixedFiles);
+
+  if(spec.modules) {
+    m_plan.files.emplace_back(
+        std::pmr::string("src/" + spec.name + ".cppm"),
+        std::pmr::string(m_source_base.setup_module_interface(spec.name))
+    );
+    m_plan.files.emplace_back(
+        std::pmr::string("src/" + spec.name + "-greeting.cppm"),
+        std::pmr::string(m_source_base.setup_module_partition(spec.name))
+    );
+    m_plan.files.emplace_back(
+        "cmake/CompareLayouts.cmake",
+        std::pmr::string(m_cmake_base.setup_layout_comparison(spec))
+    );
+    m_rendered += 3;
+  }
+
+  if(spec.has_library("gtest")) {
+    m_plan.folders.emplace_back("tests");
+    m_plan.files.emplace_back(
+        std::pmr::string("tests/" + spec.name + "_test.cpp"),
+        std::pmr::string(m_source_base.setup_test())
+    );
+    m_plan.files.emplace_back(
+        "cmake/Dependencies.cmake",
+        std::pmr::string(m_cmake_base.setup_dependencies_module())
+    );
+    m_rendered += 2;
+  }
+
+  if(spec.has_library("benchmark")) {
+    m_plan.folders.emplace_back("bench");
+    m_plan.files.emplace_back(
+        std::pmr::string("bench/" + spec.name + "_bench.cpp"),
+        std::pmr::string(m_source_base.setup_benchmark())
+    );
+    ++m_rendered;
+  }
+}
+
+void PreviewRenderer::assemble_config()
+{
+  std::size_t size = 0;
+  for(const auto &segment : m_segments) {
+    size += segment.size();
+  }
+
+  std::pmr::string &config = m_plan.files[Config].content;
+  config.clear();
+  config.reserve(size);
+  for(const auto &segment : m_segments) {
+    config += segment;
+  }
+}
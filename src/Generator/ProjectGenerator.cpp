@@ -0,0 +1,653 @@
+#include "Nexpp/Generator/ProjectGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+#include "Nexpp/FileSystem/FileSystemBackend.h"
+#include "Nexpp/FileSystem/StagedWriter.h"
+#include "Nexpp/Generator/ContentHasher.h"
+#include "Nexpp/Generator/JobArena.h"
+#include "Nexpp/Generator/LockFile.h"
+#include "Nexpp/Stats/RunStats.h"
+#include "Nexpp/Trace/Trace.h"
+
+namespace {
+constexpr std::size_t max_planned_files = 10;
+
+FileSystemBackend &thread_backend(IoBackend kind)
+{
+  thread_local std::array<std::unique_ptr<FileSystemBackend>, 2> backends;
+
+  auto &backend = backends[static_cast<std::size_t>(kind)];
+  if(!backend) {
+    backend = make_file_system_backend(kind);
+  }
+  return *backend;
+}
+
+void create_folders(FileSystem &file_system, std::filesystem::path path)
+{
+  if(!path.has_filename()) {
+    path = path.parent_path();
+  }
+  if(path.empty() || file_system.exists(path)) {
+    return;
+  }
+
+  create_folders(file_system, path.parent_path());
+  file_system.create_folder(path.parent_path(), path.filename().string());
+}
+
+void write_layout(
+    FileSystem &file_system, const std::filesystem::path &root,
+    const LayoutTree &layout
+)
+{
+  create_folders(file_system, root);
+
+  layout.for_each([&](const auto &path, const LayoutNode &node) {
+    switch(node.kind) {
+    case LayoutKind::Folder:
+      create_folders(file_system, root / path);
+      break;
+    case LayoutKind::File:
+      file_system.put_in_file(root / path, node.content);
+      break;
+    case LayoutKind::Symlink:
+      file_system.create_symlink(node.content, root / path);
+      break;
+    case LayoutKind::Clone:
+      throw std::logic_error("Skeleton clones are only written to disk");
+    }
+  });
+}
+
+void check_layout(const ProjectSpec &spec)
+{
+  if(spec.modules && spec.standard < Standard::CPP20) {
+    throw std::runtime_error(
+        "C++20 modules need the C++20 or C++23 standard: " + spec.name
+    );
+  }
+}
+
+// Concatenates the parts of a planned path inside the arena.
+std::pmr::string plan_path(
+    std::pmr::memory_resource              *resource,
+    std::initializer_list<std::string_view> parts
+)
+{
+  std::size_t size = 0;
+  for(const std::string_view part : parts) {
+    size += part.size();
+  }
+
+  std::pmr::string path(resource);
+  path.reserve(size);
+  for(const std::string_view part : parts) {
+    path += part;
+  }
+  return path;
+}
+
+template<typename Write>
+std::pmr::string &plan_file(
+    ProjectPlan &plan, std::initializer_list<std::string_view> path,
+    Write write
+)
+{
+  std::pmr::memory_resource *resource = plan.files.get_allocator().resource();
+  PlannedFile               &file     = plan.files.emplace_back(
+      plan_path(resource, path), std::pmr::string(resource)
+  );
+  PmrStringSink sink(file.content);
+  write(sink);
+  return file.content;
+}
+
+std::pmr::string
+    serialize_lock(const LockFile &lock, std::pmr::memory_resource *resource)
+{
+  std::pmr::string content(resource);
+  PmrStringSink    sink(content);
+  lock.write_to(sink);
+  return content;
+}
+
+LayoutTree layout_of(
+    ProjectPlan plan, const Skeleton *skeleton = nullptr,
+    std::string_view project_name = {}
+)
+{
+  std::pmr::memory_resource *resource = plan.files.get_allocator().resource();
+  LayoutTree                 layout(resource);
+  LockFile                   lock(resource);
+
+  for(const auto &folder : plan.folders) {
+    layout.add_folder(folder);
+  }
+
+  for(auto &file : plan.files) {
+    const std::uint64_t hash = ContentHasher::hash(file.content);
+    lock.set(file.path, hash);
+
+    const auto source =
+        skeleton ? skeleton->find(file.path, project_name, hash) : std::nullopt;
+    if(source) {
+      layout.add_clone(file.path, *source);
+    } else {
+      layout.add_file(file.path, std::move(file.content));
+    }
+  }
+
+  layout.add_file(LockFile::file_name, serialize_lock(lock, resource));
+  return layout;
+}
+
+// The workspace root provides what any component needs: the newest standard,
+// every library and each enabled flag or optimization. Components still only
+// use the ones their own spec enables.
+ProjectSpec workspace_settings(const WorkspaceSpec &workspace)
+{
+  if(workspace.name.empty()) {
+    throw std::runtime_error("Workspace name is required !");
+  }
+
+  if(workspace.projects.empty()) {
+    throw std::runtime_error("Workspace has no projects: " + workspace.name);
+  }
+
+  const ProjectSpec &first = workspace.projects.front();
+  ProjectSpec        settings;
+  settings.name        = workspace.name;
+  settings.destination = workspace.destination;
+  settings.standard    = first.standard;
+  settings.compiler    = first.compiler;
+  settings.toolchain   = first.toolchain;
+
+  const auto &projects = workspace.projects;
+  for(auto project = projects.begin(); project != projects.end(); ++project) {
+    if(project->name.empty()) {
+      throw std::runtime_error("Project name is required !");
+    }
+    check_layout(*project);
+
+    if(project->name == "cmake" || project->name == "common" ||
+       std::any_of(projects.begin(), project, [&](const ProjectSpec &other) {
+         return other.name == project->name;
+       })) {
+      throw std::runtime_error(
+          "Conflicting workspace component: " + project->name
+      );
+    }
+
+    // Distinct names such as "My-App" and "my_app" map to one module name.
+    if(project->modules &&
+       std::any_of(projects.begin(), project, [&](const ProjectSpec &other) {
+         return other.modules && SourceBase::module_name(other.name) ==
+                                     SourceBase::module_name(project->name);
+       })) {
+      throw std::runtime_error(
+          "Conflicting module name for workspace component: " + project->name
+      );
+    }
+
+    settings.standard   = std::max(settings.standard, project->standard);
+    settings.has_flags  = settings.has_flags || project->has_flags;
+    settings.perf.ipo   = settings.perf.ipo || project->perf.ipo;
+    settings.perf.unity = settings.perf.unity || project->perf.unity;
+    settings.perf.pch   = settings.perf.pch || project->perf.pch;
+
+    for(const auto &library : project->libraries) {
+      if(!settings.has_library(library)) {
+        settings.libraries.push_back(library);
+      }
+    }
+  }
+
+  return settings;
+}
+
+void throw_if_cancelled(const GenerationControl *control)
+{
+  if(control != nullptr && control->is_cancelled()) {
+    throw std::runtime_error("Generation cancelled");
+  }
+}
+} // namespace
+
+ProjectGenerator::ProjectGenerator(GenerationOptions options)
+    : m_options(std::move(options))
+{
+  if(!m_options.skeleton_cache.empty()) {
+    m_skeletons = std::make_shared<SkeletonCache>(m_options.skeleton_cache);
+  }
+}
+
+ProjectGenerator::ProjectGenerator(
+    GenerationOptions options, FileSystem &file_system
+)
+    : m_options(std::move(options)), m_file_system(&file_system)
+{
+}
+
+GenerationReport ProjectGenerator::generate(
+    const ProjectSpec &spec, GenerationControl *control
+) const
+{
+  NEXPP_TRACE_SCOPE("ProjectGenerator::generate", spec.name);
+  const LatencyTimer    timer(StatLatency::Project);
+  const JobArena::Scope arena;
+
+  if(spec.name.empty()) {
+    throw std::runtime_error("Project name is required !");
+  }
+
+  throw_if_cancelled(control);
+
+  std::filesystem::path root = spec.destination / spec.name;
+  ProjectPlan           plan = render(spec);
+
+  if(exists(root)) {
+    return update_project(std::move(root), std::move(plan), control);
+  }
+  return create_project(std::move(root), std::move(plan), &spec, control);
+}
+
+GenerationReport ProjectGenerator::generate_workspace(
+    const WorkspaceSpec &workspace, GenerationControl *control
+) const
+{
+  NEXPP_TRACE_SCOPE("ProjectGenerator::generate_workspace", workspace.name);
+  const LatencyTimer    timer(StatLatency::Project);
+  const JobArena::Scope arena;
+
+  throw_if_cancelled(control);
+
+  std::filesystem::path root = workspace.destination / workspace.name;
+  ProjectPlan           plan = render_workspace(workspace);
+
+  if(exists(root)) {
+    return update_project(std::move(root), std::move(plan), control);
+  }
+  return create_project(std::move(root), std::move(plan), nullptr, control);
+}
+
+ProjectPlan ProjectGenerator::render(const ProjectSpec &spec) const
+{
+  NEXPP_TRACE_SCOPE("ProjectGenerator::render", spec.name);
+  const LatencyTimer timer(StatLatency::Render);
+
+  check_layout(spec);
+
+  std::pmr::memory_resource *arena = JobArena::current();
+  ProjectPlan                 plan {
+      std::pmr::vector<std::pmr::string>(arena),
+      std::pmr::vector<PlannedFile>(arena)
+  };
+  plan.folders = {"src", "include", "cmake"};
+  plan.files.reserve(max_planned_files);
+
+  std::pmr::string &config =
+      plan_file(plan, {"CMakeLists.txt"}, [](auto &) {});
+  const std::pmr::string &main_source = plan_file(
+      plan, {"src/main.cpp"},
+      [&](OutputSink &sink) {
+        if(spec.modules) {
+          m_source_base.write_module_main(sink, spec.name);
+        } else {
+          m_source_base.write_main(sink, spec.name);
+        }
+      }
+  );
+
+  // Every project gets cmake/Pgo.cmake below, so its configuration includes
+  // the module.
+  constexpr bool pgo_module = true;
+  PmrStringSink  config_sink(config);
+  m_cmake_base.write_config(
+      config_sink, spec, SourceBase::standard_headers(main_source), pgo_module
+  );
+
+  plan_file(plan, {"CMakePresets.json"}, [&](OutputSink &sink) {
+    m_cmake_base.write_presets(sink, spec);
+  });
+  plan_file(plan, {"cmake/Pgo.cmake"}, [&](OutputSink &sink) {
+    m_cmake_base.write_pgo_module(sink, spec);
+  });
+
+  if(spec.modules) {
+    plan_file(plan, {"src/", spec.name, ".cppm"}, [&](OutputSink &sink) {
+      m_source_base.write_module_interface(sink, spec.name);
+    });
+    plan_file(
+        plan, {"src/", spec.name, "-greeting.cppm"},
+        [&](OutputSink &sink) {
+          m_source_base.write_module_partition(sink, spec.name);
+        }
+    );
+    plan_file(
+        plan, {"cmake/CompareLayouts.cmake"},
+        [&](OutputSink &sink) {
+          m_cmake_base.write_layout_comparison(sink, spec);
+        }
+    );
+  }
+
+  if(spec.has_library("gtest")) {
+    plan.folders.emplace_back("tests");
+    plan_file(plan, {"tests/", spec.name, "_test.cpp"}, [&](OutputSink &sink) {
+      m_source_base.write_test(sink);
+    });
+    plan_file(
+        plan, {"cmake/Dependencies.cmake"},
+        [&](OutputSink &sink) { m_cmake_base.write_dependencies_module(sink); }
+    );
+  }
+
+  if(spec.has_library("benchmark")) {
+    plan.folders.emplace_back("bench");
+    plan_file(
+        plan, {"bench/", spec.name, "_bench.cpp"},
+        [&](OutputSink &sink) { m_source_base.write_benchmark(sink); }
+    );
+  }
+  return plan;
+}
+
+ProjectPlan
+    ProjectGenerator::render_workspace(const WorkspaceSpec &workspace) const
+{
+  NEXPP_TRACE_SCOPE("ProjectGenerator::render_workspace", workspace.name);
+  const LatencyTimer timer(StatLatency::Render);
+
+  const ProjectSpec          settings = workspace_settings(workspace);
+
+  std::pmr::memory_resource *arena    = JobArena::current();
+  ProjectPlan                plan {
+      std::pmr::vector<std::pmr::string>(arena),
+      std::pmr::vector<PlannedFile>(arena)
+  };
+  plan.files.reserve(3 + 6 * workspace.projects.size());
+
+  std::pmr::string &config =
+      plan_file(plan, {"CMakeLists.txt"}, [](auto &) {});
+  std::vector<std::string> headers;
+  std::vector<std::size_t> components;
+
+  for(const auto &project : workspace.projects) {
+    const std::string_view component = project.name;
+    plan.folders.push_back(plan_path(arena, {component}));
+    plan.folders.push_back(plan_path(arena, {component, "/src"}));
+    plan.folders.push_back(plan_path(arena, {component, "/include"}));
+
+    components.push_back(plan.files.size());
+    plan_file(plan, {component, "/CMakeLists.txt"}, [](auto &) {});
+    const std::pmr::string &main_source = plan_file(
+        plan, {component, "/src/main.cpp"},
+        [&](OutputSink &sink) {
+          if(project.modules) {
+            m_source_base.write_module_main(sink, project.name);
+          } else {
+            m_source_base.write_main(sink, project.name);
+          }
+        }
+    );
+
+    for(auto &header : SourceBase::standard_headers(main_source)) {
+      if(std::find(headers.begin(), headers.end(), header) == headers.end()) {
+        headers.push_back(std::move(header));
+      }
+    }
+
+    if(project.modules) {
+      plan_file(
+          plan, {component, "/src/", project.name, ".cppm"},
+          [&](OutputSink &sink) {
+            m_source_base.write_module_interface(sink, project.name);
+          }
+      );
+      plan_file(
+          plan, {component, "/src/", project.name, "-greeting.cppm"},
+          [&](OutputSink &sink) {
+            m_source_base.write_module_partition(sink, project.name);
+          }
+      );
+    }
+
+    if(project.has_library("gtest")) {
+      plan.folders.push_back(plan_path(arena, {component, "/tests"}));
+      plan_file(
+          plan, {component, "/tests/", project.name, "_test.cpp"},
+          [&](OutputSink &sink) { m_source_base.write_test(sink); }
+      );
+    }
+
+    if(project.has_library("benchmark")) {
+      plan.folders.push_back(plan_path(arena, {component, "/bench"}));
+      plan_file(
+          plan, {component, "/bench/", project.name, "_bench.cpp"},
+          [&](OutputSink &sink) { m_source_base.write_benchmark(sink); }
+      );
+    }
+  }
+
+  PmrStringSink config_sink(config);
+  m_cmake_base.write_workspace_config(
+      config_sink, settings, workspace.projects, headers
+  );
+
+  for(std::size_t i = 0; i < components.size(); ++i) {
+    PmrStringSink sink(plan.files[components[i]].content);
+    m_cmake_base.write_component_config(
+        sink, workspace.projects[i], settings, headers
+    );
+  }
+
+  if(settings.has_library("gtest")) {
+    plan.folders.emplace_back("cmake");
+    plan_file(
+        plan, {"cmake/Dependencies.cmake"},
+        [&](OutputSink &sink) { m_cmake_base.write_dependencies_module(sink); }
+    );
+  }
+
+  if(settings.perf.pch && !headers.empty()) {
+    plan.folders.emplace_back("common");
+    plan_file(plan, {"common/pch.cpp"}, [&](OutputSink &sink) {
+      m_source_base.write_pch_source(sink);
+    });
+  }
+  return plan;
+}
+
+LayoutTree ProjectGenerator::layout(const ProjectSpec &spec) const
+{
+  return layout_of(render(spec));
+}
+
+void ProjectGenerator::archive(
+    const ProjectSpec &spec, ArchiveWriter &writer
+) const
+{
+  if(spec.name.empty()) {
+    throw std::runtime_error("Project name is required !");
+  }
+
+  const std::filesystem::path root = spec.name;
+  const ProjectPlan           plan = render(spec);
+  LockFile                    lock;
+
+  writer.add_folder(root);
+  for(const auto &folder : plan.folders) {
+    writer.add_folder(root / folder);
+  }
+
+  for(const auto &file : plan.files) {
+    lock.set(file.path, ContentHasher::hash(file.content));
+    writer.add_file(root / file.path, file.content);
+  }
+
+  writer.add_file(root / LockFile::file_name, lock.serialize());
+}
+
+GenerationReport ProjectGenerator::create_project(
+    std::filesystem::path root, ProjectPlan plan, const ProjectSpec *spec,
+    GenerationControl *control
+) const
+{
+  GenerationReport report;
+  report.root = std::move(root);
+
+  std::size_t path_bytes = 0;
+  for(const auto &file : plan.files) {
+    path_bytes += file.path.size();
+  }
+
+  report.written.reserve(plan.files.size(), path_bytes);
+  for(const auto &file : plan.files) {
+    report.written.push_back(file.path);
+  }
+
+  std::shared_ptr<const Skeleton> skeleton;
+  if(m_skeletons && m_file_system == nullptr && spec != nullptr) {
+    skeleton = m_skeletons->acquire(*spec, [this](const ProjectSpec &sentinel) {
+      return render(sentinel);
+    });
+    // Without shared extents a clone is a copy that costs more than a write.
+    if(!skeleton->reflinks()) {
+      skeleton.reset();
+    }
+  }
+
+  const LayoutTree layout = layout_of(
+      std::move(plan), skeleton.get(),
+      spec != nullptr ? std::string_view(spec->name) : std::string_view()
+  );
+  publish(report.root, layout, report, control);
+
+  return report;
+}
+
+GenerationReport ProjectGenerator::update_project(
+    std::filesystem::path root, ProjectPlan plan, GenerationControl *control
+) const
+{
+  GenerationReport report;
+  report.root = std::move(root);
+
+  std::pmr::memory_resource *resource = plan.files.get_allocator().resource();
+  const LockFile             previous = load_lock(report.root);
+  LockFile                   lock     = previous;
+  std::pmr::vector<PlannedFile *> changes(resource);
+
+  for(auto &file : plan.files) {
+    const std::uint64_t rendered = ContentHasher::hash(file.content);
+    const auto          on_disk  = hash_existing(report.root / file.path);
+    const auto          locked   = previous.find(file.path);
+
+    if(on_disk == rendered) {
+      lock.set(file.path, rendered);
+      report.unchanged.push_back(file.path);
+    } else if(!on_disk || on_disk == locked) {
+      lock.set(file.path, rendered);
+      changes.push_back(&file);
+      report.written.push_back(file.path);
+    } else {
+      report.conflicts.push_back(file.path);
+    }
+  }
+
+  const bool write_lock =
+      lock != previous || !exists(report.root / LockFile::file_name);
+  if(changes.empty() && !write_lock) {
+    return report;
+  }
+
+  LayoutTree layout(resource);
+  for(const auto &folder : plan.folders) {
+    layout.add_folder(folder);
+  }
+
+  for(PlannedFile *file : changes) {
+    layout.add_file(file->path, std::move(file->content));
+  }
+
+  if(write_lock) {
+    layout.add_file(LockFile::file_name, serialize_lock(lock, resource));
+  }
+
+  publish(report.root, layout, report, control);
+
+  return report;
+}
+
+void ProjectGenerator::publish(
+    const std::filesystem::path &root, const LayoutTree &layout,
+    const GenerationReport &report, GenerationControl *control
+) const
+{
+  if(m_file_system != nullptr) {
+    throw_if_cancelled(control);
+    write_layout(*m_file_system, root, layout);
+  } else {
+    StagedWriter writer(
+        root, m_options.sync_policy, thread_backend(m_options.io_backend),
+        JobArena::current()
+    );
+    writer.write_layout(layout);
+    throw_if_cancelled(control);
+    writer.commit();
+  }
+
+  if(control != nullptr) {
+    control->files_written.fetch_add(
+        report.written.size(), std::memory_order_relaxed
+    );
+  }
+}
+
+bool ProjectGenerator::exists(const std::filesystem::path &path) const
+{
+  return m_file_system != nullptr ? m_file_system->exists(path)
+                                  : std::filesystem::exists(path);
+}
+
+std::optional<std::uint64_t>
+    ProjectGenerator::hash_existing(const std::filesystem::path &path) const
+{
+  NEXPP_TRACE_SCOPE("ProjectGenerator::hash_existing", path.native());
+
+  if(m_file_system != nullptr) {
+    const auto content = m_file_system->read_file(path);
+    return content ? std::optional(ContentHasher::hash(*content))
+                   : std::nullopt;
+  }
+
+  std::ifstream ifs(path, std::ios::binary);
+  if(!ifs) {
+    return std::nullopt;
+  }
+
+  const std::string content(
+      (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+  );
+  return ContentHasher::hash(content);
+}
+
+LockFile ProjectGenerator::load_lock(const std::filesystem::path &root) const
+{
+  if(m_file_system == nullptr) {
+    return LockFile::load(root);
+  }
+
+  const auto content = m_file_system->read_file(root / LockFile::file_name);
+  return content ? LockFile::parse(*content) : LockFile();
+}
@@ -0,0 +1,235 @@
+#include "Nexpp/Generator/SkeletonCache.h"
+
+#include <algorithm>
+#include <charconv>
+#include <utility>
+
+#include "Nexpp/FileSystem/FileCloner.h"
+#include "Nexpp/FileSystem/LayoutTree.h"
+#include "Nexpp/FileSystem/StagedWriter.h"
+#include "Nexpp/Generator/ContentHasher.h"
+#include "Nexpp/Generator/LockFile.h"
+#include "Nexpp/Trace/Trace.h"
+
+namespace {
+constexpr std::string_view first_sentinel  = "nexpp_skeleton_a";
+constexpr std::string_view second_sentinel = "nexpp_skeleton_b";
+
+std::string pattern_of(std::string_view path, std::string_view sentinel)
+{
+  std::string pattern(path);
+  for(std::size_t found = pattern.find(sentinel); found != std::string::npos;
+      found = pattern.find(sentinel, found + Skeleton::name_token.size())) {
+    pattern.replace(found, sentinel.size(), Skeleton::name_token);
+  }
+  return pattern;
+}
+
+bool matches_pattern(
+    std::string_view pattern, std::string_view project_name,
+    std::string_view path
+)
+{
+  const std::size_t token = pattern.find(Skeleton::name_token);
+  if(token == std::string_view::npos) {
+    return pattern == path;
+  }
+
+  const std::string_view prefix = pattern.substr(0, token);
+  const std::string_view suffix =
+      pattern.substr(token + Skeleton::name_token.size());
+  return path.size() == prefix.size() + project_name.size() + suffix.size() &&
+         path.starts_with(prefix) && path.ends_with(suffix) &&
+         path.substr(prefix.size(), project_name.size()) == project_name;
+}
+
+void hash_field(ContentHasher &hasher, std::string_view value)
+{
+  hasher.update(value);
+  hasher.update(std::string_view("\0", 1));
+}
+
+std::string directory_name(std::uint64_t key)
+{
+  char       digits[16];
+  const auto result = std::to_chars(digits, digits + sizeof(digits), key, 16);
+  const auto length = static_cast<std::size_t>(result.ptr - digits);
+
+  std::string name(sizeof(digits) - length, '0');
+  name.append(digits, length);
+  return name;
+}
+
+// Renders the spec under both sentinel names and keeps the files whose path
+// and content only differ by that name, sorted by pattern like a manifest.
+std::vector<Skeleton::File> render_skeleton(
+    const ProjectSpec &spec, const SkeletonCache::Renderer &render,
+    LayoutTree &layout
+)
+{
+  ProjectSpec first  = spec;
+  ProjectSpec second = spec;
+  first.name         = first_sentinel;
+  second.name        = second_sentinel;
+
+  const ProjectPlan first_plan  = render(first);
+  const ProjectPlan second_plan = render(second);
+
+  std::vector<Skeleton::File> files;
+  for(std::size_t i = 0;
+      i < first_plan.files.size() && i < second_plan.files.size(); ++i) {
+    const PlannedFile &file    = first_plan.files[i];
+    const PlannedFile &other   = second_plan.files[i];
+    std::string        pattern = pattern_of(file.path, first_sentinel);
+
+    if(file.content != other.content ||
+       pattern != pattern_of(other.path, second_sentinel)) {
+      continue;
+    }
+
+    layout.add_file(pattern, file.content);
+    files.push_back({std::move(pattern), ContentHasher::hash(file.content)});
+  }
+
+  std::ranges::sort(files, {}, &Skeleton::File::pattern);
+  return files;
+}
+} // namespace
+
+Skeleton::Skeleton(
+    std::filesystem::path directory, std::vector<File> files, bool reflinks
+)
+    : m_directory(std::move(directory)), m_files(std::move(files)),
+      m_reflinks(reflinks)
+{
+}
+
+const std::filesystem::path &Skeleton::directory() const
+{
+  return m_directory;
+}
+
+const std::vector<Skeleton::File> &Skeleton::files() const
+{
+  return m_files;
+}
+
+bool Skeleton::reflinks() const
+{
+  return m_reflinks;
+}
+
+std::optional<std::filesystem::path> Skeleton::find(
+    std::string_view path, std::string_view project_name, std::uint64_t hash
+) const
+{
+  for(const auto &file : m_files) {
+    if(file.hash == hash && matches_pattern(file.pattern, project_name, path)) {
+      return m_directory / file.pattern;
+    }
+  }
+  return std::nullopt;
+}
+
+SkeletonCache::SkeletonCache(std::filesystem::path root)
+    : m_root(std::move(root))
+{
+}
+
+const std::filesystem::path &SkeletonCache::root() const
+{
+  return m_root;
+}
+
+std::filesystem::path SkeletonCache::directory(const ProjectSpec &spec) const
+{
+  return m_root / directory_name(key(spec));
+}
+
+std::shared_ptr<const Skeleton> SkeletonCache::acquire(
+    const ProjectSpec &spec, const Renderer &render
+)
+{
+  const std::uint64_t   combination = key(spec);
+  const std::lock_guard lock(m_mutex);
+
+  auto &skeleton = m_skeletons[combination];
+  if(!skeleton) {
+    const std::filesystem::path location =
+        m_root / directory_name(combination);
+
+    LayoutTree                  layout;
+    std::vector<Skeleton::File> files = render_skeleton(spec, render, layout);
+
+    // A skeleton stored by a build with other templates no longer matches.
+    skeleton = load(location);
+    if(!skeleton || skeleton->files() != files) {
+      skeleton = store(location, layout, std::move(files));
+    }
+  }
+  return skeleton;
+}
+
+std::uint64_t SkeletonCache::key(const ProjectSpec &spec)
+{
+  ContentHasher hasher;
+  hash_field(hasher, to_string_view(spec.standard));
+  hash_field(hasher, std::to_string(spec.libraries.size()));
+  for(const auto &library : spec.libraries) {
+    hash_field(hasher, library);
+  }
+
+  const char options[] = {
+      spec.has_flags ? '1' : '0', spec.perf.ipo ? '1' : '0',
+      spec.perf.unity ? '1' : '0', spec.perf.pch ? '1' : '0',
+      spec.modules ? '1' : '0',
+      static_cast<char>('0' + static_cast<int>(spec.compiler))
+  };
+  hash_field(hasher, std::string_view(options, sizeof(options)));
+
+  hash_field(hasher, spec.toolchain.compiler);
+  hash_field(hasher, spec.toolchain.launcher);
+  hash_field(hasher, spec.toolchain.linker);
+  return hasher.digest();
+}
+
+std::shared_ptr<const Skeleton>
+    SkeletonCache::load(const std::filesystem::path &directory)
+{
+  if(!std::filesystem::exists(directory / LockFile::file_name)) {
+    return nullptr;
+  }
+
+  const LockFile              manifest = LockFile::load(directory);
+  std::vector<Skeleton::File> files;
+  for(const auto &[pattern, hash] : manifest.entries()) {
+    files.push_back({std::string(pattern), hash});
+  }
+  return std::make_shared<const Skeleton>(
+      directory, std::move(files),
+      FileCloner::supports_reflink(directory.c_str())
+  );
+}
+
+std::shared_ptr<const Skeleton> SkeletonCache::store(
+    const std::filesystem::path &directory, const LayoutTree &layout,
+    std::vector<Skeleton::File> files
+)
+{
+  NEXPP_TRACE_SCOPE("SkeletonCache::store", directory.native());
+
+  LockFile manifest;
+  for(const auto &file : files) {
+    manifest.set(file.pattern, file.hash);
+  }
+
+  StagedWriter writer(directory, SyncPolicy::PerProject);
+  writer.write_layout(layout);
+  writer.write_file(LockFile::file_name, manifest.serialize());
+  writer.commit();
+
+  return std::make_shared<const Skeleton>(
+      directory, std::move(files),
+      FileCloner::supports_reflink(directory.c_str())
+  );
+}
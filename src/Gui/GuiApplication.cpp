@@ -0,0 +1,25 @@
+#include "Nexpp/Gui/GuiApplication.h"
+#include "Nexpp/CommandLine/CommandLine.h"
+#include "Nexpp/Gui/MainWindow.h"
+
+#include <QApplication>
+#include <QFile>
+
+int nexpp_run_gui(int &argc, char **argv)
+{
+  QApplication app(argc, argv);
+  QApplication::setApplicationName("Nexpp");
+  QApplication::setApplicationVersion("0.0.1");
+
+  CommandLine command_line(app);
+
+  QFile       style_sheet(":/resources/styles.qss");
+  if(style_sheet.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    app.setStyleSheet(QString::fromUtf8(style_sheet.readAll()));
+  }
+
+  MainWindow window(command_line);
+  window.show();
+
+  return app.exec();
+}
@@ -0,0 +1,361 @@
+#include "Nexpp/Gui/MainWindow.h"
+
+#include <QFileDialog>
+#include <QFormLayout>
+#include <QHBoxLayout>
+#include <QSignalBlocker>
+#include <QStringList>
+#include <QVBoxLayout>
+#include <exception>
+#include <stdexcept>
+
+#include "Nexpp/Batch/Manifest.h"
+#include "Nexpp/Toolchain/ToolchainProbe.h"
+#include "Nexpp/Types/Library.h"
+
+namespace {
+// Progress is polled at display rate instead of signalled per file, so a
+// 1k-project batch costs the UI thread one cheap update per frame.
+constexpr int refresh_interval_ms = 16;
+
+// The preview follows typing once the user pauses; a rerender only touches
+// the template segments that depend on the edited field.
+constexpr int preview_debounce_ms = 40;
+
+QString       describe(const BatchResult &result)
+{
+  QString line = QString::fromStdString(result.project_name);
+  if(!result.success) {
+    return line + " - failed: " + QString::fromStdString(result.error);
+  }
+
+  return line + " - " + QString::number(result.report.written.size()) +
+         " written, " + QString::number(result.report.unchanged.size()) +
+         " unchanged";
+}
+
+QHBoxLayout *with_browse_button(QLineEdit *line_edit, QPushButton *button)
+{
+  auto *row = new QHBoxLayout;
+  row->addWidget(line_edit, 1);
+  row->addWidget(button);
+  return row;
+}
+} // namespace
+
+MainWindow::MainWindow(const CommandLine &command_line, QWidget *parent)
+    : QWidget(parent),
+      m_generator(
+          command_line.get_jobs(), command_line.get_generation_options()
+      ),
+      m_defaults(command_line.get_project_spec()),
+      m_probe_toolchain(command_line.should_probe_toolchain())
+{
+  setWindowTitle("Nexpp");
+  resize(1040, 600);
+
+  setup_form(command_line);
+  setup_actions();
+  refresh_preview();
+}
+
+void MainWindow::setup_form(const CommandLine &command_line)
+{
+  auto *title = new QLabel("Nexpp", this);
+  title->setObjectName("Title");
+
+  m_name        = new QLineEdit(command_line.get_project_name(), this);
+  m_destination = new QLineEdit(command_line.get_destination(), this);
+  m_manifest    = new QLineEdit(command_line.get_manifest(), this);
+  m_manifest->setPlaceholderText("Optional batch manifest (JSON)");
+
+  m_standard = new QComboBox(this);
+  m_standard->addItems({"14", "17", "20", "23"});
+  m_standard->setCurrentText(to_string(command_line.get_standard()));
+
+  m_flags = new QCheckBox("Warning flags", this);
+  m_flags->setChecked(command_line.has_flags());
+
+  m_modules = new QCheckBox("C++20 modules", this);
+  m_modules->setChecked(command_line.has_modules());
+
+  auto *libraries = new QHBoxLayout;
+  for(const auto &library : known_libraries()) {
+    auto *check_box = new QCheckBox(library, this);
+    check_box->setChecked(
+        command_line.get_libraries().contains(library, Qt::CaseInsensitive)
+    );
+    libraries->addWidget(check_box);
+    m_libraries.push_back(check_box);
+  }
+  libraries->addStretch();
+
+  auto *browse_destination = new QPushButton("Browse", this);
+  connect(browse_destination, &QPushButton::clicked, this, [this] {
+    const QString folder = QFileDialog::getExistingDirectory(
+        this, "Destination", m_destination->text()
+    );
+    if(!folder.isEmpty()) {
+      m_destination->setText(folder);
+    }
+  });
+
+  auto *browse_manifest = new QPushButton("Browse", this);
+  connect(browse_manifest, &QPushButton::clicked, this, [this] {
+    const QString file = QFileDialog::getOpenFileName(
+        this, "Manifest", QString(), "JSON (*.json)"
+    );
+    if(!file.isEmpty()) {
+      m_manifest->setText(file);
+    }
+  });
+
+  auto *form = new QFormLayout;
+  form->addRow("Name", m_name);
+  form->addRow(
+      "Destination", with_browse_button(m_destination, browse_destination)
+  );
+  form->addRow("Manifest", with_browse_button(m_manifest, browse_manifest));
+  form->addRow("Standard", m_standard);
+  form->addRow("Libraries", libraries);
+  form->addRow(QString(), m_flags);
+  form->addRow(QString(), m_modules);
+
+  m_generate = new QPushButton("Generate", this);
+  m_cancel   = new QPushButton("Cancel", this);
+  m_cancel->setEnabled(false);
+
+  auto *buttons = new QHBoxLayout;
+  buttons->addStretch();
+  buttons->addWidget(m_cancel);
+  buttons->addWidget(m_generate);
+
+  m_progress = new QProgressBar(this);
+  m_progress->setValue(0);
+  m_status  = new QLabel(this);
+  m_results = new QListWidget(this);
+  m_results->setUniformItemSizes(true);
+
+  m_preview_file = new QComboBox(this);
+  m_preview_text = new QPlainTextEdit(this);
+  m_preview_text->setObjectName("Preview");
+  m_preview_text->setReadOnly(true);
+  m_preview_text->setLineWrapMode(QPlainTextEdit::NoWrap);
+
+  auto *controls = new QVBoxLayout;
+  controls->addLayout(form);
+  controls->addLayout(buttons);
+  controls->addWidget(m_progress);
+  controls->addWidget(m_status);
+  controls->addWidget(m_results, 1);
+
+  auto *preview = new QVBoxLayout;
+  preview->addWidget(m_preview_file);
+  preview->addWidget(m_preview_text, 1);
+
+  auto *columns = new QHBoxLayout;
+  columns->addLayout(controls, 1);
+  columns->addLayout(preview, 1);
+
+  auto *layout = new QVBoxLayout(this);
+  layout->addWidget(title);
+  layout->addLayout(columns, 1);
+}
+
+void MainWindow::setup_actions()
+{
+  m_refresh_timer.setInterval(refresh_interval_ms);
+
+  connect(
+      m_generate, &QPushButton::clicked, this, [this] { start_generation(); }
+  );
+  connect(m_cancel, &QPushButton::clicked, this, [this] {
+    m_generator.cancel();
+    m_cancel->setEnabled(false);
+    m_status->setText("Cancelling...");
+  });
+  connect(
+      &m_refresh_timer, &QTimer::timeout, this, [this] { refresh_progress(); }
+  );
+
+  m_preview_timer.setSingleShot(true);
+  m_preview_timer.setInterval(preview_debounce_ms);
+
+  const auto schedule_preview = [this] { m_preview_timer.start(); };
+  connect(m_name, &QLineEdit::textChanged, this, schedule_preview);
+  connect(m_standard, &QComboBox::currentTextChanged, this, schedule_preview);
+  connect(m_flags, &QCheckBox::toggled, this, schedule_preview);
+  connect(m_modules, &QCheckBox::toggled, this, schedule_preview);
+  for(auto *check_box : m_libraries) {
+    connect(check_box, &QCheckBox::toggled, this, schedule_preview);
+  }
+
+  connect(
+      &m_preview_timer, &QTimer::timeout, this, [this] { refresh_preview(); }
+  );
+  connect(
+      m_preview_file, &QComboBox::currentIndexChanged, this,
+      [this] { show_preview_file(); }
+  );
+}
+
+ProjectSpec MainWindow::form_spec() const
+{
+  // The form edits the command line spec, so the options it has no widget
+  // for (perf, compiler family, toolchain) still apply.
+  ProjectSpec spec = m_defaults;
+  spec.name        = m_name->text().toStdString();
+  spec.destination = m_destination->text().isEmpty()
+                         ? std::string("./")
+                         : m_destination->text().toStdString();
+  spec.standard    = from_int(m_standard->currentText().toInt());
+  spec.has_flags   = m_flags->isChecked();
+  // Modules need C++20: older standards keep the header layout.
+  spec.modules     = m_modules->isChecked() && spec.standard >= Standard::CPP20;
+
+  spec.libraries.clear();
+  for(const auto *check_box : m_libraries) {
+    if(check_box->isChecked()) {
+      spec.libraries.push_back(check_box->text().toStdString());
+    }
+  }
+
+  probe_toolchain(spec);
+  return spec;
+}
+
+// Probes are cached per compiler family and standard, so only the first
+// preview of a standard pays for running the compilers.
+void MainWindow::probe_toolchain(ProjectSpec &spec) const
+{
+  if(m_probe_toolchain && spec.toolchain == Toolchain {}) {
+    spec.toolchain =
+        ToolchainProbe::shared().probe(spec.compiler, spec.standard);
+  }
+}
+
+std::vector<ProjectSpec> MainWindow::requested_specs() const
+{
+  if(!m_manifest->text().isEmpty()) {
+    std::vector<ProjectSpec> specs =
+        Manifest::load(m_manifest->text().toStdString());
+    for(auto &spec : specs) {
+      probe_toolchain(spec);
+    }
+    return specs;
+  }
+
+  if(m_name->text().isEmpty()) {
+    throw std::runtime_error("Project name is required !");
+  }
+
+  return {form_spec()};
+}
+
+void MainWindow::start_generation()
+{
+  std::vector<ProjectSpec> specs;
+  try {
+    specs = requested_specs();
+  } catch(const std::exception &exception) {
+    m_status->setText(exception.what());
+    return;
+  }
+
+  m_results->clear();
+  m_progress->setRange(0, static_cast<int>(specs.size()));
+  m_progress->setValue(0);
+  m_generate->setEnabled(false);
+  m_cancel->setEnabled(true);
+
+  m_generator.start(std::move(specs));
+  m_refresh_timer.start();
+  refresh_progress();
+}
+
+void MainWindow::refresh_progress()
+{
+  const GenerationProgress progress = m_generator.progress();
+
+  QStringList              lines;
+  for(const auto &result : m_generator.take_results()) {
+    lines.append(describe(result));
+  }
+  if(!lines.isEmpty()) {
+    m_results->addItems(lines);
+  }
+
+  m_progress->setValue(static_cast<int>(progress.projects_done));
+
+  QString status = QString::number(progress.projects_done) + "/" +
+                   QString::number(progress.projects_total) + " projects, " +
+                   QString::number(progress.files_written) + " files written";
+  if(progress.projects_failed != 0) {
+    status += ", " + QString::number(progress.projects_failed) + " failed";
+  }
+
+  if(!progress.finished) {
+    m_status->setText(progress.cancelled ? "Cancelling... " + status : status);
+    return;
+  }
+
+  m_refresh_timer.stop();
+  m_generate->setEnabled(true);
+  m_cancel->setEnabled(false);
+  if(!progress.cancelled) {
+    m_status->setText("Done: " + status);
+    return;
+  }
+
+  QString cancelled = "Cancelled, new projects were rolled back";
+  if(progress.projects_updated != 0) {
+    cancelled += ", " + QString::number(progress.projects_updated) +
+                 " existing projects updated before cancel were kept";
+  }
+  m_status->setText(cancelled);
+}
+
+void MainWindow::refresh_preview()
+{
+  const ProjectSpec spec = form_spec();
+  if(spec.name.empty()) {
+    m_preview_text->setPlainText(QString());
+    return;
+  }
+
+  const ProjectPlan &plan = m_preview.update(spec);
+
+  QStringList        paths;
+  for(const auto &file : plan.files) {
+    paths.append(QString::fromUtf8(
+        file.path.data(), static_cast<qsizetype>(file.path.size())
+    ));
+  }
+
+  if(paths != m_preview_paths) {
+    const QSignalBlocker blocker(m_preview_file);
+    const auto           found = paths.indexOf(m_preview_file->currentText());
+
+    m_preview_file->clear();
+    m_preview_file->addItems(paths);
+    m_preview_file->setCurrentIndex(found < 0 ? 0 : static_cast<int>(found));
+    m_preview_paths = std::move(paths);
+  }
+
+  show_preview_file();
+}
+
+void MainWindow::show_preview_file()
+{
+  const auto &files = m_preview.plan().files;
+  const int   index = m_preview_file->currentIndex();
+  if(index < 0 || static_cast<std::size_t>(index) >= files.size()) {
+    return;
+  }
+
+  const std::pmr::string &content =
+      files[static_cast<std::size_t>(index)].content;
+  m_preview_text->setPlainText(QString::fromUtf8(
+      content.data(), static_cast<qsizetype>(content.size())
+  ));
+}
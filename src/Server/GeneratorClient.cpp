@@ -0,0 +1,56 @@
+#include "Nexpp/Server/GeneratorClient.h"
+
+#include <array>
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <system_error>
+
+#include "Nexpp/Server/Protocol.h"
+#include "Nexpp/Server/UnixSocket.h"
+
+std::optional<BatchResult> GeneratorClient::generate(
+    const std::filesystem::path &socket_path, const ProjectSpec &spec
+)
+{
+  const sockaddr_un address = make_socket_address(socket_path);
+  FileDescriptor    socket  = make_stream_socket();
+
+  if(::connect(
+         socket.get(), reinterpret_cast<const sockaddr *>(&address),
+         sizeof(address)
+     ) != 0) {
+    if(errno == ENOENT || errno == ECONNREFUSED) {
+      return std::nullopt;
+    }
+    throw std::system_error(
+        errno, std::generic_category(),
+        "Cannot connect to " + socket_path.string()
+    );
+  }
+
+  send_all(socket, Protocol::encode_request(spec).toStdString());
+
+  std::array<char, 4096> chunk;
+  std::string            response;
+
+  while(response.find('\n') == std::string::npos) {
+    const ssize_t received =
+        ::recv(socket.get(), chunk.data(), chunk.size(), 0);
+    if(received < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      throw std::system_error(
+          errno, std::generic_category(), "Cannot read from Nexpp server"
+      );
+    }
+    if(received == 0) {
+      throw std::runtime_error("Nexpp server closed the connection");
+    }
+    response.append(chunk.data(), static_cast<std::size_t>(received));
+  }
+
+  return Protocol::decode_response(QByteArray::fromStdString(response));
+}
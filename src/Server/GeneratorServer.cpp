@@ -0,0 +1,267 @@
+#include "Nexpp/Server/GeneratorServer.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <poll.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <system_error>
+#include <unistd.h>
+
+#include "Nexpp/Batch/BatchRunner.h"
+#include "Nexpp/Server/Protocol.h"
+#include "Nexpp/Server/UnixSocket.h"
+
+namespace {
+[[noreturn]] void throw_errno(const std::string &action)
+{
+  throw std::system_error(errno, std::generic_category(), action);
+}
+
+bool is_listening(const sockaddr_un &address)
+{
+  FileDescriptor probe = make_stream_socket();
+  return ::connect(
+             probe.get(), reinterpret_cast<const sockaddr *>(&address),
+             sizeof(address)
+         ) == 0;
+}
+
+BatchResult handle_request(
+    const ProjectGenerator &generator, const std::string &line
+)
+{
+  ProjectSpec spec;
+
+  try {
+    spec = Protocol::decode_request(QByteArray::fromStdString(line));
+  } catch(const std::exception &exception) {
+    BatchResult result;
+    result.error = exception.what();
+    return result;
+  }
+
+  return BatchRunner::generate_one(generator, spec);
+}
+
+void signal_event(const FileDescriptor &event) noexcept
+{
+  const std::uint64_t value = 1;
+  [[maybe_unused]] const auto written =
+      ::write(event.get(), &value, sizeof(value));
+}
+} // namespace
+
+GeneratorServer::GeneratorServer(
+    std::filesystem::path socket_path, std::size_t thread_count,
+    GenerationOptions options
+)
+    : m_socket_path(std::move(socket_path)),
+      m_listener(make_stream_socket()),
+      m_wakeup(::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)),
+      m_completed(::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)),
+      m_generator(options),
+      m_pool(thread_count)
+{
+  if(!m_wakeup.is_valid() || !m_completed.is_valid()) {
+    throw_errno("Cannot create server wakeup event");
+  }
+
+  const sockaddr_un address = make_socket_address(m_socket_path);
+
+  if(std::filesystem::exists(
+         std::filesystem::symlink_status(m_socket_path)
+     )) {
+    if(is_listening(address)) {
+      throw std::runtime_error(
+          "A Nexpp server is already listening on " + m_socket_path.string()
+      );
+    }
+    std::filesystem::remove(m_socket_path);
+  }
+
+  if(::bind(
+         m_listener.get(), reinterpret_cast<const sockaddr *>(&address),
+         sizeof(address)
+     ) != 0) {
+    throw_errno("Cannot bind " + m_socket_path.string());
+  }
+
+  if(::listen(m_listener.get(), SOMAXCONN) != 0) {
+    throw_errno("Cannot listen on " + m_socket_path.string());
+  }
+}
+
+GeneratorServer::~GeneratorServer()
+{
+  stop();
+  m_pool.wait_idle();
+
+  std::error_code error;
+  std::filesystem::remove(m_socket_path, error);
+}
+
+void GeneratorServer::run()
+{
+  std::vector<std::shared_ptr<Connection>> connections;
+  std::vector<pollfd>                      fds;
+
+  while(true) {
+    fds.assign(
+        {{m_listener.get(), POLLIN, 0},
+         {m_wakeup.get(), POLLIN, 0},
+         {m_completed.get(), POLLIN, 0}}
+    );
+    for(const auto &connection : connections) {
+      // A negative descriptor makes poll() skip connections being served.
+      fds.push_back(
+          {connection->busy.load(std::memory_order_acquire)
+               ? -1
+               : connection->socket.get(),
+           POLLIN, 0}
+      );
+    }
+
+    if(::poll(fds.data(), fds.size(), -1) < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      throw_errno("Cannot poll server socket");
+    }
+
+    if(fds[1].revents != 0) {
+      return;
+    }
+
+    if(fds[2].revents != 0) {
+      std::uint64_t completed = 0;
+      [[maybe_unused]] const auto read =
+          ::read(m_completed.get(), &completed, sizeof(completed));
+    }
+
+    for(std::size_t index = 0; index < connections.size(); ++index) {
+      if(fds[index + 3].revents != 0) {
+        receive(*connections[index]);
+      }
+    }
+
+    for(const auto &connection : connections) {
+      if(!connection->busy.load(std::memory_order_acquire) &&
+         !connection->closed.load(std::memory_order_acquire)) {
+        dispatch(connection);
+      }
+    }
+
+    std::erase_if(connections, [](const auto &connection) {
+      return !connection->busy.load(std::memory_order_acquire) &&
+             connection->closed.load(std::memory_order_acquire);
+    });
+
+    if(fds[0].revents == 0) {
+      continue;
+    }
+
+    const int socket =
+        ::accept4(m_listener.get(), nullptr, nullptr, SOCK_CLOEXEC);
+    if(socket < 0) {
+      if(errno == EINTR || errno == ECONNABORTED) {
+        continue;
+      }
+      throw_errno("Cannot accept connection");
+    }
+
+    connections.push_back(std::make_shared<Connection>());
+    connections.back()->socket.reset(socket);
+  }
+}
+
+void GeneratorServer::stop() noexcept
+{
+  signal_event(m_wakeup);
+}
+
+const std::filesystem::path &GeneratorServer::socket_path() const
+{
+  return m_socket_path;
+}
+
+std::filesystem::path GeneratorServer::default_socket_path()
+{
+  if(const char *runtime_dir = std::getenv("XDG_RUNTIME_DIR");
+     runtime_dir != nullptr && *runtime_dir != '\0') {
+    return std::filesystem::path(runtime_dir) / "nexpp.sock";
+  }
+
+  return std::filesystem::temp_directory_path() /
+         ("nexpp-" + std::to_string(::getuid()) + ".sock");
+}
+
+void GeneratorServer::receive(Connection &connection) const
+{
+  std::array<char, 4096> chunk;
+  const ssize_t          received = ::recv(
+      connection.socket.get(), chunk.data(), chunk.size(), MSG_DONTWAIT
+  );
+
+  if(received < 0 && (errno == EINTR || errno == EAGAIN)) {
+    return;
+  }
+  if(received <= 0) {
+    connection.closed.store(true, std::memory_order_release);
+    return;
+  }
+
+  connection.pending.append(chunk.data(), static_cast<std::size_t>(received));
+}
+
+void GeneratorServer::dispatch(const std::shared_ptr<Connection> &connection)
+{
+  std::string      &pending = connection->pending;
+  const std::size_t newline = pending.find('\n');
+  const std::size_t length =
+      newline == std::string::npos ? pending.size() : newline;
+
+  const bool oversized = length > max_request_length;
+  if(newline == std::string::npos && !oversized) {
+    return;
+  }
+
+  std::string line;
+  if(oversized) {
+    // Without a bound, a client that never sends a newline would make the
+    // buffer grow forever.
+    pending.clear();
+    connection->closed.store(true, std::memory_order_release);
+  } else {
+    line = pending.substr(0, newline);
+    pending.erase(0, newline + 1);
+  }
+
+  connection->busy.store(true, std::memory_order_release);
+  m_pool.submit([this, connection, oversized, line = std::move(line)] {
+    BatchResult result;
+    if(oversized) {
+      result.error = "Request exceeds " + std::to_string(max_request_length) +
+                     " bytes";
+    } else {
+      result = handle_request(m_generator, line);
+    }
+
+    try {
+      send_all(
+          connection->socket, Protocol::encode_response(result).toStdString()
+      );
+    } catch(const std::system_error &) {
+      // The client went away mid-response; nothing left to report to.
+      connection->closed.store(true, std::memory_order_release);
+    }
+
+    connection->busy.store(false, std::memory_order_release);
+    signal_event(m_completed);
+  });
+}
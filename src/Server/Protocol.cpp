@@ -0,0 +1,134 @@
+#include "Nexpp/Server/Protocol.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <stdexcept>
+
+#include "Nexpp/Batch/Manifest.h"
+
+namespace {
+QJsonArray to_json(const PathList &paths)
+{
+  QJsonArray array;
+  for(const auto path : paths) {
+    array.append(
+        QString::fromUtf8(path.data(), static_cast<qsizetype>(path.size()))
+    );
+  }
+  return array;
+}
+
+PathList to_paths(const QJsonValue &value)
+{
+  PathList paths;
+  for(const auto &entry : value.toArray()) {
+    paths.push_back(entry.toString().toStdString());
+  }
+  return paths;
+}
+
+QJsonObject parse_object(const QByteArray &line, const char *what)
+{
+  QJsonParseError     error;
+  const QJsonDocument document = QJsonDocument::fromJson(line, &error);
+  if(!document.isObject()) {
+    throw std::runtime_error(
+        std::string("Invalid ") + what + ": " +
+        error.errorString().toStdString()
+    );
+  }
+
+  return document.object();
+}
+} // namespace
+
+QByteArray Protocol::encode_request(const ProjectSpec &spec)
+{
+  QJsonArray libraries;
+  for(const auto &library : spec.libraries) {
+    libraries.append(QString::fromStdString(library));
+  }
+
+  QJsonArray perf;
+  if(spec.perf.ipo) {
+    perf.append("lto");
+  }
+  if(spec.perf.unity) {
+    perf.append("unity");
+  }
+  if(spec.perf.pch) {
+    perf.append("pch");
+  }
+
+  QJsonObject toolchain;
+  toolchain.insert("compiler", QString::fromStdString(spec.toolchain.compiler));
+  toolchain.insert("launcher", QString::fromStdString(spec.toolchain.launcher));
+  toolchain.insert("linker", QString::fromStdString(spec.toolchain.linker));
+
+  QJsonObject request;
+  request.insert("name", QString::fromStdString(spec.name));
+  request.insert(
+      "destination", QString::fromStdString(
+                         std::filesystem::absolute(spec.destination).string()
+                     )
+  );
+  request.insert("standard", to_string(spec.standard));
+  request.insert("libraries", libraries);
+  request.insert("flags", spec.has_flags);
+  request.insert("perf", perf);
+  request.insert("modules", spec.modules);
+  request.insert("compiler", to_string(spec.compiler));
+  request.insert("toolchain", toolchain);
+
+  return QJsonDocument(request).toJson(QJsonDocument::Compact) + '\n';
+}
+
+ProjectSpec Protocol::decode_request(const QByteArray &line)
+{
+  ProjectSpec spec =
+      Manifest::parse_project(parse_object(line, "request"), ProjectSpec {});
+  if(spec.name.empty()) {
+    throw std::runtime_error("Project name is required for every request !");
+  }
+
+  return spec;
+}
+
+QByteArray Protocol::encode_response(const BatchResult &result)
+{
+  QJsonObject response;
+  response.insert("name", QString::fromStdString(result.project_name));
+  response.insert("success", result.success);
+  response.insert("error", QString::fromStdString(result.error));
+  response.insert(
+      "root", QString::fromStdString(result.report.root.string())
+  );
+  response.insert("written", to_json(result.report.written));
+  response.insert("unchanged", to_json(result.report.unchanged));
+  response.insert("conflicts", to_json(result.report.conflicts));
+  response.insert(
+      "duration_us", static_cast<qint64>(result.duration.count())
+  );
+
+  return QJsonDocument(response).toJson(QJsonDocument::Compact) + '\n';
+}
+
+BatchResult Protocol::decode_response(const QByteArray &line)
+{
+  const QJsonObject response = parse_object(line, "response");
+
+  BatchResult       result;
+  result.project_name     = response.value("name").toString().toStdString();
+  result.success          = response.value("success").toBool();
+  result.error            = response.value("error").toString().toStdString();
+  result.report.root      = response.value("root").toString().toStdString();
+  result.report.written   = to_paths(response.value("written"));
+  result.report.unchanged = to_paths(response.value("unchanged"));
+  result.report.conflicts = to_paths(response.value("conflicts"));
+  result.duration         = std::chrono::microseconds(
+      response.value("duration_us").toInteger()
+  );
+
+  return result;
+}
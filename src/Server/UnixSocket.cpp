@@ -0,0 +1,50 @@
+#include "Nexpp/Server/UnixSocket.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <system_error>
+
+sockaddr_un make_socket_address(const std::filesystem::path &path)
+{
+  sockaddr_un address {};
+  address.sun_family = AF_UNIX;
+
+  const std::string native = path.string();
+  if(native.size() >= sizeof(address.sun_path)) {
+    throw std::runtime_error("Socket path is too long: " + native);
+  }
+
+  std::memcpy(address.sun_path, native.c_str(), native.size() + 1);
+  return address;
+}
+
+FileDescriptor make_stream_socket()
+{
+  FileDescriptor socket(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+  if(!socket.is_valid()) {
+    throw std::system_error(
+        errno, std::generic_category(), "Cannot create socket"
+    );
+  }
+
+  return socket;
+}
+
+void send_all(const FileDescriptor &socket, std::string_view data)
+{
+  while(!data.empty()) {
+    const ssize_t sent =
+        ::send(socket.get(), data.data(), data.size(), MSG_NOSIGNAL);
+    if(sent < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      throw std::system_error(
+          errno, std::generic_category(), "Cannot write to socket"
+      );
+    }
+    data.remove_prefix(static_cast<std::size_t>(sent));
+  }
+}
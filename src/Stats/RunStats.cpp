@@ -0,0 +1,321 @@
+#include "Nexpp/Stats/RunStats.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace {
+constexpr std::size_t linear_buckets  = 16;
+constexpr std::size_t sub_bucket_bits = 3;
+constexpr std::size_t sub_buckets     = 1 << sub_bucket_bits;
+constexpr std::size_t histogram_buckets =
+    linear_buckets + (64 - 4) * sub_buckets;
+constexpr std::size_t counter_count =
+    static_cast<std::size_t>(StatCounter::Count);
+constexpr std::size_t latency_count =
+    static_cast<std::size_t>(StatLatency::Count);
+
+constexpr std::array<std::string_view, counter_count> counter_names = {
+    "projects",      "files",         "cloned_files",
+    "directories",   "bytes_written", "syscalls"
+};
+
+constexpr std::array<std::string_view, latency_count> latency_names = {
+    "render", "file_write", "project"
+};
+
+// Only the owning thread writes a block, so plain relaxed load/store pairs
+// are enough and readers never take a lock on the hot path.
+void bump(std::atomic<std::uint64_t> &value, std::uint64_t amount) noexcept
+{
+  value.store(
+      value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed
+  );
+}
+
+struct Histogram
+{
+  std::array<std::atomic<std::uint64_t>, histogram_buckets> buckets {};
+  std::atomic<std::int64_t>                                 max_ns = 0;
+};
+
+struct ThreadStats
+{
+  std::array<std::atomic<std::uint64_t>, counter_count> counters {};
+  std::array<Histogram, latency_count>                  latencies {};
+};
+
+struct Registry
+{
+  std::mutex                                mutex;
+  std::vector<std::unique_ptr<ThreadStats>> threads;
+};
+
+Registry &registry()
+{
+  static Registry instance;
+  return instance;
+}
+
+ThreadStats &thread_stats()
+{
+  thread_local ThreadStats *stats = [] {
+    Registry                   &shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    return shared.threads.emplace_back(std::make_unique<ThreadStats>()).get();
+  }();
+
+  return *stats;
+}
+
+std::int64_t steady_now_ns() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch()
+  )
+      .count();
+}
+
+LatencySummary summarize(
+    const std::array<std::uint64_t, histogram_buckets> &buckets,
+    std::int64_t                                         max_ns
+)
+{
+  LatencySummary summary;
+  for(const auto count : buckets) {
+    summary.count += count;
+  }
+  summary.max_ns = max_ns;
+
+  if(summary.count == 0) {
+    return summary;
+  }
+
+  auto percentile = [&](std::uint64_t numerator) {
+    const std::uint64_t rank = (summary.count * numerator + 99) / 100;
+    std::uint64_t       seen = 0;
+    for(std::size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+      seen += buckets[bucket];
+      if(seen >= rank) {
+        return std::min(RunStats::bucket_upper_bound(bucket), max_ns);
+      }
+    }
+    return max_ns;
+  };
+
+  summary.p50_ns = percentile(50);
+  summary.p95_ns = percentile(95);
+  summary.p99_ns = percentile(99);
+  return summary;
+}
+
+void print_duration(std::ostream &out, std::int64_t ns)
+{
+  out << std::fixed << std::setprecision(1)
+      << static_cast<double>(ns) / 1000.0 << " us";
+}
+} // namespace
+
+std::atomic<bool> RunStats::s_enabled = false;
+
+void              RunStats::start()
+{
+  s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void RunStats::stop()
+{
+  s_enabled.store(false, std::memory_order_relaxed);
+}
+
+void RunStats::reset()
+{
+  Registry                   &shared = registry();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+
+  for(const auto &stats : shared.threads) {
+    for(auto &counter : stats->counters) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+    for(auto &histogram : stats->latencies) {
+      for(auto &bucket : histogram.buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+      histogram.max_ns.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+void RunStats::record(StatLatency latency, std::int64_t ns) noexcept
+{
+  if(!is_enabled()) {
+    return;
+  }
+
+  Histogram &histogram =
+      thread_stats().latencies[static_cast<std::size_t>(latency)];
+  bump(histogram.buckets[bucket_of(ns)], 1);
+
+  if(ns > histogram.max_ns.load(std::memory_order_relaxed)) {
+    histogram.max_ns.store(ns, std::memory_order_relaxed);
+  }
+}
+
+std::size_t RunStats::bucket_of(std::int64_t ns) noexcept
+{
+  if(ns < static_cast<std::int64_t>(linear_buckets)) {
+    return ns < 0 ? 0 : static_cast<std::size_t>(ns);
+  }
+
+  const auto        value    = static_cast<std::uint64_t>(ns);
+  const std::size_t exponent =
+      static_cast<std::size_t>(std::bit_width(value)) - 1;
+  const std::size_t sub =
+      static_cast<std::size_t>(value >> (exponent - sub_bucket_bits)) &
+      (sub_buckets - 1);
+
+  return linear_buckets + (exponent - 4) * sub_buckets + sub;
+}
+
+std::int64_t RunStats::bucket_upper_bound(std::size_t bucket) noexcept
+{
+  if(bucket < linear_buckets) {
+    return static_cast<std::int64_t>(bucket);
+  }
+
+  const std::size_t   exponent = (bucket - linear_buckets) / sub_buckets + 4;
+  const std::size_t   sub      = (bucket - linear_buckets) % sub_buckets;
+  const std::uint64_t upper    = ((sub_buckets + sub + 1)
+                               << (exponent - sub_bucket_bits)) -
+                              1;
+  return static_cast<std::int64_t>(
+      std::min<std::uint64_t>(upper, std::numeric_limits<std::int64_t>::max())
+  );
+}
+
+StatsSnapshot RunStats::snapshot()
+{
+  Registry                   &shared = registry();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+
+  StatsSnapshot               snapshot;
+  for(std::size_t latency = 0; latency < latency_count; ++latency) {
+    std::array<std::uint64_t, histogram_buckets> buckets {};
+    std::int64_t                                 max_ns = 0;
+
+    for(const auto &stats : shared.threads) {
+      const Histogram &histogram = stats->latencies[latency];
+      for(std::size_t bucket = 0; bucket < histogram_buckets; ++bucket) {
+        buckets[bucket] +=
+            histogram.buckets[bucket].load(std::memory_order_relaxed);
+      }
+      max_ns = std::max(
+          max_ns, histogram.max_ns.load(std::memory_order_relaxed)
+      );
+    }
+
+    snapshot.latencies[latency] = summarize(buckets, max_ns);
+  }
+
+  for(const auto &stats : shared.threads) {
+    for(std::size_t counter = 0; counter < counter_count; ++counter) {
+      snapshot.counters[counter] +=
+          stats->counters[counter].load(std::memory_order_relaxed);
+    }
+  }
+
+  return snapshot;
+}
+
+void RunStats::print(std::ostream &out, const StatsSnapshot &snapshot)
+{
+  const auto flags = out.flags();
+
+  out << "Run statistics\n";
+  for(std::size_t counter = 0; counter < counter_count; ++counter) {
+    out << "  " << std::left << std::setw(14) << counter_names[counter]
+        << snapshot.counters[counter] << '\n';
+  }
+
+  out << "Latency (p50 / p95 / p99 / max)\n";
+  for(std::size_t latency = 0; latency < latency_count; ++latency) {
+    const LatencySummary &summary = snapshot.latencies[latency];
+    out << "  " << std::left << std::setw(14) << latency_names[latency]
+        << summary.count << " samples";
+    if(summary.count != 0) {
+      out << ", ";
+      print_duration(out, summary.p50_ns);
+      out << " / ";
+      print_duration(out, summary.p95_ns);
+      out << " / ";
+      print_duration(out, summary.p99_ns);
+      out << " / ";
+      print_duration(out, summary.max_ns);
+    }
+    out << '\n';
+  }
+
+  out.flags(flags);
+}
+
+void RunStats::write_json(std::ostream &out, const StatsSnapshot &snapshot)
+{
+  out << "{\n  \"counters\": {";
+  for(std::size_t counter = 0; counter < counter_count; ++counter) {
+    out << (counter == 0 ? "\n" : ",\n") << "    \"" << counter_names[counter]
+        << "\": " << snapshot.counters[counter];
+  }
+
+  out << "\n  },\n  \"latencies_ns\": {";
+  for(std::size_t latency = 0; latency < latency_count; ++latency) {
+    const LatencySummary &summary = snapshot.latencies[latency];
+    out << (latency == 0 ? "\n" : ",\n") << "    \"" << latency_names[latency]
+        << "\": {\"count\": " << summary.count
+        << ", \"p50\": " << summary.p50_ns << ", \"p95\": " << summary.p95_ns
+        << ", \"p99\": " << summary.p99_ns << ", \"max\": " << summary.max_ns
+        << '}';
+  }
+  out << "\n  }\n}\n";
+}
+
+void RunStats::write_json(
+    const std::filesystem::path &path, const StatsSnapshot &snapshot
+)
+{
+  std::ofstream out(path, std::ios::trunc);
+  if(!out) {
+    throw std::runtime_error("Cannot open stats file: " + path.string());
+  }
+
+  write_json(out, snapshot);
+  if(!out) {
+    throw std::runtime_error("Cannot write stats file: " + path.string());
+  }
+}
+
+void RunStats::increment(StatCounter counter, std::uint64_t amount) noexcept
+{
+  bump(thread_stats().counters[static_cast<std::size_t>(counter)], amount);
+}
+
+LatencyTimer::LatencyTimer(StatLatency latency) noexcept : m_latency(latency)
+{
+  if(RunStats::is_enabled()) {
+    m_start_ns = steady_now_ns();
+  }
+}
+
+LatencyTimer::~LatencyTimer()
+{
+  if(m_start_ns >= 0) {
+    RunStats::record(m_latency, steady_now_ns() - m_start_ns);
+  }
+}
@@ -0,0 +1,375 @@
+#include "Nexpp/Toolchain/ToolchainProbe.h"
+
+#include <array>
+#include <charconv>
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <spawn.h>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <unistd.h>
+#include <vector>
+
+#include "Nexpp/FileSystem/FileDescriptor.h"
+
+extern char **environ;
+
+namespace {
+constexpr int newest_versioned_driver = 30;
+constexpr int oldest_versioned_driver = 5;
+
+// The first drivers that accept -fuse-ld=mold. Only major versions are
+// probed, and GCC 12.1 is the first GCC 12 release (x.0 is the development
+// series), so a major version of 12 already means 12.1 or later.
+constexpr int mold_minimum_clang      = 12;
+constexpr int mold_minimum_gcc        = 12;
+
+std::optional<CompilerFamily> family_of_name(const std::string &name)
+{
+  if(name.find("clang") != std::string::npos) {
+    return CompilerFamily::Clang;
+  }
+
+  if(name.find("g++") != std::string::npos ||
+     name.find("gcc") != std::string::npos) {
+    return CompilerFamily::GCC;
+  }
+
+  return std::nullopt;
+}
+
+bool is_executable(const std::filesystem::path &path)
+{
+  std::error_code error;
+  return std::filesystem::is_regular_file(path, error) &&
+         ::access(path.c_str(), X_OK) == 0;
+}
+
+std::optional<std::int64_t> modification_time(const std::filesystem::path &path)
+{
+  struct stat status {};
+  if(::stat(path.c_str(), &status) != 0) {
+    return std::nullopt;
+  }
+
+  return static_cast<std::int64_t>(status.st_mtim.tv_sec) * 1'000'000'000 +
+         status.st_mtim.tv_nsec;
+}
+
+std::optional<int> run_dumpversion(const std::filesystem::path &compiler)
+{
+  std::array<int, 2> pipe_fds {};
+  if(::pipe2(pipe_fds.data(), O_CLOEXEC) != 0) {
+    return std::nullopt;
+  }
+
+  FileDescriptor             read_end(pipe_fds[0]);
+  FileDescriptor             write_end(pipe_fds[1]);
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_adddup2(&actions, write_end.get(), STDOUT_FILENO);
+  posix_spawn_file_actions_addopen(
+      &actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0
+  );
+
+  std::string           program = compiler.string();
+  std::string           flag    = "-dumpversion";
+  std::array<char *, 3> argv    = {program.data(), flag.data(), nullptr};
+
+  pid_t                 pid     = 0;
+  const int             spawned = posix_spawn(
+      &pid, program.c_str(), &actions, nullptr, argv.data(), environ
+  );
+  posix_spawn_file_actions_destroy(&actions);
+  write_end.reset();
+
+  if(spawned != 0) {
+    return std::nullopt;
+  }
+
+  std::string           output;
+  std::array<char, 256> chunk;
+  ssize_t               count = 0;
+  while((count = ::read(read_end.get(), chunk.data(), chunk.size())) > 0) {
+    output.append(chunk.data(), static_cast<std::size_t>(count));
+  }
+
+  int status = 0;
+  while(::waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+  }
+
+  if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    return std::nullopt;
+  }
+
+  int        version = 0;
+  const auto result =
+      std::from_chars(output.data(), output.data() + output.size(), version);
+  if(result.ec != std::errc() || version <= 0) {
+    return std::nullopt;
+  }
+
+  return version;
+}
+} // namespace
+
+ToolchainProbe::ToolchainProbe(std::filesystem::path cache_file)
+    : m_cache_file(std::move(cache_file))
+{
+  load_cache();
+}
+
+Toolchain ToolchainProbe::probe(CompilerFamily family, Standard standard)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const auto                  probed = m_probed.find({family, standard});
+  if(probed != m_probed.end()) {
+    return probed->second;
+  }
+
+  const std::string           driver(cxx_compiler(family));
+  const int                   minimum = minimum_version(family, standard);
+  const std::size_t           cached  = m_cache.size();
+
+  Toolchain                   toolchain;
+  int                         version = 0;
+
+  std::vector<std::string>    candidates = {driver};
+  for(int major = newest_versioned_driver; major >= oldest_versioned_driver;
+      --major) {
+    candidates.push_back(driver + "-" + std::to_string(major));
+  }
+
+  for(const auto &candidate : candidates) {
+    const auto program = find_program(candidate);
+    if(!program) {
+      continue;
+    }
+
+    const auto candidate_version = cached_version(*program);
+    if(candidate_version && *candidate_version >= minimum) {
+      toolchain.compiler = candidate;
+      version            = *candidate_version;
+      break;
+    }
+  }
+
+  if(m_cache.size() != cached) {
+    save_cache();
+  }
+
+  for(const std::string_view launcher : {"ccache", "sccache"}) {
+    if(find_program(launcher)) {
+      toolchain.launcher = launcher;
+      break;
+    }
+  }
+
+  const int mold_minimum =
+      family == CompilerFamily::Clang ? mold_minimum_clang : mold_minimum_gcc;
+  if(version >= mold_minimum && find_program("mold")) {
+    toolchain.linker = "mold";
+  } else if(find_program("ld.lld")) {
+    toolchain.linker = "lld";
+  }
+
+  m_probed.emplace(std::pair(family, standard), toolchain);
+  return toolchain;
+}
+
+std::optional<int>
+    ToolchainProbe::compiler_version(const std::filesystem::path &compiler)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const std::size_t           cached  = m_cache.size();
+  const auto                  version = cached_version(compiler);
+  if(m_cache.size() != cached) {
+    save_cache();
+  }
+
+  return version;
+}
+
+ToolchainProbe &ToolchainProbe::shared()
+{
+  static ToolchainProbe probe;
+  return probe;
+}
+
+std::filesystem::path ToolchainProbe::default_cache_file()
+{
+  if(const char *cache_home = std::getenv("XDG_CACHE_HOME");
+     cache_home != nullptr && *cache_home != '\0') {
+    return std::filesystem::path(cache_home) / "nexpp" / "toolchain.cache";
+  }
+
+  if(const char *home = std::getenv("HOME"); home != nullptr && *home != '\0') {
+    return std::filesystem::path(home) / ".cache" / "nexpp" /
+           "toolchain.cache";
+  }
+
+  return std::filesystem::temp_directory_path() /
+         ("nexpp-" + std::to_string(::getuid())) / "toolchain.cache";
+}
+
+CompilerFamily ToolchainProbe::detect_compiler_family()
+{
+  static const CompilerFamily family = [] {
+    if(const char *cxx = std::getenv("CXX"); cxx != nullptr && *cxx != '\0') {
+      if(const auto program = find_program(cxx)) {
+        if(const auto detected = family_of(*program)) {
+          return *detected;
+        }
+      }
+    }
+
+    for(const std::string_view candidate : {"c++", "g++", "clang++"}) {
+      if(const auto program = find_program(candidate)) {
+        if(const auto detected = family_of(*program)) {
+          return *detected;
+        }
+      }
+    }
+
+    return CompilerFamily::GCC;
+  }();
+
+  return family;
+}
+
+int ToolchainProbe::minimum_version(
+    CompilerFamily family, Standard standard
+) noexcept
+{
+  switch(standard) {
+  case Standard::CPP14:
+    return family == CompilerFamily::Clang ? 4 : 5;
+  case Standard::CPP17:
+    return family == CompilerFamily::Clang ? 5 : 7;
+  case Standard::CPP20:
+    return 10;
+  case Standard::CPP23:
+    return family == CompilerFamily::Clang ? 12 : 11;
+  default:
+    return 0;
+  }
+}
+
+std::optional<std::filesystem::path>
+    ToolchainProbe::find_program(std::string_view name)
+{
+  if(name.find('/') != std::string_view::npos) {
+    const std::filesystem::path path(name);
+    return is_executable(path) ? std::optional(path) : std::nullopt;
+  }
+
+  const char *path_variable = std::getenv("PATH");
+  if(path_variable == nullptr) {
+    return std::nullopt;
+  }
+
+  const std::string_view search_path(path_variable);
+  std::size_t            begin = 0;
+  while(begin <= search_path.size()) {
+    std::size_t end = search_path.find(':', begin);
+    if(end == std::string_view::npos) {
+      end = search_path.size();
+    }
+
+    const std::string_view directory = search_path.substr(begin, end - begin);
+    const std::filesystem::path candidate =
+        std::filesystem::path(directory.empty() ? "." : directory) / name;
+    if(is_executable(candidate)) {
+      return candidate;
+    }
+
+    begin = end + 1;
+  }
+
+  return std::nullopt;
+}
+
+std::optional<CompilerFamily>
+    ToolchainProbe::family_of(const std::filesystem::path &compiler)
+{
+  if(const auto family = family_of_name(compiler.filename().string())) {
+    return family;
+  }
+
+  std::error_code             error;
+  const std::filesystem::path resolved =
+      std::filesystem::canonical(compiler, error);
+  if(error) {
+    return std::nullopt;
+  }
+
+  return family_of_name(resolved.filename().string());
+}
+
+std::optional<int>
+    ToolchainProbe::cached_version(const std::filesystem::path &compiler)
+{
+  const auto mtime = modification_time(compiler);
+  if(!mtime) {
+    return std::nullopt;
+  }
+
+  const auto found = m_cache.find(compiler.string());
+  if(found != m_cache.end() && found->second.mtime == *mtime) {
+    return found->second.version > 0 ? std::optional(found->second.version)
+                                     : std::nullopt;
+  }
+
+  const auto version = run_dumpversion(compiler);
+  m_cache.insert_or_assign(
+      compiler.string(), CacheEntry {*mtime, version.value_or(0)}
+  );
+  return version;
+}
+
+void ToolchainProbe::load_cache()
+{
+  std::ifstream ifs(m_cache_file);
+  std::string   line;
+  while(std::getline(ifs, line)) {
+    std::istringstream fields(line);
+    CacheEntry         entry;
+    std::string        path;
+    if(fields >> entry.mtime >> entry.version && fields.get() == ' ' &&
+       std::getline(fields, path) && !path.empty()) {
+      m_cache.insert_or_assign(std::move(path), entry);
+    }
+  }
+}
+
+void ToolchainProbe::save_cache() const
+{
+  std::error_code error;
+  std::filesystem::create_directories(m_cache_file.parent_path(), error);
+
+  std::filesystem::path temporary = m_cache_file;
+  temporary += ".tmp" + std::to_string(::getpid());
+
+  {
+    std::ofstream ofs(temporary, std::ios::trunc);
+    for(const auto &[path, entry] : m_cache) {
+      ofs << entry.mtime << ' ' << entry.version << ' ' << path << '\n';
+    }
+    if(!ofs) {
+      std::filesystem::remove(temporary, error);
+      return;
+    }
+  }
+
+  std::filesystem::rename(temporary, m_cache_file, error);
+  if(error) {
+    std::filesystem::remove(temporary, error);
+  }
+}
@@ -0,0 +1,204 @@
+#include "Nexpp/Trace/Trace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+struct ThreadBuffer
+{
+  std::mutex              mutex;
+  std::vector<TraceEvent> events;
+  std::uint32_t           thread_id = 0;
+};
+
+struct Registry
+{
+  std::mutex                                 mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+  std::atomic<std::int64_t>                  origin_ns = 0;
+};
+
+Registry &registry()
+{
+  static Registry instance;
+  return instance;
+}
+
+ThreadBuffer &thread_buffer()
+{
+  thread_local ThreadBuffer *buffer = [] {
+    Registry                   &shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+
+    auto                       &created =
+        shared.buffers.emplace_back(std::make_unique<ThreadBuffer>());
+    created->thread_id = static_cast<std::uint32_t>(::gettid());
+    return created.get();
+  }();
+
+  return *buffer;
+}
+
+void write_string(std::ostream &out, std::string_view value)
+{
+  out << '"';
+  for(const char character : value) {
+    switch(character) {
+    case '"':
+      out << "\\\"";
+      break;
+    case '\\':
+      out << "\\\\";
+      break;
+    case '\n':
+      out << "\\n";
+      break;
+    case '\t':
+      out << "\\t";
+      break;
+    default:
+      if(static_cast<unsigned char>(character) < 0x20) {
+        char escaped[8];
+        std::snprintf(
+            escaped, sizeof(escaped), "\\u%04x",
+            static_cast<unsigned>(character)
+        );
+        out << escaped;
+      } else {
+        out << character;
+      }
+    }
+  }
+  out << '"';
+}
+
+void write_microseconds(std::ostream &out, std::int64_t nanoseconds)
+{
+  out << nanoseconds / 1000 << '.';
+  const std::int64_t fraction = nanoseconds % 1000;
+  out << (fraction < 100 ? "0" : "") << (fraction < 10 ? "0" : "") << fraction;
+}
+} // namespace
+
+std::atomic<bool> Trace::s_enabled = false;
+
+void              Trace::start()
+{
+  registry().origin_ns.store(now_ns(), std::memory_order_relaxed);
+  s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Trace::stop()
+{
+  s_enabled.store(false, std::memory_order_relaxed);
+}
+
+void Trace::clear()
+{
+  Registry                   &shared = registry();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+
+  for(const auto &buffer : shared.buffers) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    buffer->events.clear();
+  }
+}
+
+std::int64_t Trace::now_ns() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch()
+  )
+      .count();
+}
+
+void Trace::record(
+    const char *name, std::string_view detail, std::int64_t start_ns
+)
+{
+  const std::int64_t          end_ns = now_ns();
+  ThreadBuffer               &buffer = thread_buffer();
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+
+  buffer.events.push_back(
+      {name, std::string(detail), start_ns, end_ns - start_ns, buffer.thread_id}
+  );
+}
+
+std::size_t Trace::event_count()
+{
+  Registry                   &shared = registry();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+
+  std::size_t                 count = 0;
+  for(const auto &buffer : shared.buffers) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    count += buffer->events.size();
+  }
+  return count;
+}
+
+void Trace::write(std::ostream &out)
+{
+  Registry                   &shared = registry();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+
+  const std::int64_t origin = shared.origin_ns.load(std::memory_order_relaxed);
+  const pid_t        pid    = ::getpid();
+
+  out << "{\"traceEvents\":[\n";
+  out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+      << ",\"args\":{\"name\":\"nexpp\"}}";
+
+  for(const auto &buffer : shared.buffers) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    if(buffer->events.empty()) {
+      continue;
+    }
+
+    out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+        << ",\"tid\":" << buffer->thread_id << ",\"args\":{\"name\":"
+        << (buffer->thread_id == static_cast<std::uint32_t>(pid)
+                ? "\"main\""
+                : "\"worker\"")
+        << "}}";
+
+    for(const auto &event : buffer->events) {
+      out << ",\n{\"name\":";
+      write_string(out, event.name);
+      out << ",\"cat\":\"nexpp\",\"ph\":\"X\",\"pid\":" << pid
+          << ",\"tid\":" << event.thread_id << ",\"ts\":";
+      write_microseconds(out, event.start_ns - origin);
+      out << ",\"dur\":";
+      write_microseconds(out, event.duration_ns);
+
+      if(!event.detail.empty()) {
+        out << ",\"args\":{\"detail\":";
+        write_string(out, event.detail);
+        out << '}';
+      }
+      out << '}';
+    }
+  }
+
+  out << "\n]}\n";
+}
+
+void Trace::write(const std::filesystem::path &path)
+{
+  std::ofstream out(path, std::ios::trunc);
+  if(!out) {
+    throw std::runtime_error("Cannot open trace file: " + path.string());
+  }
+
+  write(out);
+  if(!out) {
+    throw std::runtime_error("Cannot write trace file: " + path.string());
+  }
+}
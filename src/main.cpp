@@ -1,31 +1,390 @@
+#include "Nexpp/Archive/ArchiveWriter.h"
+#include "Nexpp/Batch/BatchRunner.h"
+#include "Nexpp/Batch/Manifest.h"
 #include "Nexpp/CommandLine/CommandLine.h"
-#include "Nexpp/Data/CMakeBase.h"
+#include "Nexpp/Dependencies/DependencyStore.h"
+#include "Nexpp/FileSystem/FileSystem.h"
+#include "Nexpp/Generator/PlanDiff.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include "Nexpp/Gui/GuiApplication.h"
+#include "Nexpp/Server/GeneratorClient.h"
+#include "Nexpp/Server/GeneratorServer.h"
+#include "Nexpp/Stats/RunStats.h"
+#include "Nexpp/Toolchain/ToolchainProbe.h"
+#include "Nexpp/Trace/Trace.h"
 
-#include <QApplication>
-#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QLibrary>
+#include <algorithm>
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace {
+int run_gui(int &argc, char **argv)
+{
+  std::error_code error;
+  const auto      executable =
+      std::filesystem::read_symlink("/proc/self/exe", error);
+  const auto module_path = error ? std::filesystem::path(NEXPP_GUI_MODULE)
+                                 : executable.parent_path() / NEXPP_GUI_MODULE;
+
+  QLibrary   module(QString::fromStdString(module_path.string()));
+  const auto entry_point =
+      reinterpret_cast<GuiEntryPoint>(module.resolve(GUI_ENTRY_POINT));
+
+  if(entry_point == nullptr) {
+    std::cerr << "Unable to load the GUI module: "
+              << module.errorString().toStdString() << '\n';
+    return 1;
+  }
+
+  return entry_point(argc, argv);
+}
+
+class TraceOutput
+{
+public:
+  explicit TraceOutput(std::string path) : m_path(std::move(path))
+  {
+#ifndef NEXPP_ENABLE_TRACE
+    if(!m_path.empty()) {
+      std::cerr << "Tracing is compiled out of this build (NEXPP_ENABLE_TRACE)"
+                << '\n';
+    }
+#endif
+  }
+
+  ~TraceOutput()
+  {
+    if(m_path.empty()) {
+      return;
+    }
+
+    Trace::stop();
+    try {
+      Trace::write(std::filesystem::path(m_path));
+    } catch(const std::exception &exception) {
+      std::cerr << exception.what() << '\n';
+    }
+  }
+
+  TraceOutput(const TraceOutput &)            = delete;
+  TraceOutput &operator=(const TraceOutput &) = delete;
+
+private:
+  std::string m_path;
+};
+
+class StatsOutput
+{
+public:
+  StatsOutput(bool print, std::string json_path)
+      : m_print(print), m_json_path(std::move(json_path))
+  {
+    if(m_print || !m_json_path.empty()) {
+      RunStats::start();
+    }
+  }
+
+  ~StatsOutput()
+  {
+    if(!m_print && m_json_path.empty()) {
+      return;
+    }
+
+    RunStats::stop();
+    const StatsSnapshot snapshot = RunStats::snapshot();
+
+    if(m_print) {
+      RunStats::print(std::cout, snapshot);
+    }
+
+    try {
+      if(!m_json_path.empty()) {
+        RunStats::write_json(std::filesystem::path(m_json_path), snapshot);
+      }
+    } catch(const std::exception &exception) {
+      std::cerr << exception.what() << '\n';
+    }
+  }
+
+  StatsOutput(const StatsOutput &)            = delete;
+  StatsOutput &operator=(const StatsOutput &) = delete;
+
+private:
+  bool        m_print;
+  std::string m_json_path;
+};
+
+GeneratorServer *running_server = nullptr;
+
+void             stop_server(int)
+{
+  if(running_server != nullptr) {
+    running_server->stop();
+  }
+}
+
+int run_server(const CommandLine &command_line)
+{
+  GeneratorServer server(
+      command_line.get_socket().toStdString(), command_line.get_jobs(),
+      command_line.get_generation_options()
+  );
+
+  running_server = &server;
+  std::signal(SIGINT, stop_server);
+  std::signal(SIGTERM, stop_server);
+
+  std::cout << "Nexpp server listening on " << server.socket_path().string()
+            << std::endl;
+  server.run();
+
+  running_server = nullptr;
+  return 0;
+}
+
+std::vector<ProjectSpec> requested_specs(const CommandLine &command_line)
+{
+  std::vector<ProjectSpec> specs =
+      command_line.get_manifest().isEmpty()
+          ? std::vector<ProjectSpec> {command_line.get_project_spec()}
+          : Manifest::load(command_line.get_manifest().toStdString());
+
+  if(command_line.should_probe_toolchain()) {
+    for(auto &spec : specs) {
+      if(spec.toolchain == Toolchain {}) {
+        spec.toolchain =
+            ToolchainProbe::shared().probe(spec.compiler, spec.standard);
+      }
+    }
+  }
+
+  return specs;
+}
+
+// Components always live under destination / workspace, so a destination
+// set in the manifest has no effect on them.
+WorkspaceSpec requested_workspace(const CommandLine &command_line)
+{
+  WorkspaceSpec workspace;
+  workspace.name        = command_line.get_workspace().toStdString();
+  workspace.destination = command_line.get_destination().toStdString();
+  workspace.projects    = requested_specs(command_line);
+
+  if(!command_line.get_manifest().isEmpty()) {
+    for(const auto &spec : workspace.projects) {
+      if(spec.destination != ProjectSpec {}.destination) {
+        qWarning() << "Manifest destination ignored for workspace component:"
+                   << spec.name.c_str();
+      }
+    }
+  }
+
+  return workspace;
+}
+
+int run_dry_run(const CommandLine &command_line)
+{
+  const ProjectGenerator generator(command_line.get_generation_options());
+  const DiskFileSystem   file_system;
+
+  try {
+    if(!command_line.get_workspace().isEmpty()) {
+      const WorkspaceSpec workspace = requested_workspace(command_line);
+      std::cout << PlanDiff::project(
+          workspace.destination / workspace.name,
+          generator.render_workspace(workspace), file_system
+      );
+      return 0;
+    }
+
+    for(const auto &spec : requested_specs(command_line)) {
+      std::cout << PlanDiff::project(
+          spec.destination / spec.name, generator.render(spec), file_system
+      );
+    }
+  } catch(const std::exception &exception) {
+    qCritical() << "Dry run failed:" << exception.what();
+    return 1;
+  }
+
+  return 0;
+}
+
+int run_import(const CommandLine &command_line)
+{
+  const DependencyStore       store;
+  const std::filesystem::path source = store.import_source(
+      googletest_dependency, command_line.get_gtest_import().toStdString()
+  );
+
+  std::cout << "Imported " << googletest_dependency.directory_name()
+            << " into " << source.string() << std::endl;
+  return 0;
+}
+
+int run_workspace(const CommandLine &command_line)
+{
+  const WorkspaceSpec    workspace = requested_workspace(command_line);
+  const ProjectGenerator generator(command_line.get_generation_options());
+  GenerationReport       report;
+  try {
+    report = generator.generate_workspace(workspace);
+  } catch(const std::exception &exception) {
+    qCritical() << "Workspace generation failed:" << exception.what();
+    return 1;
+  }
+
+  qDebug() << "Workspace generated in" << report.root.c_str() << "-"
+           << workspace.projects.size() << "components,"
+           << report.written.size() << "written," << report.unchanged.size()
+           << "unchanged";
+
+  for(const auto &conflict : report.conflicts) {
+    qWarning() << "User-modified file kept:" << conflict.data();
+  }
+
+  return 0;
+}
+
+int run_archive(const CommandLine &command_line)
+{
+  const std::string path = command_line.get_archive().toStdString();
+
+  std::ofstream     file;
+  try {
+    const auto specs = requested_specs(command_line);
+
+    if(path != "-") {
+      file.open(path, std::ios::binary | std::ios::trunc);
+      if(!file) {
+        std::cerr << "Cannot open archive: " << path << '\n';
+        return 1;
+      }
+    }
+
+    std::ostream          &out = file.is_open() ? file : std::cout;
+    const auto             writer =
+        make_archive_writer(command_line.get_archive_format(), out);
+    const ProjectGenerator generator(command_line.get_generation_options());
+
+    for(const auto &spec : specs) {
+      generator.archive(spec, *writer);
+    }
+    writer->finish();
+
+    if(file.is_open() && !file.flush()) {
+      throw std::runtime_error("Cannot write archive: " + path);
+    }
+  } catch(const std::exception &exception) {
+    qCritical() << "Archive generation failed:" << exception.what();
+
+    // A truncated archive must not be mistaken for a complete one.
+    if(file.is_open()) {
+      file.close();
+      std::error_code ignored;
+      std::filesystem::remove(path, ignored);
+    }
+    return 1;
+  }
+
+  return 0;
+}
+} // namespace
 
 int main(int argc, char **argv)
 {
-  QApplication app(argc, argv);
-  QApplication::setApplicationName("Nexpp");
-  QApplication::setApplicationVersion("0.0.1");
+  if(CommandLine::peek_mode(argc, argv) == AppMode::GUI) {
+    return run_gui(argc, argv);
+  }
 
-  CommandLine command_line(app);
+  if(CommandLine::peek_trace(argc, argv)) {
+    Trace::start();
+  }
 
-  CMakeBase   cmake_base;
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("Nexpp");
+  QCoreApplication::setApplicationVersion("0.0.1");
 
-  auto        result = cmake_base.setup_config(
-      command_line.get_project_name().toStdString(),
-      command_line.get_standard(), command_line.has_flags()
+  CommandLine       command_line(app);
+  const TraceOutput trace_output(command_line.get_trace().toStdString());
+  const StatsOutput stats_output(
+      command_line.should_print_stats(),
+      command_line.get_stats_json().toStdString()
   );
 
-  qDebug() << result;
+  if(!command_line.get_gtest_import().isEmpty()) {
+    return run_import(command_line);
+  }
+
+  if(command_line.is_dry_run()) {
+    return run_dry_run(command_line);
+  }
+
+  if(!command_line.get_archive().isEmpty()) {
+    return run_archive(command_line);
+  }
+
+  if(!command_line.get_workspace().isEmpty()) {
+    return run_workspace(command_line);
+  }
+
+  if(!command_line.get_manifest().isEmpty()) {
+    const auto specs = requested_specs(command_line);
+
+    BatchRunner runner(
+        command_line.get_jobs(), command_line.get_generation_options()
+    );
+    const auto  results = runner.run(specs);
+    BatchRunner::print_report(std::cout, results);
+
+    return std::all_of(
+               results.begin(), results.end(),
+               [](const BatchResult &result) { return result.success; }
+           )
+               ? 0
+               : 1;
+  }
+
+  if(command_line.get_mode() == AppMode::Server) {
+    return run_server(command_line);
+  }
+
+  const ProjectSpec          spec = requested_specs(command_line).front();
+  std::optional<BatchResult> result;
+
+  if(command_line.should_connect()) {
+    result = GeneratorClient::generate(
+        command_line.get_socket().toStdString(), spec
+    );
+  }
+
+  if(!result) {
+    const ProjectGenerator generator(command_line.get_generation_options());
+    result = BatchRunner::generate_one(generator, spec);
+  }
+
+  if(!result->success) {
+    qCritical() << "Project generation failed:" << result->error.c_str();
+    return 1;
+  }
+
+  const auto &report = result->report;
 
-  if(command_line.get_mode() == AppMode::CLI) {
-    app.closeAllWindows();
+  qDebug() << "Project generated in" << report.root.c_str() << "-"
+           << report.written.size() << "written," << report.unchanged.size()
+           << "unchanged (" << result->duration.count() << "us)";
 
-    return 0;
+  for(const auto &conflict : report.conflicts) {
+    qWarning() << "User-modified file kept:" << conflict.data();
   }
 
-  return app.exec();
+  return 0;
 }
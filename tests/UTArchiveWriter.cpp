@@ -0,0 +1,143 @@
+#include "Nexpp/Archive/TarArchiveWriter.h"
+#include "Nexpp/Archive/ZipArchiveWriter.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+std::uint32_t read_u32(const std::string &bytes, std::size_t offset)
+{
+  std::uint32_t value = 0;
+  for(std::size_t i = 0; i < 4; ++i) {
+    value |= static_cast<std::uint32_t>(
+                 static_cast<unsigned char>(bytes[offset + i])
+             )
+          << (8 * i);
+  }
+  return value;
+}
+
+std::uint64_t read_octal(const std::string &bytes, std::size_t offset)
+{
+  return std::stoull(bytes.substr(offset, 11), nullptr, 8);
+}
+} // namespace
+
+TEST(TarArchiveWriterTest, WritesUstarEntries)
+{
+  std::ostringstream out;
+  TarArchiveWriter   writer(out);
+  writer.add_folder("demo");
+  writer.add_file("demo/CMakeLists.txt", "project(demo)\n");
+  writer.finish();
+
+  const std::string archive = out.str();
+  ASSERT_EQ(archive.size(), 512u * 5);
+
+  EXPECT_EQ(archive.substr(0, 5), "demo/");
+  EXPECT_EQ(archive[156], '5');
+  EXPECT_EQ(archive.substr(257, 5), "ustar");
+
+  EXPECT_EQ(archive.substr(512, 19), "demo/CMakeLists.txt");
+  EXPECT_EQ(archive[512 + 156], '0');
+  EXPECT_EQ(read_octal(archive, 512 + 124), 14u);
+  EXPECT_EQ(archive.substr(1024, 14), "project(demo)\n");
+
+  EXPECT_EQ(archive.substr(1536), std::string(1024, '\0'));
+}
+
+TEST(TarArchiveWriterTest, HeaderChecksumIsValid)
+{
+  std::ostringstream out;
+  TarArchiveWriter   writer(out);
+  writer.add_file("main.cpp", "int main() {}\n");
+  writer.finish();
+
+  std::string header = out.str().substr(0, 512);
+  const auto  stored = read_octal(header, 148);
+  header.replace(148, 8, 8, ' ');
+
+  std::uint64_t sum = 0;
+  for(const char byte : header) {
+    sum += static_cast<unsigned char>(byte);
+  }
+  EXPECT_EQ(stored, sum);
+}
+
+TEST(TarArchiveWriterTest, LongPathsUsePrefix)
+{
+  const std::string  folder(120, 'a');
+  std::ostringstream out;
+  TarArchiveWriter   writer(out);
+  writer.add_file(folder + "/main.cpp", "");
+  writer.finish();
+
+  const std::string archive = out.str();
+  EXPECT_EQ(archive.substr(0, 8), "main.cpp");
+  EXPECT_EQ(archive.substr(345, 120), folder);
+}
+
+TEST(TarArchiveWriterTest, UnsplittablePathThrows)
+{
+  std::ostringstream out;
+  TarArchiveWriter   writer(out);
+  EXPECT_THROW(writer.add_file(std::string(200, 'a'), ""), std::runtime_error);
+}
+
+TEST(ZipArchiveWriterTest, Crc32MatchesReference)
+{
+  EXPECT_EQ(ZipArchiveWriter::crc32(""), 0u);
+  EXPECT_EQ(ZipArchiveWriter::crc32("123456789"), 0xCBF43926u);
+}
+
+TEST(ZipArchiveWriterTest, WritesStoredEntriesAndCentralDirectory)
+{
+  std::ostringstream out;
+  ZipArchiveWriter   writer(out);
+  writer.add_folder("demo");
+  writer.add_file("demo/main.cpp", "int main() {}\n");
+  writer.finish();
+
+  const std::string archive = out.str();
+  ASSERT_GE(archive.size(), 22u);
+
+  EXPECT_EQ(read_u32(archive, 0), 0x04034b50u);
+  EXPECT_EQ(archive.substr(30, 5), "demo/");
+
+  const std::size_t file_header = 30 + 5;
+  EXPECT_EQ(read_u32(archive, file_header), 0x04034b50u);
+  EXPECT_EQ(
+      read_u32(archive, file_header + 14),
+      ZipArchiveWriter::crc32("int main() {}\n")
+  );
+  EXPECT_EQ(read_u32(archive, file_header + 22), 14u);
+  EXPECT_EQ(archive.substr(file_header + 30, 13), "demo/main.cpp");
+  EXPECT_EQ(archive.substr(file_header + 43, 14), "int main() {}\n");
+
+  const std::size_t end = archive.size() - 22;
+  EXPECT_EQ(read_u32(archive, end), 0x06054b50u);
+  EXPECT_EQ(archive[end + 10], 2);
+
+  const std::size_t central = read_u32(archive, end + 16);
+  EXPECT_EQ(central, file_header + 43 + 14);
+  EXPECT_EQ(read_u32(archive, central), 0x02014b50u);
+}
+
+TEST(ArchiveWriterTest, FactoryHonoursFormat)
+{
+  std::ostringstream out;
+  EXPECT_NE(
+      dynamic_cast<ZipArchiveWriter *>(
+          make_archive_writer(ArchiveFormat::Zip, out).get()
+      ),
+      nullptr
+  );
+  EXPECT_NE(
+      dynamic_cast<TarArchiveWriter *>(
+          make_archive_writer(ArchiveFormat::Tar, out).get()
+      ),
+      nullptr
+  );
+}
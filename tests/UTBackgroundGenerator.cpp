@@ -0,0 +1,106 @@
+#include "Nexpp/Batch/BackgroundGenerator.h"
+#include <chrono>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+class BackgroundGeneratorTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_background/";
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  std::vector<ProjectSpec> make_specs(std::size_t count)
+  {
+    std::vector<ProjectSpec> specs(count);
+    for(std::size_t i = 0; i < count; ++i) {
+      specs[i].name        = "project" + std::to_string(i);
+      specs[i].destination = test_dir;
+    }
+    return specs;
+  }
+};
+
+TEST_F(BackgroundGeneratorTest, StartReturnsBeforeGenerationFinishes)
+{
+  BackgroundGenerator generator(2);
+  generator.start(make_specs(64));
+
+  EXPECT_EQ(generator.progress().projects_total, 64u);
+  generator.wait();
+
+  const GenerationProgress progress = generator.progress();
+  EXPECT_TRUE(progress.finished);
+  EXPECT_EQ(progress.projects_done, 64u);
+  EXPECT_EQ(progress.projects_failed, 0u);
+  EXPECT_EQ(progress.files_written, 64u * 4u);
+  EXPECT_EQ(generator.take_results().size(), 64u);
+  EXPECT_TRUE(generator.take_results().empty());
+}
+
+TEST_F(BackgroundGeneratorTest, CancelRollsBackNewProjects)
+{
+  BackgroundGenerator generator(2);
+  generator.start(make_specs(256));
+  generator.cancel();
+  generator.wait();
+
+  const GenerationProgress progress = generator.progress();
+  EXPECT_TRUE(progress.finished);
+  EXPECT_TRUE(progress.cancelled);
+  EXPECT_EQ(progress.projects_done, 256u);
+  EXPECT_TRUE(std::filesystem::is_empty(test_dir));
+}
+
+TEST_F(BackgroundGeneratorTest, CancelKeepsProjectsThatExistedBefore)
+{
+  BackgroundGenerator generator(1);
+  generator.start(make_specs(1));
+  generator.wait();
+
+  auto specs = make_specs(32);
+  generator.start(specs);
+  generator.cancel();
+  generator.wait();
+
+  EXPECT_TRUE(std::filesystem::exists(test_dir / "project0/CMakeLists.txt"));
+  EXPECT_FALSE(std::filesystem::exists(test_dir / "project31"));
+}
+
+TEST_F(BackgroundGeneratorTest, UpdatedExistingProjectsAreCounted)
+{
+  BackgroundGenerator generator(1);
+  generator.start(make_specs(2));
+  generator.wait();
+  EXPECT_EQ(generator.progress().projects_updated, 0u);
+
+  std::filesystem::remove(test_dir / "project0/CMakeLists.txt");
+  generator.start(make_specs(3));
+  generator.wait();
+
+  // project1 is unchanged and project2 is new, so only project0 counts.
+  EXPECT_EQ(generator.progress().projects_updated, 1u);
+}
+
+TEST_F(BackgroundGeneratorTest, SecondStartWhileRunningThrows)
+{
+  BackgroundGenerator generator(1);
+  generator.start(make_specs(16));
+
+  if(!generator.progress().finished) {
+    EXPECT_THROW(generator.start(make_specs(1)), std::logic_error);
+  }
+  generator.wait();
+}
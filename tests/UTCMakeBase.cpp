@@ -0,0 +1,565 @@
+#include "Nexpp/Data/CMakeBase.h"
+#include "Nexpp/Dependencies/Dependency.h"
+#include "Nexpp/Generator/ContentHasher.h"
+#include <gtest/gtest.h>
+#include <string>
+
+TEST(CMakeBaseTest, BaseConfigMatchesExpectedOutput)
+{
+  CMakeBase cmake_base;
+  EXPECT_EQ(
+      cmake_base.setup_config("Demo", Standard::CPP20, false),
+      "cmake_minimum_required(VERSION 3.28)\n"
+      "project(Demo)\n"
+      "\n"
+      "set(CMAKE_CXX_STANDARD 20)\n"
+      "\n"
+      "add_executable(\n"
+      "  Demo\n"
+      "  src/main.cpp\n"
+      ")\n"
+      "\n"
+      "target_include_directories(\n"
+      "  Demo\n"
+      "  PRIVATE\n"
+      "  ${CMAKE_CURRENT_SOURCE_DIR}/include\n"
+      ")\n"
+  );
+}
+
+TEST(CMakeBaseTest, FlagsAreAppendedForProjectTarget)
+{
+  CMakeBase         cmake_base;
+  const std::string config =
+      cmake_base.setup_config("Demo", Standard::CPP17, true);
+
+  EXPECT_NE(config.find("set(CMAKE_CXX_STANDARD 17)"), std::string::npos);
+  EXPECT_NE(
+      config.find("target_compile_options(\n  Demo\n"), std::string::npos
+  );
+  EXPECT_NE(config.find("-Wimplicit-fallthrough\n"), std::string::npos);
+}
+
+TEST(CMakeBaseTest, NoFlagsWithoutOption)
+{
+  CMakeBase cmake_base;
+  EXPECT_EQ(
+      cmake_base.setup_config("Demo", Standard::CPP23, false)
+          .find("target_compile_options"),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, NoPerfSectionsByDefault)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name = "Demo";
+
+  EXPECT_EQ(
+      cmake_base.setup_config(spec, {"iostream"}),
+      cmake_base.setup_config("Demo", Standard::CPP23, false)
+  );
+}
+
+TEST(CMakeBaseTest, IpoIsEnabledForReleaseBehindCacheOption)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name     = "my-app";
+  spec.perf.ipo = true;
+
+  const std::string config = cmake_base.setup_config(spec);
+  EXPECT_NE(
+      config.find("option(MY_APP_ENABLE_IPO \"Enable link-time optimization "
+                  "for Release builds\" ON)\n"),
+      std::string::npos
+  );
+  EXPECT_NE(config.find("check_ipo_supported("), std::string::npos);
+  EXPECT_NE(
+      config.find("      TARGET my-app\n"
+                  "      PROPERTY INTERPROCEDURAL_OPTIMIZATION_RELEASE ON\n"),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, UnityBuildIsOptIn)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name       = "Demo";
+  spec.perf.unity = true;
+
+  const std::string config = cmake_base.setup_config(spec);
+  EXPECT_NE(
+      config.find("option(DEMO_ENABLE_UNITY_BUILD \"Compile sources in unity "
+                  "(jumbo) batches\" OFF)\n"),
+      std::string::npos
+  );
+  EXPECT_NE(
+      config.find("  PROPERTIES UNITY_BUILD ${DEMO_ENABLE_UNITY_BUILD}\n"),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, PchListsGivenStandardHeaders)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name     = "Demo";
+  spec.perf.pch = true;
+
+  const std::string config =
+      cmake_base.setup_config(spec, {"iostream", "vector"});
+  EXPECT_NE(config.find("if(DEMO_ENABLE_PCH)\n"), std::string::npos);
+  EXPECT_NE(
+      config.find("    PRIVATE\n    <iostream>\n    <vector>\n  )\n"),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, PchIsSkippedWithoutHeaders)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name     = "Demo";
+  spec.perf.pch = true;
+
+  EXPECT_EQ(
+      cmake_base.setup_config(spec).find("target_precompile_headers"),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, BenchmarkTargetsFollowLibrary)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name = "Demo";
+
+  EXPECT_EQ(
+      cmake_base.setup_config(spec).find("run_benchmarks"), std::string::npos
+  );
+
+  spec.libraries = {"benchmark"};
+  const std::string config = cmake_base.setup_config(spec);
+  EXPECT_NE(
+      config.find("  Demo_bench\n  bench/Demo_bench.cpp\n"), std::string::npos
+  );
+  EXPECT_NE(config.find("  benchmark::benchmark_main\n"), std::string::npos);
+  EXPECT_NE(config.find("-DCMAKE_BUILD_TYPE=Release\n"), std::string::npos);
+  EXPECT_NE(
+      config.find("--benchmark_out=${DEMO_BENCHMARK_RESULTS}\n"),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, PresetsMatchCompilerFamily)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name     = "Demo";
+  spec.compiler = CompilerFamily::Clang;
+
+  const std::string presets = cmake_base.setup_presets(spec);
+  EXPECT_NE(presets.find("\"generator\": \"Ninja\""), std::string::npos);
+  EXPECT_NE(
+      presets.find("\"CMAKE_CXX_COMPILER\": \"clang++\""), std::string::npos
+  );
+  EXPECT_NE(
+      presets.find("\"DEMO_PGO_MODE\": \"GENERATE\""), std::string::npos
+  );
+  EXPECT_NE(presets.find("\"DEMO_PGO_MODE\": \"USE\""), std::string::npos);
+
+  spec.compiler = CompilerFamily::GCC;
+  EXPECT_NE(
+      cmake_base.setup_presets(spec).find("\"CMAKE_CXX_COMPILER\": \"g++\""),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, PgoModuleTrainsOnBenchmarkWhenPresent)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name = "Demo";
+
+  const std::string module = cmake_base.setup_pgo_module(spec);
+  EXPECT_NE(
+      module.find("  set(DEMO_PGO_TRAINING Demo_bench)\n"), std::string::npos
+  );
+  EXPECT_NE(module.find("    pgo_train\n"), std::string::npos);
+  EXPECT_NE(
+      module.find("    -fprofile-use=${DEMO_PGO_DIR}\n"), std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, PgoModuleGuardsGccPrefixPath)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name = "Demo";
+
+  const std::string module = cmake_base.setup_pgo_module(spec);
+  const std::size_t guard  = module.find(
+      "  if(CMAKE_CXX_COMPILER_VERSION VERSION_GREATER_EQUAL 12)\n"
+  );
+  ASSERT_NE(guard, std::string::npos);
+  EXPECT_GT(module.find("-fprofile-prefix-path="), guard);
+}
+
+TEST(CMakeBaseTest, PgoIncludeFollowsPlannedModule)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name = "Demo";
+
+  const std::string include =
+      "include(${CMAKE_CURRENT_SOURCE_DIR}/cmake/Pgo.cmake)\n";
+  EXPECT_EQ(cmake_base.setup_config(spec).find(include), std::string::npos);
+  EXPECT_TRUE(
+      cmake_base.setup_segment(ConfigSegment::PgoInclude, spec).empty()
+  );
+  EXPECT_NE(
+      cmake_base.setup_config(spec, {}, true).find(include), std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, ProbedToolchainIsConfiguredBeforeTargets)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name      = "Demo";
+  spec.toolchain = {"g++-13", "ccache", "mold"};
+
+  const std::string config = cmake_base.setup_config(spec);
+  const auto        target = config.find("add_executable(");
+  const auto        launcher =
+      config.find("find_program(DEMO_COMPILER_LAUNCHER ccache)\n");
+  const auto        linker =
+      config.find("  add_link_options(-fuse-ld=mold)\n");
+
+  ASSERT_NE(launcher, std::string::npos);
+  ASSERT_NE(linker, std::string::npos);
+  EXPECT_LT(launcher, target);
+  EXPECT_LT(linker, target);
+  EXPECT_NE(
+      config.find("set(CMAKE_CXX_COMPILER_LAUNCHER ${DEMO_COMPILER_LAUNCHER})"),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, PresetsUseProbedCompiler)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name               = "Demo";
+  spec.toolchain.compiler = "clang++-18";
+
+  const std::string presets = cmake_base.setup_presets(spec);
+  EXPECT_NE(
+      presets.find("\"CMAKE_C_COMPILER\": \"clang-18\""), std::string::npos
+  );
+  EXPECT_NE(
+      presets.find("\"CMAKE_CXX_COMPILER\": \"clang++-18\""),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, GTestComesFromDependencyStore)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name      = "Demo";
+  spec.libraries = {"gtest"};
+
+  const std::string config = cmake_base.setup_config(spec);
+  EXPECT_NE(config.find("nexpp_provide_googletest()\n"), std::string::npos);
+  EXPECT_NE(config.find("  GTest::gtest_main\n"), std::string::npos);
+  EXPECT_NE(
+      config.find("gtest_discover_tests(Demo_tests)\n"), std::string::npos
+  );
+
+  const std::string module = cmake_base.setup_dependencies_module();
+  EXPECT_NE(module.find("  set(name googletest-1.15.2)\n"), std::string::npos);
+  EXPECT_NE(
+      module.find("  set(package_dir ${packages}/${name}/${toolchain})\n"),
+      std::string::npos
+  );
+  EXPECT_NE(
+      module.find(
+          "        EXPECTED_HASH SHA256=" +
+          std::string(googletest_dependency.sha256) + "\n"
+      ),
+      std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, QtIsFoundNotFetched)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name      = "Demo";
+  spec.libraries = {"qt"};
+
+  const std::string config = cmake_base.setup_config(spec);
+  EXPECT_NE(
+      config.find("find_package(Qt6 REQUIRED COMPONENTS Core)\n"),
+      std::string::npos
+  );
+  EXPECT_EQ(config.find("FetchContent"), std::string::npos);
+}
+
+TEST(CMakeBaseTest, OptionPrefixIsSanitized)
+{
+  EXPECT_EQ(CMakeBase::option_prefix("my-app.v2"), "MY_APP_V2");
+}
+
+TEST(CMakeBaseTest, SegmentsConcatenateToConfig)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name               = "Demo";
+  spec.has_flags          = true;
+  spec.libraries          = {"qt", "gtest", "benchmark"};
+  spec.perf               = {true, true, true};
+  spec.toolchain.launcher = "ccache";
+  spec.toolchain.linker   = "mold";
+
+  const std::vector<std::string> headers = {"iostream"};
+
+  std::string                    segments;
+  for(std::size_t index = 0;
+      index < static_cast<std::size_t>(ConfigSegment::Count); ++index) {
+    segments += cmake_base.setup_segment(
+        static_cast<ConfigSegment>(index), spec, headers
+    );
+  }
+
+  EXPECT_EQ(segments, cmake_base.setup_config(spec, headers));
+}
+
+TEST(CMakeBaseTest, DisabledSegmentsAreEmpty)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name = "Demo";
+
+  EXPECT_TRUE(cmake_base.setup_segment(ConfigSegment::Flags, spec).empty());
+  EXPECT_TRUE(cmake_base.setup_segment(ConfigSegment::Linker, spec).empty());
+  EXPECT_EQ(
+      CMakeBase::segment_dependencies(ConfigSegment::PgoInclude), 0U
+  );
+  EXPECT_TRUE(has_field(
+      CMakeBase::segment_dependencies(ConfigSegment::Project),
+      SpecField::Standard
+  ));
+}
+
+TEST(CMakeBaseTest, WriteConfigStreamsSetupConfig)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name      = "Demo";
+  spec.has_flags = true;
+  spec.libraries = {"gtest", "benchmark"};
+  spec.perf      = {true, true, true};
+
+  const std::vector<std::string> headers = {"iostream"};
+  const std::string config = cmake_base.setup_config(spec, headers);
+
+  std::string       streamed;
+  StringSink        sink(streamed);
+  cmake_base.write_config(sink, spec, headers);
+  EXPECT_EQ(streamed, config);
+
+  ContentHasher hasher;
+  HashSink      hash_sink(hasher);
+  cmake_base.write_config(hash_sink, spec, headers);
+  EXPECT_EQ(hasher.digest(), ContentHasher::hash(config));
+}
+
+TEST(CMakeBaseTest, WorkspaceSharesOptionsAndAddsComponents)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec workspace;
+  workspace.name      = "Fleet";
+  workspace.has_flags = true;
+  workspace.libraries = {"gtest", "benchmark"};
+  workspace.perf      = {true, true, true};
+
+  ProjectSpec first;
+  first.name = "alpha";
+  ProjectSpec second;
+  second.name = "beta";
+
+  const std::string config = cmake_base.setup_workspace_config(
+      workspace, {first, second}, {"iostream"}
+  );
+
+  EXPECT_TRUE(config.starts_with(
+      "cmake_minimum_required(VERSION 3.28)\nproject(Fleet)\n"
+  ));
+  EXPECT_NE(
+      config.find("add_library(Fleet_options INTERFACE)\n"), std::string::npos
+  );
+  EXPECT_EQ(config.find("-Wall"), std::string::npos);
+  EXPECT_EQ(
+      config.find("CMAKE_INTERPROCEDURAL_OPTIMIZATION"), std::string::npos
+  );
+  EXPECT_NE(config.find("check_ipo_supported("), std::string::npos);
+  EXPECT_EQ(config.find("CMAKE_UNITY_BUILD"), std::string::npos);
+  EXPECT_NE(config.find("option(FLEET_ENABLE_UNITY_BUILD"), std::string::npos);
+  EXPECT_NE(
+      config.find("    Fleet_pch\n    OBJECT\n    common/pch.cpp\n"),
+      std::string::npos
+  );
+  EXPECT_NE(config.find("nexpp_provide_googletest()\n"), std::string::npos);
+  EXPECT_NE(
+      config.find("FetchContent_MakeAvailable(googlebenchmark)\n"),
+      std::string::npos
+  );
+  EXPECT_TRUE(config.ends_with(
+      "\nadd_subdirectory(alpha)\nadd_subdirectory(beta)\n"
+  ));
+  EXPECT_EQ(config.find("run_benchmarks"), std::string::npos);
+}
+
+TEST(CMakeBaseTest, ComponentLinksWorkspaceOptions)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec workspace;
+  workspace.name     = "Fleet";
+  workspace.perf.pch = true;
+
+  ProjectSpec spec;
+  spec.name      = "alpha";
+  spec.libraries = {"gtest"};
+  spec.perf.pch  = true;
+
+  const std::string config =
+      cmake_base.setup_component_config(spec, workspace, {"iostream"});
+
+  EXPECT_EQ(config.find("cmake_minimum_required"), std::string::npos);
+  EXPECT_EQ(config.find("project("), std::string::npos);
+  EXPECT_EQ(config.find("-Wall"), std::string::npos);
+  EXPECT_EQ(config.find("INTERPROCEDURAL"), std::string::npos);
+  EXPECT_EQ(config.find("UNITY_BUILD"), std::string::npos);
+  EXPECT_NE(
+      config.find("  alpha\n  PRIVATE\n  Fleet_options\n"), std::string::npos
+  );
+  EXPECT_NE(
+      config.find("target_precompile_headers(alpha REUSE_FROM Fleet_pch)\n"),
+      std::string::npos
+  );
+  EXPECT_NE(config.find("  alpha_tests\n"), std::string::npos);
+  EXPECT_NE(
+      config.find("gtest_discover_tests(alpha_tests)\n"), std::string::npos
+  );
+  EXPECT_EQ(config.find("nexpp_provide_googletest"), std::string::npos);
+}
+
+TEST(CMakeBaseTest, ComponentKeepsItsOwnSettings)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec workspace;
+  workspace.name      = "Fleet";
+  workspace.has_flags = true;
+  workspace.perf      = {true, true, true};
+
+  ProjectSpec tuned;
+  tuned.name      = "alpha";
+  tuned.has_flags = true;
+  tuned.perf      = {true, true, false};
+  ProjectSpec plain;
+  plain.name = "beta";
+
+  const std::string tuned_config =
+      cmake_base.setup_component_config(tuned, workspace, {"iostream"});
+  EXPECT_NE(
+      tuned_config.find("target_compile_options(\n  alpha\n  PRIVATE\n"),
+      std::string::npos
+  );
+  EXPECT_NE(
+      tuned_config.find("if(FLEET_IPO_SUPPORTED)\n  set_property(\n"
+                        "    TARGET alpha\n"),
+      std::string::npos
+  );
+  EXPECT_NE(
+      tuned_config.find("PROPERTIES UNITY_BUILD ${FLEET_ENABLE_UNITY_BUILD}\n"),
+      std::string::npos
+  );
+  EXPECT_EQ(tuned_config.find("REUSE_FROM"), std::string::npos);
+
+  const std::string plain_config =
+      cmake_base.setup_component_config(plain, workspace, {"iostream"});
+  EXPECT_EQ(plain_config.find("-Wall"), std::string::npos);
+  EXPECT_EQ(plain_config.find("INTERPROCEDURAL"), std::string::npos);
+  EXPECT_EQ(plain_config.find("UNITY_BUILD"), std::string::npos);
+  EXPECT_EQ(plain_config.find("REUSE_FROM"), std::string::npos);
+}
+
+TEST(CMakeBaseTest, ModulesTargetDeclaresModuleFileSet)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name    = "my-app";
+  spec.modules = true;
+
+  const std::string config = cmake_base.setup_config(spec);
+  EXPECT_NE(
+      config.find("  FILE_SET CXX_MODULES\n"
+                  "  FILES\n"
+                  "  src/my-app.cppm\n"
+                  "  src/my-app-greeting.cppm\n"),
+      std::string::npos
+  );
+  EXPECT_NE(config.find("option(MY_APP_IMPORT_STD "), std::string::npos);
+  EXPECT_NE(
+      config.find("target_compile_definitions(my-app PRIVATE MY_APP_IMPORT_STD)"
+      ),
+      std::string::npos
+  );
+
+  const std::string comparison = cmake_base.setup_layout_comparison(spec);
+  EXPECT_NE(
+      comparison.find("CLASSIC_SOURCE_DIR=/tmp/classic/my-app"),
+      std::string::npos
+  );
+  EXPECT_NE(
+      comparison.find("best build time: ${ratio}%\")"), std::string::npos
+  );
+}
+
+TEST(CMakeBaseTest, LayoutComparisonRepeatsGenerationOptions)
+{
+  CMakeBase   cmake_base;
+  ProjectSpec spec;
+  spec.name      = "demo";
+  spec.modules   = true;
+  spec.standard  = Standard::CPP20;
+  spec.libraries = {"gtest", "benchmark"};
+  spec.has_flags = true;
+  spec.perf.ipo  = true;
+  spec.perf.pch  = true;
+  spec.compiler  = CompilerFamily::Clang;
+
+  EXPECT_NE(
+      cmake_base.setup_layout_comparison(spec).find(
+          "#   nexpp -n demo -s 20 -l gtest,benchmark -f --perf lto,pch "
+          "--compiler clang --no-probe -d /tmp/classic\n"
+      ),
+      std::string::npos
+  );
+
+  spec                    = ProjectSpec {};
+  spec.name               = "demo";
+  spec.modules            = true;
+  spec.toolchain.launcher = "ccache";
+  EXPECT_NE(
+      cmake_base.setup_layout_comparison(spec).find(
+          "#   nexpp -n demo -s 23 --compiler gcc -d /tmp/classic\n"
+      ),
+      std::string::npos
+  );
+}
@@ -1,6 +1,8 @@
 #include "Nexpp/CommandLine/CommandLine.h"
-#include <QApplication>
+#include "Nexpp/Toolchain/ToolchainProbe.h"
+#include <QCoreApplication>
 #include <QStringList>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <string>
 #include <vector>
@@ -44,123 +46,414 @@ protected:
 TEST_F(CommandLineTest, DefaultModeIsCLI)
 {
   prepare_args({"nexpp", "-n", "TestProject"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_mode(), AppMode::CLI);
 }
 
 TEST_F(CommandLineTest, GUI_Mode_Selection)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-m", "gui"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_mode(), AppMode::GUI);
 }
 
 TEST_F(CommandLineTest, InvalidModeThrows)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-m", "invalid"});
-  QApplication app(argc, get_argv());
+  QCoreApplication app(argc, get_argv());
   EXPECT_THROW(CommandLine cmd(app), std::runtime_error);
 }
 
 TEST_F(CommandLineTest, MissingProjectNameThrows)
 {
   prepare_args({"nexpp"});
-  QApplication app(argc, get_argv());
+  QCoreApplication app(argc, get_argv());
   EXPECT_THROW(CommandLine cmd(app), std::runtime_error);
 }
 
 TEST_F(CommandLineTest, DestinationDefaultsToCurrentDirectory)
 {
   prepare_args({"nexpp", "-n", "TestProject"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_destination(), "./");
 }
 
 TEST_F(CommandLineTest, DestinationIsSetCorrectly)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-d", "/tmp/output"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_destination(), "/tmp/output");
 }
 
 TEST_F(CommandLineTest, RecognizesAllowedLibraries)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-l", "qt,gtest"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_libraries(), QStringList({"qt", "gtest"}));
 }
 
+TEST_F(CommandLineTest, RecognizesBenchmarkLibrary)
+{
+  prepare_args({"nexpp", "-n", "TestProject", "--libraries", "benchmark"});
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
+  EXPECT_EQ(cmd.get_libraries(), QStringList({"benchmark"}));
+  EXPECT_EQ(
+      cmd.get_project_spec().libraries, std::vector<std::string> {"benchmark"}
+  );
+}
+
 TEST_F(CommandLineTest, UnrecognizedLibraryThrows)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-l", "boost"});
-  QApplication app(argc, get_argv());
+  QCoreApplication app(argc, get_argv());
   EXPECT_THROW(CommandLine cmd(app), std::runtime_error);
 }
 
 TEST_F(CommandLineTest, DedupLibraries)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-l", "qt,qt"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_libraries().size(), 1);
 }
 
 TEST_F(CommandLineTest, DedupLibrariesCaseInsensitive)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-l", "qt,Qt"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_libraries().size(), 1);
 }
 
 TEST_F(CommandLineTest, CrashOnSpaceLibs)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-l", "qt, qt"});
-  QApplication app(argc, get_argv());
+  QCoreApplication app(argc, get_argv());
   EXPECT_THROW(CommandLine cmd(app), std::runtime_error);
 }
 
 TEST_F(CommandLineTest, StandardDefaultsToCPP23)
 {
   prepare_args({"nexpp", "-n", "TestProject"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_standard(), Standard::CPP23);
 }
 
 TEST_F(CommandLineTest, SelectStandard17)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-s", "17"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_standard(), Standard::CPP17);
 }
 
 TEST_F(CommandLineTest, InvalidStandardFallsBackToCPP23)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-s", "99"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_EQ(cmd.get_standard(), Standard::CPP23);
 }
 
 TEST_F(CommandLineTest, FlagsOptionIsDetected)
 {
   prepare_args({"nexpp", "-n", "TestProject", "-f"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_TRUE(cmd.has_flags());
 }
 
 TEST_F(CommandLineTest, FlagsOptionAbsentIsFalse)
 {
   prepare_args({"nexpp", "-n", "TestProject"});
-  QApplication app(argc, get_argv());
-  CommandLine  cmd(app);
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
   EXPECT_FALSE(cmd.has_flags());
 }
+
+TEST_F(CommandLineTest, ManifestMakesProjectNameOptional)
+{
+  prepare_args({"nexpp", "--manifest", "projects.json"});
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
+  EXPECT_EQ(cmd.get_manifest(), "projects.json");
+}
+
+TEST_F(CommandLineTest, WorkspaceOptionIsParsed)
+{
+  CommandLine cmd(QStringList {
+      "nexpp", "--manifest", "projects.json", "--workspace", "services"
+  });
+  EXPECT_EQ(cmd.get_workspace(), "services");
+  EXPECT_EQ(cmd.get_manifest(), "projects.json");
+}
+
+TEST_F(CommandLineTest, JobsOptionIsParsed)
+{
+  prepare_args({"nexpp", "--manifest", "projects.json", "-j", "3"});
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
+  EXPECT_EQ(cmd.get_jobs(), 3);
+}
+
+TEST_F(CommandLineTest, InvalidJobsThrows)
+{
+  prepare_args({"nexpp", "--manifest", "projects.json", "-j", "zero"});
+  QCoreApplication app(argc, get_argv());
+  EXPECT_THROW(CommandLine cmd(app), std::runtime_error);
+}
+
+TEST_F(CommandLineTest, ProjectSpecMirrorsOptions)
+{
+  prepare_args(
+      {"nexpp", "-n", "TestProject", "-d", "/tmp/output", "-s", "17", "-l",
+       "gtest", "-f"}
+  );
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
+  ProjectSpec      spec = cmd.get_project_spec();
+  EXPECT_EQ(spec.name, "TestProject");
+  EXPECT_EQ(spec.destination, "/tmp/output");
+  EXPECT_EQ(spec.standard, Standard::CPP17);
+  EXPECT_EQ(spec.libraries, std::vector<std::string>({"gtest"}));
+  EXPECT_TRUE(spec.has_flags);
+}
+
+TEST_F(CommandLineTest, SyncPolicyDefaultsToPerProject)
+{
+  prepare_args({"nexpp", "-n", "TestProject"});
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
+  EXPECT_EQ(cmd.get_sync_policy(), SyncPolicy::PerProject);
+}
+
+TEST_F(CommandLineTest, SyncPolicyIsParsed)
+{
+  prepare_args({"nexpp", "-n", "TestProject", "--sync", "file"});
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
+  EXPECT_EQ(cmd.get_sync_policy(), SyncPolicy::PerFile);
+}
+
+TEST_F(CommandLineTest, InvalidSyncPolicyThrows)
+{
+  prepare_args({"nexpp", "-n", "TestProject", "--sync", "always"});
+  QCoreApplication app(argc, get_argv());
+  EXPECT_THROW(CommandLine cmd(app), std::runtime_error);
+}
+
+TEST_F(CommandLineTest, IoBackendDefaultsToSync)
+{
+  prepare_args({"nexpp", "-n", "TestProject"});
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
+  EXPECT_EQ(cmd.get_io_backend(), IoBackend::Sync);
+}
+
+TEST_F(CommandLineTest, IoBackendUringIsParsed)
+{
+  prepare_args({"nexpp", "-n", "TestProject", "--io", "uring"});
+  QCoreApplication app(argc, get_argv());
+  CommandLine      cmd(app);
+  EXPECT_EQ(cmd.get_io_backend(), IoBackend::Uring);
+}
+
+TEST_F(CommandLineTest, SkeletonCacheReachesGenerationOptions)
+{
+  CommandLine cmd(QStringList {
+      "nexpp", "-n", "TestProject", "--skeleton-cache", "/tmp/skeletons"
+  });
+  EXPECT_EQ(cmd.get_skeleton_cache(), "/tmp/skeletons");
+  EXPECT_EQ(
+      cmd.get_generation_options().skeleton_cache,
+      std::filesystem::path("/tmp/skeletons")
+  );
+}
+
+TEST_F(CommandLineTest, ArgumentListConstructorMatchesApplication)
+{
+  CommandLine cmd(QStringList {"nexpp", "-n", "TestProject", "-s", "17"});
+  EXPECT_EQ(cmd.get_project_name(), "TestProject");
+  EXPECT_EQ(cmd.get_standard(), Standard::CPP17);
+}
+
+TEST_F(CommandLineTest, PeekModeDefaultsToCLI)
+{
+  prepare_args({"nexpp", "-n", "TestProject"});
+  EXPECT_EQ(CommandLine::peek_mode(argc, get_argv()), AppMode::CLI);
+}
+
+TEST_F(CommandLineTest, PeekModeDetectsGUI)
+{
+  prepare_args({"nexpp", "-n", "TestProject", "--mode", "GUI"});
+  EXPECT_EQ(CommandLine::peek_mode(argc, get_argv()), AppMode::GUI);
+
+  prepare_args({"nexpp", "--mode=gui"});
+  EXPECT_EQ(CommandLine::peek_mode(argc, get_argv()), AppMode::GUI);
+
+  prepare_args({"nexpp", "-mgui"});
+  EXPECT_EQ(CommandLine::peek_mode(argc, get_argv()), AppMode::GUI);
+}
+
+TEST_F(CommandLineTest, PeekModeIgnoresOtherOptions)
+{
+  prepare_args({"nexpp", "-n", "gui", "--manifest", "-m"});
+  EXPECT_EQ(CommandLine::peek_mode(argc, get_argv()), AppMode::CLI);
+}
+
+TEST_F(CommandLineTest, ServeModeDoesNotRequireProjectName)
+{
+  CommandLine cmd(QStringList {"nexpp", "--mode", "serve"});
+  EXPECT_EQ(cmd.get_mode(), AppMode::Server);
+  EXPECT_FALSE(cmd.get_socket().isEmpty());
+}
+
+TEST_F(CommandLineTest, GuiModeDoesNotRequireProjectName)
+{
+  CommandLine cmd(QStringList {"nexpp", "-m", "gui"});
+  EXPECT_EQ(cmd.get_mode(), AppMode::GUI);
+  EXPECT_TRUE(cmd.get_project_name().isEmpty());
+}
+
+TEST_F(CommandLineTest, SocketAndConnectAreParsed)
+{
+  CommandLine cmd(QStringList {
+      "nexpp", "-n", "TestProject", "--connect", "--socket", "/tmp/n.sock"
+  });
+  EXPECT_TRUE(cmd.should_connect());
+  EXPECT_EQ(cmd.get_socket(), "/tmp/n.sock");
+}
+
+TEST_F(CommandLineTest, ConnectDefaultsToFalse)
+{
+  CommandLine cmd(QStringList {"nexpp", "-n", "TestProject"});
+  EXPECT_FALSE(cmd.should_connect());
+}
+
+TEST_F(CommandLineTest, PeekModeDetectsServe)
+{
+  prepare_args({"nexpp", "-m", "serve"});
+  EXPECT_EQ(CommandLine::peek_mode(argc, get_argv()), AppMode::Server);
+}
+
+TEST_F(CommandLineTest, ArchiveFormatIsInferredFromExtension)
+{
+  CommandLine zip(QStringList {"nexpp", "-n", "demo", "--archive", "out.ZIP"});
+  EXPECT_EQ(zip.get_archive(), "out.ZIP");
+  EXPECT_EQ(zip.get_archive_format(), ArchiveFormat::Zip);
+
+  CommandLine tar(QStringList {"nexpp", "-n", "demo", "--archive", "-"});
+  EXPECT_EQ(tar.get_archive_format(), ArchiveFormat::Tar);
+}
+
+TEST_F(CommandLineTest, ArchiveFormatOptionOverridesExtension)
+{
+  CommandLine cmd(QStringList {
+      "nexpp", "-n", "demo", "--archive", "-", "--archive-format", "zip"
+  });
+  EXPECT_EQ(cmd.get_archive_format(), ArchiveFormat::Zip);
+}
+
+TEST_F(CommandLineTest, InvalidArchiveFormatThrows)
+{
+  EXPECT_THROW(
+      CommandLine(QStringList {
+          "nexpp", "-n", "demo", "--archive", "-", "--archive-format", "rar"
+      }),
+      std::runtime_error
+  );
+}
+
+TEST_F(CommandLineTest, DryRunIsParsed)
+{
+  CommandLine cmd(QStringList {"nexpp", "-n", "demo", "--dry-run"});
+  EXPECT_TRUE(cmd.is_dry_run());
+
+  CommandLine plain(QStringList {"nexpp", "-n", "demo"});
+  EXPECT_FALSE(plain.is_dry_run());
+}
+
+TEST_F(CommandLineTest, PerfOptionsAreParsed)
+{
+  CommandLine cmd(QStringList {"nexpp", "-n", "demo", "--perf", "lto,PCH"});
+  EXPECT_EQ(cmd.get_perf_options(), (PerfOptions {true, false, true}));
+  EXPECT_EQ(cmd.get_project_spec().perf, cmd.get_perf_options());
+}
+
+TEST_F(CommandLineTest, PerfAllEnablesEverything)
+{
+  CommandLine cmd(QStringList {"nexpp", "-n", "demo", "--perf", "all"});
+  EXPECT_EQ(cmd.get_perf_options(), (PerfOptions {true, true, true}));
+}
+
+TEST_F(CommandLineTest, CompilerFamilyIsParsed)
+{
+  CommandLine cmd(QStringList {"nexpp", "-n", "demo", "--compiler", "clang"});
+  EXPECT_EQ(cmd.get_compiler(), CompilerFamily::Clang);
+  EXPECT_EQ(cmd.get_project_spec().compiler, CompilerFamily::Clang);
+}
+
+TEST_F(CommandLineTest, CompilerFamilyDefaultsToDetected)
+{
+  CommandLine cmd(QStringList {"nexpp", "-n", "demo"});
+  EXPECT_EQ(cmd.get_compiler(), ToolchainProbe::detect_compiler_family());
+}
+
+TEST_F(CommandLineTest, ToolchainProbeCanBeDisabled)
+{
+  EXPECT_TRUE(
+      CommandLine(QStringList {"nexpp", "-n", "demo"}).should_probe_toolchain()
+  );
+  EXPECT_FALSE(CommandLine(QStringList {"nexpp", "-n", "demo", "--no-probe"})
+                   .should_probe_toolchain());
+}
+
+TEST_F(CommandLineTest, GTestImportDoesNotRequireName)
+{
+  const CommandLine command_line(
+      QStringList {"nexpp", "--import-gtest", "googletest-1.15.2.zip"}
+  );
+
+  EXPECT_EQ(command_line.get_gtest_import(), "googletest-1.15.2.zip");
+}
+
+TEST_F(CommandLineTest, InvalidPerfOptionThrows)
+{
+  EXPECT_THROW(
+      CommandLine(QStringList {"nexpp", "-n", "demo", "--perf", "fast"}),
+      std::runtime_error
+  );
+}
+
+TEST_F(CommandLineTest, ModulesOptionIsParsed)
+{
+  CommandLine cmd(QStringList {"nexpp", "-n", "demo", "--modules"});
+  EXPECT_TRUE(cmd.has_modules());
+  EXPECT_TRUE(cmd.get_project_spec().modules);
+  EXPECT_FALSE(CommandLine(QStringList {"nexpp", "-n", "demo"}).has_modules());
+}
+
+TEST_F(CommandLineTest, ModulesWithPreCpp20StandardThrows)
+{
+  EXPECT_THROW(
+      CommandLine(QStringList {"nexpp", "-n", "demo", "-s", "17", "--modules"}),
+      std::runtime_error
+  );
+}
+
+TEST_F(CommandLineTest, WorkspaceWithArchiveThrows)
+{
+  prepare_args(
+      {"nexpp", "-n", "TestProject", "--workspace", "fleet", "--archive",
+       "out.zip"}
+  );
+  QCoreApplication app(argc, get_argv());
+  EXPECT_THROW(CommandLine cmd(app), std::runtime_error);
+}
@@ -0,0 +1,29 @@
+#include "Nexpp/Generator/ContentHasher.h"
+#include <gtest/gtest.h>
+#include <string>
+
+TEST(ContentHasherTest, MatchesReferenceVectors)
+{
+  EXPECT_EQ(ContentHasher::hash(""), 0xEF46DB3751D8E999ULL);
+  EXPECT_EQ(ContentHasher::hash("a"), 0xD24EC4F1A98C6E5BULL);
+  EXPECT_EQ(ContentHasher::hash("abc"), 0x44BC2CF5AD770999ULL);
+  EXPECT_EQ(
+      ContentHasher::hash("Nobody inspects the spammish repetition"),
+      0xFBCEA83C8A378BF1ULL
+  );
+}
+
+TEST(ContentHasherTest, IncrementalUpdatesMatchOneShot)
+{
+  std::string content;
+  for(int i = 0; i < 1000; ++i) {
+    content += static_cast<char>(i * 7);
+  }
+
+  ContentHasher hasher;
+  for(std::size_t i = 0; i < content.size(); i += 13) {
+    hasher.update(std::string_view(content).substr(i, 13));
+  }
+
+  EXPECT_EQ(hasher.digest(), ContentHasher::hash(content));
+}
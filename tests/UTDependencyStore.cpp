@@ -0,0 +1,136 @@
+#include "Nexpp/Archive/ArchiveWriter.h"
+#include "Nexpp/Dependencies/DependencyStore.h"
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+class DependencyStoreTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_dependencies/";
+  DependencyStore       store {test_dir / "store"};
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  std::filesystem::path
+      make_archive(const std::string &top, const std::string &file)
+  {
+    const std::filesystem::path path = test_dir / (top + ".tar");
+    std::ofstream               out(path, std::ios::binary);
+    const auto writer = make_archive_writer(ArchiveFormat::Tar, out);
+    writer->add_folder(top);
+    writer->add_file(std::filesystem::path(top) / file, "project(gtest)\n");
+    writer->finish();
+    return path;
+  }
+};
+
+TEST_F(DependencyStoreTest, SourcesAreVersionedUnderRoot)
+{
+  EXPECT_EQ(
+      store.source_dir(googletest_dependency),
+      test_dir / "store/sources/googletest-1.15.2"
+  );
+  EXPECT_FALSE(store.has_source(googletest_dependency));
+}
+
+TEST_F(DependencyStoreTest, ImportExtractsArchiveIntoStore)
+{
+  const auto source = store.import_source(
+      googletest_dependency, make_archive("googletest-main", "CMakeLists.txt")
+  );
+
+  EXPECT_EQ(source, store.source_dir(googletest_dependency));
+  EXPECT_TRUE(store.has_source(googletest_dependency));
+  EXPECT_EQ(
+      std::distance(
+          std::filesystem::directory_iterator(test_dir / "store/sources"),
+          std::filesystem::directory_iterator()
+      ),
+      1
+  );
+}
+
+TEST_F(DependencyStoreTest, ImportWaitsForPackageLock)
+{
+  const std::filesystem::path archive =
+      make_archive("googletest-main", "CMakeLists.txt");
+  const std::filesystem::path lock_path =
+      test_dir / "store/packages/googletest-1.15.2.lock";
+  const std::filesystem::path released = test_dir / "released";
+  std::filesystem::create_directories(lock_path.parent_path());
+
+  int ready[2];
+  ASSERT_EQ(::pipe(ready), 0);
+
+  // POSIX record locks are per process, like the ones CMake's file(LOCK)
+  // takes, so the holder has to be another process.
+  const pid_t holder = ::fork();
+  ASSERT_GE(holder, 0);
+  if(holder == 0) {
+    const int    lock = ::open(lock_path.c_str(), O_RDWR | O_CREAT, 0644);
+    struct flock region {};
+    region.l_type = F_WRLCK;
+    ::fcntl(lock, F_SETLKW, &region);
+    [[maybe_unused]] const auto written = ::write(ready[1], "x", 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    std::ofstream(released) << "done";
+    ::_exit(0);
+  }
+
+  char signal = 0;
+  ASSERT_EQ(::read(ready[0], &signal, 1), 1);
+  store.import_source(googletest_dependency, archive);
+
+  EXPECT_TRUE(std::filesystem::exists(released));
+  int status = 0;
+  ::waitpid(holder, &status, 0);
+  ::close(ready[0]);
+  ::close(ready[1]);
+}
+
+TEST_F(DependencyStoreTest, ArchiveWithoutProjectIsRejected)
+{
+  EXPECT_THROW(
+      store.import_source(
+          googletest_dependency, make_archive("googletest", "README.md")
+      ),
+      std::runtime_error
+  );
+  EXPECT_FALSE(store.has_source(googletest_dependency));
+  EXPECT_TRUE(std::filesystem::is_empty(test_dir / "store/sources"));
+}
+
+TEST_F(DependencyStoreTest, MissingArchiveThrows)
+{
+  EXPECT_THROW(
+      store.import_source(googletest_dependency, test_dir / "missing.zip"),
+      std::runtime_error
+  );
+}
+
+TEST_F(DependencyStoreTest, EnvironmentOverridesDefaultRoot)
+{
+  setenv("NEXPP_DEPS_STORE", "/srv/nexpp-deps", 1);
+  const std::filesystem::path root = DependencyStore::default_root();
+  unsetenv("NEXPP_DEPS_STORE");
+
+  EXPECT_EQ(root, "/srv/nexpp-deps");
+}
@@ -0,0 +1,85 @@
+#include "Nexpp/FileSystem/FileCloner.h"
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <system_error>
+
+class FileClonerTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_file_cloner/";
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  void write_file(const std::filesystem::path &file_path, std::string content)
+  {
+    std::ofstream ofs(file_path, std::ios::binary);
+    ofs << content;
+  }
+
+  std::string read_file(const std::filesystem::path &file_path)
+  {
+    std::ifstream ifs(file_path, std::ios::binary);
+    return std::string(
+        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+    );
+  }
+};
+
+TEST_F(FileClonerTest, CloneCopiesContent)
+{
+  const std::string content(100'000, 'x');
+  write_file(test_dir / "source.txt", content + "end");
+
+  const std::filesystem::path target = test_dir / "target.txt";
+  FileCloner::clone(
+      (test_dir / "source.txt").c_str(), AT_FDCWD, target.c_str(), false
+  );
+
+  EXPECT_EQ(read_file(target), content + "end");
+}
+
+TEST_F(FileClonerTest, CloneReplacesExistingTarget)
+{
+  write_file(test_dir / "source.txt", "new");
+  write_file(test_dir / "target.txt", "old content that is longer");
+
+  const std::filesystem::path target = test_dir / "target.txt";
+  FileCloner::clone(
+      (test_dir / "source.txt").c_str(), AT_FDCWD, target.c_str(), true
+  );
+
+  EXPECT_EQ(read_file(target), "new");
+}
+
+TEST_F(FileClonerTest, MissingSourceThrows)
+{
+  const std::filesystem::path target = test_dir / "target.txt";
+  EXPECT_THROW(
+      FileCloner::clone(
+          (test_dir / "missing.txt").c_str(), AT_FDCWD, target.c_str(), false
+      ),
+      std::system_error
+  );
+  EXPECT_FALSE(std::filesystem::exists(target));
+}
+
+TEST_F(FileClonerTest, ReflinkProbeLeavesNoFiles)
+{
+  const bool reflinks = FileCloner::supports_reflink(test_dir.c_str());
+  EXPECT_EQ(FileCloner::supports_reflink(test_dir.c_str()), reflinks);
+  EXPECT_TRUE(std::filesystem::is_empty(test_dir));
+  EXPECT_FALSE(FileCloner::supports_reflink("missing_directory"));
+}
@@ -0,0 +1,76 @@
+#include "Nexpp/FileSystem/FileSink.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <system_error>
+
+class FileSinkTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_file_sink/";
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  std::string read_file(const std::filesystem::path &file_path)
+  {
+    std::ifstream ifs(file_path, std::ios::binary);
+    return std::string(
+        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+    );
+  }
+};
+
+TEST_F(FileSinkTest, SmallWritesAreBufferedUntilClose)
+{
+  FileSink sink(test_dir / "small.txt");
+  sink.write("first ");
+  sink.write("second");
+  EXPECT_EQ(read_file(test_dir / "small.txt"), "");
+
+  sink.close();
+  EXPECT_EQ(read_file(test_dir / "small.txt"), "first second");
+}
+
+TEST_F(FileSinkTest, LargeWritesKeepTheirOrder)
+{
+  const std::string large(100'000, 'x');
+
+  FileSink          sink(test_dir / "large.txt");
+  sink.write("head");
+  sink.write(large);
+  sink.write("tail");
+  sink.close(true);
+
+  EXPECT_EQ(read_file(test_dir / "large.txt"), "head" + large + "tail");
+}
+
+TEST_F(FileSinkTest, AppendModeKeepsExistingContent)
+{
+  {
+    FileSink sink(test_dir / "log.txt");
+    sink.write("one\n");
+    sink.close();
+  }
+
+  FileSink sink(test_dir / "log.txt", FileSink::Mode::Append);
+  sink.write("two\n");
+  sink.close();
+
+  EXPECT_EQ(read_file(test_dir / "log.txt"), "one\ntwo\n");
+}
+
+TEST_F(FileSinkTest, MissingDirectoryThrows)
+{
+  EXPECT_THROW(FileSink(test_dir / "missing" / "file.txt"), std::system_error);
+}
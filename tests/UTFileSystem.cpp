@@ -1,23 +1,39 @@
 #include "Nexpp/FileSystem/FileSystem.h"
+#include "Nexpp/FileSystem/MemoryFileSystem.h"
 #include <filesystem>
-#include <fstream>
 #include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
 #include <string>
 
-class FileSystemTest : public ::testing::Test
+enum class FileSystemKind
+{
+  Disk,
+  Memory
+};
+
+class FileSystemTest : public ::testing::TestWithParam<FileSystemKind>
 {
 protected:
-  std::filesystem::path test_dir = "test_tmp/";
+  std::filesystem::path       test_dir = "test_tmp/";
+  std::unique_ptr<FileSystem> file_system;
 
-  void                  SetUp() override
+  void                        SetUp() override
   {
-    std::filesystem::remove_all(test_dir);
-    std::filesystem::create_directory(test_dir);
+    if(GetParam() == FileSystemKind::Disk) {
+      std::filesystem::remove_all(test_dir);
+      file_system = std::make_unique<DiskFileSystem>();
+    } else {
+      file_system = std::make_unique<MemoryFileSystem>();
+    }
+    file_system->create_folder(".", "test_tmp");
   }
 
   void TearDown() override
   {
-    std::filesystem::remove_all(test_dir);
+    if(GetParam() == FileSystemKind::Disk) {
+      std::filesystem::remove_all(test_dir);
+    }
   }
 
   bool file_contains(
@@ -25,109 +41,143 @@ protected:
       const std::string           &expected_content
   )
   {
-    std::ifstream ifs(file_path);
-    std::string   content(
-        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
-    );
-    return content == expected_content;
+    return file_system->read_file(file_path) == expected_content;
   }
 
   std::string read_file(const std::filesystem::path &file_path)
   {
-    std::ifstream ifs(file_path);
-    return std::string(
-        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
-    );
+    return file_system->read_file(file_path).value_or("");
   }
 };
 
-TEST_F(FileSystemTest, CreateFolderCreatesDirectory)
+TEST_P(FileSystemTest, CreateFolderCreatesDirectory)
 {
   std::string folder_name = "my_folder";
-  FileSystem::create_folder(test_dir, folder_name);
-  EXPECT_TRUE(std::filesystem::exists(test_dir / folder_name));
-  EXPECT_TRUE(std::filesystem::is_directory(test_dir / folder_name));
+  file_system->create_folder(test_dir, folder_name);
+  EXPECT_TRUE(file_system->exists(test_dir / folder_name));
+  EXPECT_FALSE(file_system->read_file(test_dir / folder_name).has_value());
 }
 
-TEST_F(FileSystemTest, CreateFolderOnExistingDirectoryDoesNotFail)
+TEST_P(FileSystemTest, CreateFolderOnExistingDirectoryDoesNotFail)
 {
   std::string folder_name = "existing_folder";
-  FileSystem::create_folder(test_dir, folder_name);
-  FileSystem::create_folder(test_dir, folder_name);
-  EXPECT_TRUE(std::filesystem::exists(test_dir / folder_name));
+  file_system->create_folder(test_dir, folder_name);
+  file_system->create_folder(test_dir, folder_name);
+  EXPECT_TRUE(file_system->exists(test_dir / folder_name));
 }
 
-TEST_F(FileSystemTest, CreateFileCreatesEmptyFile)
+TEST_P(FileSystemTest, CreateFileCreatesEmptyFile)
 {
   std::string file_name = "my_file.txt";
-  FileSystem::create_file(test_dir, file_name);
-  EXPECT_TRUE(std::filesystem::exists(test_dir / file_name));
-  EXPECT_TRUE(std::filesystem::is_regular_file(test_dir / file_name));
+  file_system->create_file(test_dir, file_name);
+  EXPECT_TRUE(file_system->exists(test_dir / file_name));
+  EXPECT_TRUE(file_system->read_file(test_dir / file_name).has_value());
   EXPECT_EQ(read_file(test_dir / file_name), "");
 }
 
-TEST_F(FileSystemTest, CreateFileOverExistingFileTruncates)
+TEST_P(FileSystemTest, CreateFileOverExistingFileTruncates)
 {
   std::string file_name = "truncate_test.txt";
-  FileSystem::create_file(test_dir, file_name);
-  FileSystem::put_in_file(test_dir / file_name, "Old content");
-  FileSystem::create_file(test_dir, file_name);
+  file_system->create_file(test_dir, file_name);
+  file_system->put_in_file(test_dir / file_name, "Old content");
+  file_system->create_file(test_dir, file_name);
   EXPECT_EQ(read_file(test_dir / file_name), "");
 }
 
-TEST_F(FileSystemTest, PutInFileWritesContent)
+TEST_P(FileSystemTest, PutInFileWritesContent)
 {
   std::string file_name = "content.txt";
   std::string content   = "Hello, Nexpp!";
-  FileSystem::create_file(test_dir, file_name);
-  FileSystem::put_in_file(test_dir / file_name, content);
+  file_system->create_file(test_dir, file_name);
+  file_system->put_in_file(test_dir / file_name, content);
   EXPECT_TRUE(file_contains(test_dir / file_name, content));
 }
 
-TEST_F(FileSystemTest, PutInFileOverwritesExistingContent)
+TEST_P(FileSystemTest, PutInFileOverwritesExistingContent)
 {
   std::string file_name = "overwrite.txt";
-  FileSystem::create_file(test_dir, file_name);
-  FileSystem::put_in_file(test_dir / file_name, "Old content");
-  FileSystem::put_in_file(test_dir / file_name, "New content");
+  file_system->create_file(test_dir, file_name);
+  file_system->put_in_file(test_dir / file_name, "Old content");
+  file_system->put_in_file(test_dir / file_name, "New content");
   EXPECT_TRUE(file_contains(test_dir / file_name, "New content"));
 }
 
-TEST_F(FileSystemTest, PutInFileOnNonExistingFileCreatesFile)
+TEST_P(FileSystemTest, PutInFileOnNonExistingFileCreatesFile)
 {
   std::string file_name = "new_file.txt";
-  FileSystem::put_in_file(test_dir / file_name, "Auto-created file");
+  file_system->put_in_file(test_dir / file_name, "Auto-created file");
   EXPECT_TRUE(file_contains(test_dir / file_name, "Auto-created file"));
 }
 
-TEST_F(FileSystemTest, AppendInFileAppendsContent)
+TEST_P(FileSystemTest, AppendInFileAppendsContent)
 {
   std::string file_name = "append.txt";
-  FileSystem::create_file(test_dir, file_name);
-  FileSystem::put_in_file(test_dir / file_name, "Line1\n");
-  FileSystem::append_in_file(test_dir / file_name, "Line2");
+  file_system->create_file(test_dir, file_name);
+  file_system->put_in_file(test_dir / file_name, "Line1\n");
+  file_system->append_in_file(test_dir / file_name, "Line2");
   EXPECT_EQ(read_file(test_dir / file_name), "Line1\nLine2");
 }
 
-TEST_F(FileSystemTest, AppendInFileCreatesFileIfMissing)
+TEST_P(FileSystemTest, AppendInFileCreatesFileIfMissing)
 {
   std::string file_name = "append_create.txt";
-  FileSystem::append_in_file(test_dir / file_name, "First line");
+  file_system->append_in_file(test_dir / file_name, "First line");
   EXPECT_TRUE(file_contains(test_dir / file_name, "First line"));
 }
 
-TEST_F(FileSystemTest, CreateSymlinkCreatesValidSymlink)
+TEST_P(FileSystemTest, AppendAfterOtherWritesKeepsBothFiles)
+{
+  file_system->put_in_file(test_dir / "first.txt", "first");
+  file_system->put_in_file(test_dir / "second.txt", "second");
+  file_system->append_in_file(test_dir / "first.txt", " appended");
+  EXPECT_EQ(read_file(test_dir / "first.txt"), "first appended");
+  EXPECT_EQ(read_file(test_dir / "second.txt"), "second");
+}
+
+TEST_P(FileSystemTest, CreateSymlinkResolvesToTarget)
+{
+  const std::filesystem::path symlink_path = test_dir / "link_to_target.txt";
+
+  file_system->put_in_file(test_dir / "target.txt", "target");
+  file_system->create_symlink("target.txt", symlink_path);
+
+  EXPECT_TRUE(file_system->exists(symlink_path));
+  EXPECT_EQ(read_file(symlink_path), "target");
+}
+
+TEST_P(FileSystemTest, PutInFileInMissingDirectoryThrows)
+{
+  EXPECT_THROW(
+      file_system->put_in_file(test_dir / "missing" / "file.txt", "content"),
+      std::runtime_error
+  );
+}
+
+TEST_P(FileSystemTest, ReadMissingFileReturnsNothing)
+{
+  EXPECT_FALSE(file_system->exists(test_dir / "missing.txt"));
+  EXPECT_FALSE(file_system->read_file(test_dir / "missing.txt").has_value());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Implementations, FileSystemTest,
+    ::testing::Values(FileSystemKind::Disk, FileSystemKind::Memory)
+);
+
+TEST(DiskFileSystemTest, CreateSymlinkCreatesValidSymlink)
 {
-  std::string           target_file  = "target.txt";
-  std::string           symlink_name = "link_to_target.txt";
+  const std::filesystem::path test_dir = "test_tmp_symlink/";
+  std::filesystem::remove_all(test_dir);
+  std::filesystem::create_directory(test_dir);
 
+  DiskFileSystem        file_system;
   std::filesystem::path target_path =
-      std::filesystem::absolute(test_dir / target_file);
+      std::filesystem::absolute(test_dir / "target.txt");
   std::filesystem::path symlink_path =
-      std::filesystem::absolute(test_dir / symlink_name);
+      std::filesystem::absolute(test_dir / "link_to_target.txt");
 
-  FileSystem::create_file(test_dir, target_file);
-  FileSystem::create_symlink(target_path, symlink_path);
+  file_system.create_file(test_dir, "target.txt");
+  file_system.create_symlink(target_path, symlink_path);
 
   EXPECT_TRUE(std::filesystem::exists(symlink_path));
   EXPECT_TRUE(std::filesystem::is_symlink(symlink_path));
@@ -135,4 +185,52 @@ TEST_F(FileSystemTest, CreateSymlinkCreatesValidSymlink)
   auto resolved_target = std::filesystem::canonical(symlink_path);
   auto expected_target = std::filesystem::canonical(target_path);
   EXPECT_EQ(resolved_target, expected_target);
+
+  std::filesystem::remove_all(test_dir);
+}
+
+TEST(MemoryFileSystemTest, NothingTouchesTheDisk)
+{
+  MemoryFileSystem file_system;
+  file_system.create_folder(".", "memory_only");
+  file_system.put_in_file("memory_only/file.txt", "content");
+
+  EXPECT_FALSE(std::filesystem::exists("memory_only"));
+  EXPECT_EQ(file_system.read_file("memory_only/file.txt"), "content");
+}
+
+TEST(MemoryFileSystemTest, FilesShareOneContiguousArena)
+{
+  MemoryFileSystem file_system;
+  file_system.put_in_file("a.txt", "aaaa");
+  file_system.put_in_file("b.txt", "bb");
+
+  const auto first  = file_system.view_file("a.txt");
+  const auto second = file_system.view_file("b.txt");
+  ASSERT_TRUE(first && second);
+  EXPECT_EQ(first->data() + first->size(), second->data());
+  EXPECT_EQ(file_system.arena_size(), 6u);
+}
+
+TEST(MemoryFileSystemTest, OverwritesAreCompactedAway)
+{
+  MemoryFileSystem  file_system;
+  const std::string content(16 * 1024, 'x');
+  for(int i = 0; i < 64; ++i) {
+    file_system.put_in_file("file.txt", content);
+  }
+
+  EXPECT_EQ(file_system.live_bytes(), content.size());
+  EXPECT_LE(file_system.arena_size(), 128u * 1024);
+  EXPECT_EQ(file_system.read_file("file.txt"), content);
+}
+
+TEST(MemoryFileSystemTest, ClearDropsEverything)
+{
+  MemoryFileSystem file_system;
+  file_system.put_in_file("file.txt", "content");
+  file_system.clear();
+
+  EXPECT_FALSE(file_system.exists("file.txt"));
+  EXPECT_EQ(file_system.arena_size(), 0u);
 }
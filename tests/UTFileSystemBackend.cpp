@@ -0,0 +1,165 @@
+#include "Nexpp/FileSystem/FileSystemBackend.h"
+#include "Nexpp/FileSystem/UringFileSystemBackend.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+class FileSystemBackendTest : public ::testing::TestWithParam<IoBackend>
+{
+protected:
+  std::filesystem::path              test_dir = "test_tmp_backend/";
+  std::unique_ptr<FileSystemBackend> backend;
+
+  void                               SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+    backend = make_file_system_backend(GetParam());
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  std::string read_file(const std::filesystem::path &file_path)
+  {
+    std::ifstream ifs(file_path);
+    return std::string(
+        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+    );
+  }
+};
+
+TEST_P(FileSystemBackendTest, FlushCreatesNestedFoldersAndFiles)
+{
+  backend->create_folder(test_dir / "a");
+  backend->create_folder(test_dir / "a/b");
+  backend->write_file(test_dir / "a/b/file.txt", "nested", false);
+  backend->write_file(test_dir / "root.txt", "root", true);
+  backend->flush();
+
+  EXPECT_EQ(read_file(test_dir / "a/b/file.txt"), "nested");
+  EXPECT_EQ(read_file(test_dir / "root.txt"), "root");
+}
+
+TEST_P(FileSystemBackendTest, FoldersAreCreatedParentsFirst)
+{
+  backend->create_folder(test_dir / "x/y/z");
+  backend->create_folder(test_dir / "x/y");
+  backend->create_folder(test_dir / "x");
+  backend->flush();
+
+  EXPECT_TRUE(std::filesystem::is_directory(test_dir / "x/y/z"));
+}
+
+TEST_P(FileSystemBackendTest, ManyFilesSpanSeveralBatches)
+{
+  std::vector<std::string> contents;
+  for(int i = 0; i < 1000; ++i) {
+    contents.push_back(std::to_string(i));
+  }
+  for(const auto &content : contents) {
+    backend->write_file(test_dir / ("file" + content), content, false);
+  }
+  backend->flush();
+
+  for(int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(
+        read_file(test_dir / ("file" + std::to_string(i))), std::to_string(i)
+    );
+  }
+}
+
+TEST_P(FileSystemBackendTest, ExistingFileIsTruncated)
+{
+  std::ofstream(test_dir / "file.txt") << "a much longer old content";
+  backend->write_file(test_dir / "file.txt", "new", false);
+  backend->flush();
+
+  EXPECT_EQ(read_file(test_dir / "file.txt"), "new");
+}
+
+TEST_P(FileSystemBackendTest, WritingIntoMissingFolderThrows)
+{
+  EXPECT_THROW(
+      {
+        backend->write_file(test_dir / "missing/file.txt", "x", false);
+        backend->flush();
+      },
+      std::system_error
+  );
+}
+
+TEST_P(FileSystemBackendTest, SymlinkWaitsForQueuedFolder)
+{
+  backend->create_folder(test_dir / "a/b");
+  backend->create_symlink("../target.txt", test_dir / "a/b/link");
+  backend->write_file(test_dir / "a/target.txt", "linked", false);
+  backend->flush();
+
+  EXPECT_TRUE(std::filesystem::is_symlink(test_dir / "a/b/link"));
+  EXPECT_EQ(read_file(test_dir / "a/b/link"), "linked");
+}
+
+TEST_P(FileSystemBackendTest, ExistingSymlinkThrowsAfterOtherWork)
+{
+  std::filesystem::create_symlink("elsewhere", test_dir / "link");
+  EXPECT_THROW(
+      {
+        backend->create_symlink("target", test_dir / "link");
+        backend->write_file(test_dir / "file.txt", "x", false);
+        backend->flush();
+      },
+      std::system_error
+  );
+  EXPECT_EQ(std::filesystem::read_symlink(test_dir / "link"), "elsewhere");
+}
+
+TEST_P(FileSystemBackendTest, FolderUnderFileThrows)
+{
+  backend->write_file(test_dir / "plain", "x", false);
+  backend->flush();
+
+  EXPECT_THROW(
+      {
+        backend->create_folder(test_dir / "plain/sub");
+        backend->flush();
+      },
+      std::system_error
+  );
+}
+
+TEST_P(FileSystemBackendTest, DiscardDropsQueuedOperations)
+{
+  backend->write_file(test_dir / "file.txt", "x", false);
+  backend->discard();
+  backend->flush();
+
+  if(std::string(backend->name()) != "sync") {
+    EXPECT_FALSE(std::filesystem::exists(test_dir / "file.txt"));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Backends, FileSystemBackendTest,
+    ::testing::Values(IoBackend::Sync, IoBackend::Uring)
+);
+
+TEST(FileSystemBackendFactoryTest, SyncIsHonoured)
+{
+  EXPECT_STREQ(make_file_system_backend(IoBackend::Sync)->name(), "sync");
+}
+
+TEST(FileSystemBackendFactoryTest, UringFallsBackWhenUnavailable)
+{
+  const bool available = UringFileSystemBackend::create() != nullptr;
+  EXPECT_STREQ(
+      make_file_system_backend(IoBackend::Uring)->name(),
+      available ? "io_uring" : "sync"
+  );
+}
@@ -0,0 +1,157 @@
+#include "Nexpp/Server/GeneratorClient.h"
+#include "Nexpp/Server/GeneratorServer.h"
+#include "Nexpp/Server/UnixSocket.h"
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+
+class GeneratorServerTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir =
+      std::filesystem::absolute("test_tmp_server/");
+  std::filesystem::path socket_path = test_dir / "nexpp.sock";
+  ProjectSpec           spec;
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+    spec.name        = "demo";
+    spec.destination = test_dir;
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+};
+
+TEST_F(GeneratorServerTest, ClientWithoutServerFallsBack)
+{
+  EXPECT_FALSE(GeneratorClient::generate(socket_path, spec).has_value());
+}
+
+TEST_F(GeneratorServerTest, ServerGeneratesRequestedProject)
+{
+  GeneratorServer server(socket_path, 2, GenerationOptions {SyncPolicy::None});
+  std::thread     loop([&] { server.run(); });
+
+  const auto      result = GeneratorClient::generate(socket_path, spec);
+
+  server.stop();
+  loop.join();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result->success) << result->error;
+  EXPECT_EQ(result->project_name, "demo");
+  EXPECT_FALSE(result->report.written.empty());
+  EXPECT_TRUE(std::filesystem::exists(test_dir / "demo/CMakeLists.txt"));
+}
+
+TEST_F(GeneratorServerTest, ServerReportsGenerationErrors)
+{
+  GeneratorServer server(socket_path, 1, GenerationOptions {SyncPolicy::None});
+  std::thread     loop([&] { server.run(); });
+
+  spec.destination = test_dir / "missing-parent" / "file";
+  std::filesystem::create_directories(test_dir / "missing-parent");
+  std::ofstream(test_dir / "missing-parent" / "file") << "not a directory";
+
+  const auto result = GeneratorClient::generate(socket_path, spec);
+
+  server.stop();
+  loop.join();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_FALSE(result->success);
+  EXPECT_FALSE(result->error.empty());
+}
+
+TEST_F(GeneratorServerTest, IdleConnectionsDoNotHoldWorkers)
+{
+  GeneratorServer server(socket_path, 1, GenerationOptions {SyncPolicy::None});
+  std::thread     loop([&] { server.run(); });
+
+  const sockaddr_un address = make_socket_address(socket_path);
+  FileDescriptor    idle    = make_stream_socket();
+  ASSERT_EQ(
+      ::connect(
+          idle.get(), reinterpret_cast<const sockaddr *>(&address),
+          sizeof(address)
+      ),
+      0
+  );
+  send_all(idle, "{\"name\":");
+
+  const auto result = GeneratorClient::generate(socket_path, spec);
+
+  server.stop();
+  loop.join();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result->success) << result->error;
+}
+
+TEST_F(GeneratorServerTest, OversizedRequestIsRejected)
+{
+  GeneratorServer server(socket_path, 1, GenerationOptions {SyncPolicy::None});
+  std::thread     loop([&] { server.run(); });
+
+  const sockaddr_un address = make_socket_address(socket_path);
+  FileDescriptor    client  = make_stream_socket();
+  ASSERT_EQ(
+      ::connect(
+          client.get(), reinterpret_cast<const sockaddr *>(&address),
+          sizeof(address)
+      ),
+      0
+  );
+  send_all(
+      client, std::string(GeneratorServer::max_request_length + 1, 'x')
+  );
+
+  std::string            response;
+  std::array<char, 4096> chunk;
+  ssize_t                received = 0;
+  while((received = ::recv(client.get(), chunk.data(), chunk.size(), 0)) >
+        0) {
+    response.append(chunk.data(), static_cast<std::size_t>(received));
+  }
+
+  server.stop();
+  loop.join();
+
+  EXPECT_NE(response.find("Request exceeds"), std::string::npos);
+}
+
+TEST_F(GeneratorServerTest, SecondServerOnSameSocketThrows)
+{
+  GeneratorServer server(socket_path, 1);
+  EXPECT_THROW(GeneratorServer(socket_path, 1), std::runtime_error);
+}
+
+TEST_F(GeneratorServerTest, StaleSocketIsReplaced)
+{
+  {
+    GeneratorServer server(socket_path, 1);
+  }
+  std::ofstream(socket_path) << "stale";
+
+  GeneratorServer server(socket_path, 1);
+  EXPECT_EQ(server.socket_path(), socket_path);
+}
+
+TEST_F(GeneratorServerTest, SocketIsRemovedOnShutdown)
+{
+  {
+    GeneratorServer server(socket_path, 1);
+    EXPECT_TRUE(std::filesystem::exists(socket_path));
+  }
+  EXPECT_FALSE(std::filesystem::exists(socket_path));
+}
@@ -0,0 +1,49 @@
+#include "Nexpp/Generator/JobArena.h"
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <string>
+
+TEST(JobArenaTest, CurrentIsDefaultResourceOutsideScope)
+{
+  EXPECT_EQ(JobArena::current(), std::pmr::get_default_resource());
+
+  {
+    const JobArena::Scope scope;
+    EXPECT_NE(JobArena::current(), std::pmr::get_default_resource());
+  }
+
+  EXPECT_EQ(JobArena::current(), std::pmr::get_default_resource());
+}
+
+TEST(JobArenaTest, NestedScopesShareTheArena)
+{
+  const JobArena::Scope      outer;
+  std::pmr::memory_resource *arena = JobArena::current();
+
+  {
+    const JobArena::Scope inner;
+    EXPECT_EQ(JobArena::current(), arena);
+  }
+
+  EXPECT_EQ(JobArena::current(), arena);
+}
+
+TEST(JobArenaTest, OverflowGrowsTheNextArena)
+{
+  const std::size_t before = JobArena::capacity();
+
+  {
+    const JobArena::Scope scope;
+    std::pmr::string      content(before * 2, 'x', JobArena::current());
+    EXPECT_EQ(content.size(), before * 2);
+  }
+
+  EXPECT_GT(JobArena::capacity(), before * 2);
+
+  const std::size_t grown = JobArena::capacity();
+  {
+    const JobArena::Scope scope;
+    std::pmr::string      content(before, 'x', JobArena::current());
+  }
+  EXPECT_EQ(JobArena::capacity(), grown);
+}
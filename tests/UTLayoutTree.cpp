@@ -0,0 +1,104 @@
+#include "Nexpp/FileSystem/FileDescriptor.h"
+#include "Nexpp/FileSystem/LayoutTree.h"
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class LayoutTreeTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_layout/";
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  std::string read_file(const std::filesystem::path &file_path)
+  {
+    std::ifstream ifs(file_path);
+    return std::string(
+        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+    );
+  }
+};
+
+TEST_F(LayoutTreeTest, ParentFoldersAreImplied)
+{
+  LayoutTree layout;
+  layout.add_file("src/main.cpp", "int main() {}\n");
+  layout.add_folder("src");
+  layout.add_folder("include");
+
+  std::vector<std::string> visited;
+  layout.for_each([&](const auto &path, const LayoutNode &) {
+    visited.emplace_back(path);
+  });
+
+  EXPECT_EQ(layout.size(), 3u);
+  EXPECT_EQ(
+      visited, (std::vector<std::string> {"include", "src", "src/main.cpp"})
+  );
+}
+
+TEST_F(LayoutTreeTest, ConflictingEntriesAreRejected)
+{
+  LayoutTree layout;
+  layout.add_file("CMakeLists.txt", "project(demo)\n");
+
+  EXPECT_THROW(layout.add_file("CMakeLists.txt", ""), std::runtime_error);
+  EXPECT_THROW(layout.add_folder("CMakeLists.txt"), std::runtime_error);
+  EXPECT_THROW(layout.add_file("CMakeLists.txt/x", ""), std::runtime_error);
+  EXPECT_THROW(layout.add_file("../escape.txt", ""), std::runtime_error);
+  EXPECT_THROW(layout.add_file("/tmp/absolute.txt", ""), std::runtime_error);
+}
+
+TEST_F(LayoutTreeTest, HashIgnoresInsertionOrderButNotContent)
+{
+  LayoutTree first;
+  first.add_file("a.txt", "a");
+  first.add_file("src/b.txt", "b");
+
+  LayoutTree second;
+  second.add_file("src/b.txt", "b");
+  second.add_file("a.txt", "a");
+
+  LayoutTree third;
+  third.add_file("a.txt", "a");
+  third.add_file("src/b.txt", "c");
+
+  EXPECT_EQ(first.hash(), second.hash());
+  EXPECT_NE(first.hash(), third.hash());
+}
+
+TEST_F(LayoutTreeTest, MaterializeWritesWholeTree)
+{
+  LayoutTree layout;
+  layout.add_folder("include");
+  layout.add_file("src/main.cpp", "int main() {}\n");
+  layout.add_symlink("compile_commands.json", "build/compile_commands.json");
+
+  const FileDescriptor root(
+      ::open(test_dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)
+  );
+  ASSERT_TRUE(root.is_valid());
+  layout.materialize(root.get(), true);
+  layout.materialize(root.get(), false);
+
+  EXPECT_TRUE(std::filesystem::is_directory(test_dir / "include"));
+  EXPECT_EQ(read_file(test_dir / "src/main.cpp"), "int main() {}\n");
+  EXPECT_EQ(
+      std::filesystem::read_symlink(test_dir / "compile_commands.json"),
+      "build/compile_commands.json"
+  );
+}
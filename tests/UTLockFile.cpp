@@ -0,0 +1,43 @@
+#include "Nexpp/Generator/LockFile.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+TEST(LockFileTest, SerializeThenParseRoundTrips)
+{
+  LockFile lock;
+  lock.set("CMakeLists.txt", 0x1234);
+  lock.set("src/main.cpp", 0xFEDCBA9876543210ULL);
+
+  const LockFile parsed = LockFile::parse(lock.serialize());
+  EXPECT_EQ(parsed, lock);
+  EXPECT_EQ(parsed.find("CMakeLists.txt"), 0x1234);
+  EXPECT_EQ(parsed.find("src/main.cpp"), 0xFEDCBA9876543210ULL);
+}
+
+TEST(LockFileTest, EntriesAreSortedAndZeroPadded)
+{
+  LockFile lock;
+  lock.set("src/main.cpp", 2);
+  lock.set("CMakeLists.txt", 1);
+
+  EXPECT_EQ(
+      lock.serialize(), "# nexpp-lock v1\n"
+                        "0000000000000001  CMakeLists.txt\n"
+                        "0000000000000002  src/main.cpp\n"
+  );
+}
+
+TEST(LockFileTest, UnknownPathIsNotFound)
+{
+  EXPECT_FALSE(LockFile().find("missing.txt").has_value());
+}
+
+TEST(LockFileTest, MissingLockFileLoadsEmpty)
+{
+  EXPECT_EQ(LockFile::load("does_not_exist"), LockFile());
+}
+
+TEST(LockFileTest, CorruptedEntryThrows)
+{
+  EXPECT_THROW(LockFile::parse("not-a-hash file\n"), std::runtime_error);
+}
@@ -0,0 +1,148 @@
+#include "Nexpp/Batch/Manifest.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+TEST(ManifestTest, ParsesProjectList)
+{
+  const auto specs = Manifest::parse(R"({
+    "projects": [
+      { "name": "alpha", "destination": "/tmp/out", "standard": 17,
+        "libraries": ["gtest"], "flags": true },
+      { "name": "beta" }
+    ]
+  })");
+
+  ASSERT_EQ(specs.size(), 2);
+  EXPECT_EQ(specs[0].name, "alpha");
+  EXPECT_EQ(specs[0].destination, "/tmp/out");
+  EXPECT_EQ(specs[0].standard, Standard::CPP17);
+  EXPECT_EQ(specs[0].libraries, std::vector<std::string>({"gtest"}));
+  EXPECT_TRUE(specs[0].has_flags);
+  EXPECT_EQ(specs[1].name, "beta");
+  EXPECT_EQ(specs[1].standard, Standard::CPP23);
+  EXPECT_FALSE(specs[1].has_flags);
+}
+
+TEST(ManifestTest, DefaultsApplyToEveryProject)
+{
+  const auto specs = Manifest::parse(R"({
+    "defaults": { "destination": "services", "standard": "20", "flags": true },
+    "projects": [ { "name": "alpha" }, { "name": "beta", "flags": false } ]
+  })");
+
+  ASSERT_EQ(specs.size(), 2);
+  EXPECT_EQ(specs[0].destination, "services");
+  EXPECT_EQ(specs[0].standard, Standard::CPP20);
+  EXPECT_TRUE(specs[0].has_flags);
+  EXPECT_EQ(specs[1].destination, "services");
+  EXPECT_FALSE(specs[1].has_flags);
+}
+
+TEST(ManifestTest, AcceptsTopLevelArray)
+{
+  const auto specs = Manifest::parse(R"([{ "name": "alpha" }])");
+  ASSERT_EQ(specs.size(), 1);
+  EXPECT_EQ(specs[0].name, "alpha");
+}
+
+TEST(ManifestTest, DedupLibrariesCaseInsensitive)
+{
+  const auto specs =
+      Manifest::parse(R"([{ "name": "alpha", "libraries": ["qt", "Qt"] }])");
+  ASSERT_EQ(specs.size(), 1);
+  EXPECT_EQ(specs[0].libraries, std::vector<std::string>({"qt"}));
+}
+
+TEST(ManifestTest, PerfOptionsAreParsed)
+{
+  const auto specs =
+      Manifest::parse(R"([{ "name": "alpha", "perf": ["lto", "pch"] }])");
+  ASSERT_EQ(specs.size(), 1);
+  EXPECT_EQ(specs[0].perf, (PerfOptions {true, false, true}));
+}
+
+TEST(ManifestTest, UnrecognizedPerfOptionThrows)
+{
+  EXPECT_THROW(
+      Manifest::parse(R"([{ "name": "alpha", "perf": ["fast"] }])"),
+      std::runtime_error
+  );
+}
+
+TEST(ManifestTest, CompilerFamilyIsParsed)
+{
+  const auto specs =
+      Manifest::parse(R"([{ "name": "alpha", "compiler": "Clang" }])");
+  ASSERT_EQ(specs.size(), 1);
+  EXPECT_EQ(specs[0].compiler, CompilerFamily::Clang);
+}
+
+TEST(ManifestTest, PinnedToolchainIsParsed)
+{
+  const auto specs = Manifest::parse(
+      R"([{ "name": "alpha", "toolchain": { "compiler": "g++-13",
+            "launcher": "ccache", "linker": "mold" } }])"
+  );
+  ASSERT_EQ(specs.size(), 1);
+  EXPECT_EQ(specs[0].toolchain, (Toolchain {"g++-13", "ccache", "mold"}));
+}
+
+TEST(ManifestTest, UnrecognizedCompilerThrows)
+{
+  EXPECT_THROW(
+      Manifest::parse(R"([{ "name": "alpha", "compiler": "msvc" }])"),
+      std::runtime_error
+  );
+}
+
+TEST(ManifestTest, MissingNameThrows)
+{
+  EXPECT_THROW(Manifest::parse(R"([{ "standard": 17 }])"), std::runtime_error);
+}
+
+TEST(ManifestTest, DuplicateProjectRootThrows)
+{
+  EXPECT_THROW(
+      Manifest::parse(R"([
+        { "name": "alpha", "destination": "out" },
+        { "name": "alpha", "destination": "./out/", "flags": true }
+      ])"),
+      std::runtime_error
+  );
+  EXPECT_EQ(
+      Manifest::parse(R"([
+        { "name": "alpha", "destination": "out" },
+        { "name": "alpha", "destination": "other" }
+      ])")
+          .size(),
+      2
+  );
+}
+
+TEST(ManifestTest, UnrecognizedLibraryThrows)
+{
+  EXPECT_THROW(
+      Manifest::parse(R"([{ "name": "alpha", "libraries": ["boost"] }])"),
+      std::runtime_error
+  );
+}
+
+TEST(ManifestTest, InvalidStandardThrows)
+{
+  EXPECT_THROW(
+      Manifest::parse(R"([{ "name": "alpha", "standard": 99 }])"),
+      std::runtime_error
+  );
+}
+
+TEST(ManifestTest, InvalidJsonThrows)
+{
+  EXPECT_THROW(Manifest::parse("{ not json"), std::runtime_error);
+}
+
+TEST(ManifestTest, MissingFileThrows)
+{
+  EXPECT_THROW(
+      Manifest::load("does_not_exist.json"), std::runtime_error
+  );
+}
@@ -0,0 +1,48 @@
+#include "Nexpp/Generator/PathList.h"
+#include <cstring>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST(PathListTest, PathsKeepTheirOrder)
+{
+  PathList paths;
+  paths.reserve(3, 40);
+  paths.push_back("CMakeLists.txt");
+  paths.push_back("src/main.cpp");
+  paths.push_back("");
+
+  ASSERT_EQ(paths.size(), 3u);
+  EXPECT_EQ(paths.front(), "CMakeLists.txt");
+  EXPECT_EQ(paths[1], "src/main.cpp");
+  EXPECT_TRUE(paths[2].empty());
+
+  std::vector<std::string_view> visited;
+  for(const auto path : paths) {
+    visited.push_back(path);
+  }
+  EXPECT_EQ(
+      visited,
+      (std::vector<std::string_view> {"CMakeLists.txt", "src/main.cpp", ""})
+  );
+}
+
+TEST(PathListTest, EntriesAreCStrings)
+{
+  const PathList paths = {"include/demo.h", "src/main.cpp"};
+
+  EXPECT_EQ(std::strcmp(paths[0].data(), "include/demo.h"), 0);
+  EXPECT_EQ(std::strcmp(paths[1].data(), "src/main.cpp"), 0);
+}
+
+TEST(PathListTest, ListsCompareByContent)
+{
+  PathList built;
+  built.push_back("a/b");
+  built.push_back("c");
+
+  EXPECT_EQ(built, (PathList {"a/b", "c"}));
+  EXPECT_NE(built, (PathList {"a", "b/c"}));
+  EXPECT_TRUE(PathList().empty());
+}
@@ -0,0 +1,133 @@
+#include "Nexpp/FileSystem/MemoryFileSystem.h"
+#include "Nexpp/Generator/ContentHasher.h"
+#include "Nexpp/Generator/LockFile.h"
+#include "Nexpp/Generator/PlanDiff.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+
+class PlanDiffTest : public ::testing::Test
+{
+protected:
+  MemoryFileSystem file_system;
+  ProjectPlan      plan;
+
+  void             SetUp() override
+  {
+    plan.folders = {"src"};
+    plan.files   = {
+        {"CMakeLists.txt", "project(demo)\nadd_executable(demo)\n"},
+        {"src/main.cpp", "int main() {}\n"},
+    };
+  }
+
+  void write_project(std::string_view cmake, std::string_view main)
+  {
+    LockFile lock;
+    lock.set("CMakeLists.txt", ContentHasher::hash(cmake));
+    lock.set("src/main.cpp", ContentHasher::hash(main));
+
+    file_system.create_folder(".", "demo");
+    file_system.create_folder("demo", "src");
+    file_system.put_in_file("demo/CMakeLists.txt", cmake);
+    file_system.put_in_file("demo/src/main.cpp", main);
+    file_system.put_in_file("demo/.nexpp-lock", lock.serialize());
+  }
+};
+
+TEST(UnifiedDiffTest, IdenticalTextsProduceNothing)
+{
+  EXPECT_EQ(PlanDiff::unified("a\nb\n", "a\nb\n", "a/x", "b/x"), "");
+}
+
+TEST(UnifiedDiffTest, ChangedLineIsReportedWithContext)
+{
+  const std::string diff = PlanDiff::unified(
+      "1\n2\n3\n4\n5\n6\n7\n8\n", "1\n2\n3\n4\nfive\n6\n7\n8\n", "a/x", "b/x"
+  );
+  EXPECT_EQ(
+      diff, "--- a/x\n"
+            "+++ b/x\n"
+            "@@ -2,7 +2,7 @@\n"
+            " 2\n"
+            " 3\n"
+            " 4\n"
+            "-5\n"
+            "+five\n"
+            " 6\n"
+            " 7\n"
+            " 8\n"
+  );
+}
+
+TEST(UnifiedDiffTest, DistantChangesProduceSeparateHunks)
+{
+  std::string before;
+  for(int i = 1; i <= 20; ++i) {
+    before += std::to_string(i) + "\n";
+  }
+  std::string after = before;
+  after.replace(0, 2, "one\n");
+  after.replace(after.find("20\n"), 3, "twenty\n");
+
+  const std::string diff = PlanDiff::unified(before, after, "a/x", "b/x");
+  EXPECT_NE(diff.find("@@ -1,4 +1,4 @@\n-1\n+one\n"), std::string::npos);
+  EXPECT_NE(diff.find("@@ -17,4 +17,4 @@\n"), std::string::npos);
+  EXPECT_NE(diff.find("-20\n+twenty\n"), std::string::npos);
+}
+
+TEST(UnifiedDiffTest, NewFileIsDiffedAgainstDevNull)
+{
+  EXPECT_EQ(
+      PlanDiff::unified("", "a\nb", "/dev/null", "b/x"),
+      "--- /dev/null\n"
+      "+++ b/x\n"
+      "@@ -0,0 +1,2 @@\n"
+      "+a\n"
+      "+b\n"
+      "\\ No newline at end of file\n"
+  );
+}
+
+TEST_F(PlanDiffTest, MissingProjectShowsEveryFileAsNew)
+{
+  const std::string diff = PlanDiff::project("demo", plan, file_system);
+  EXPECT_NE(
+      diff.find("--- /dev/null\n+++ b/demo/CMakeLists.txt\n"),
+      std::string::npos
+  );
+  EXPECT_NE(
+      diff.find("--- /dev/null\n+++ b/demo/src/main.cpp\n"), std::string::npos
+  );
+}
+
+TEST_F(PlanDiffTest, UpToDateProjectProducesNoDiff)
+{
+  write_project(plan.files[0].content, plan.files[1].content);
+  EXPECT_EQ(PlanDiff::project("demo", plan, file_system), "");
+}
+
+TEST_F(PlanDiffTest, OutdatedFileIsDiffed)
+{
+  write_project("project(demo)\n", plan.files[1].content);
+
+  const std::string diff = PlanDiff::project("demo", plan, file_system);
+  EXPECT_EQ(
+      diff, "--- a/demo/CMakeLists.txt\n"
+            "+++ b/demo/CMakeLists.txt\n"
+            "@@ -1,1 +1,2 @@\n"
+            " project(demo)\n"
+            "+add_executable(demo)\n"
+  );
+}
+
+TEST_F(PlanDiffTest, UserModifiedFileIsReportedAsKept)
+{
+  write_project(plan.files[0].content, plan.files[1].content);
+  file_system.put_in_file("demo/src/main.cpp", "int main() { return 1; }\n");
+
+  EXPECT_EQ(
+      PlanDiff::project("demo", plan, file_system),
+      "# user-modified, would be kept: demo/src/main.cpp\n"
+  );
+}
@@ -0,0 +1,106 @@
+#include "Nexpp/Generator/PreviewRenderer.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+void expect_same_plan(const ProjectPlan &preview, const ProjectSpec &spec)
+{
+  const ProjectPlan rendered = ProjectGenerator().render(spec);
+
+  EXPECT_EQ(preview.folders, rendered.folders);
+  ASSERT_EQ(preview.files.size(), rendered.files.size());
+  for(std::size_t index = 0; index < rendered.files.size(); ++index) {
+    EXPECT_EQ(preview.files[index].path, rendered.files[index].path);
+    EXPECT_EQ(preview.files[index].content, rendered.files[index].content);
+  }
+}
+} // namespace
+
+TEST(PreviewRendererTest, FirstUpdateMatchesGenerator)
+{
+  PreviewRenderer preview;
+  ProjectSpec     spec;
+  spec.name      = "Demo";
+  spec.libraries = {"gtest", "benchmark"};
+  spec.perf.pch  = true;
+
+  expect_same_plan(preview.update(spec), spec);
+}
+
+TEST(PreviewRendererTest, UnchangedSpecRendersNothing)
+{
+  PreviewRenderer preview;
+  ProjectSpec     spec;
+  spec.name = "Demo";
+
+  preview.update(spec);
+  EXPECT_GT(preview.rendered_parts(), 0U);
+
+  preview.update(spec);
+  EXPECT_EQ(preview.rendered_parts(), 0U);
+}
+
+TEST(PreviewRendererTest, FlagsToggleRendersOnlyFlagsSegment)
+{
+  PreviewRenderer preview;
+  ProjectSpec     spec;
+  spec.name = "Demo";
+  preview.update(spec);
+
+  spec.has_flags = true;
+  expect_same_plan(preview.update(spec), spec);
+  EXPECT_EQ(preview.rendered_parts(), 1U);
+
+  spec.standard = Standard::CPP17;
+  expect_same_plan(preview.update(spec), spec);
+  EXPECT_EQ(preview.rendered_parts(), 1U);
+}
+
+TEST(PreviewRendererTest, EditsStayInSyncWithGenerator)
+{
+  PreviewRenderer preview;
+  ProjectSpec     spec;
+
+  for(const char character : std::string("my-app")) {
+    spec.name += character;
+    expect_same_plan(preview.update(spec), spec);
+  }
+
+  spec.libraries = {"qt", "gtest"};
+  expect_same_plan(preview.update(spec), spec);
+
+  spec.libraries = {"benchmark"};
+  spec.perf      = {true, true, true};
+  expect_same_plan(preview.update(spec), spec);
+
+  spec.compiler           = CompilerFamily::Clang;
+  spec.toolchain.launcher = "sccache";
+  expect_same_plan(preview.update(spec), spec);
+
+  spec.name = "renamed";
+  expect_same_plan(preview.update(spec), spec);
+}
+
+TEST(PreviewRendererTest, ModulesToggleStaysInSyncWithGenerator)
+{
+  PreviewRenderer preview;
+  ProjectSpec     spec;
+  spec.name      = "Demo";
+  spec.libraries = {"gtest"};
+  spec.perf.pch  = true;
+  preview.update(spec);
+
+  spec.modules = true;
+  expect_same_plan(preview.update(spec), spec);
+
+  spec.name = "renamed";
+  expect_same_plan(preview.update(spec), spec);
+
+  spec.has_flags = true;
+  spec.standard  = Standard::CPP20;
+  expect_same_plan(preview.update(spec), spec);
+
+  spec.modules = false;
+  expect_same_plan(preview.update(spec), spec);
+}
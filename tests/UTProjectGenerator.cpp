@@ -0,0 +1,396 @@
+#include "Nexpp/FileSystem/MemoryFileSystem.h"
+#include "Nexpp/Generator/LockFile.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+class ProjectGeneratorTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_generator/";
+  ProjectGenerator      generator {GenerationOptions {SyncPolicy::None}};
+  ProjectSpec           spec;
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+    spec.name        = "demo";
+    spec.destination = test_dir;
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  std::string read_file(const std::filesystem::path &file_path)
+  {
+    std::ifstream ifs(file_path);
+    return std::string(
+        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+    );
+  }
+};
+
+// Generates into memory: incremental updates are checked without touching
+// the disk.
+class InMemoryProjectGeneratorTest : public ::testing::Test
+{
+protected:
+  MemoryFileSystem file_system;
+  ProjectGenerator generator {GenerationOptions {}, file_system};
+  ProjectSpec      spec;
+
+  void             SetUp() override
+  {
+    spec.name        = "demo";
+    spec.destination = "/projects";
+  }
+
+  std::string read_file(const std::filesystem::path &path)
+  {
+    return file_system.read_file(path).value_or(std::string());
+  }
+};
+
+TEST_F(ProjectGeneratorTest, FreshProjectWritesFilesAndLock)
+{
+  const GenerationReport report = generator.generate(spec);
+
+  EXPECT_EQ(report.root, test_dir / "demo");
+  EXPECT_EQ(report.written.size(), 4);
+  EXPECT_TRUE(std::filesystem::exists(test_dir / "demo/CMakeLists.txt"));
+  EXPECT_TRUE(std::filesystem::exists(test_dir / "demo/CMakePresets.json"));
+  EXPECT_TRUE(std::filesystem::exists(test_dir / "demo/src/main.cpp"));
+  EXPECT_TRUE(std::filesystem::exists(test_dir / "demo/cmake/Pgo.cmake"));
+  EXPECT_NE(
+      read_file(test_dir / "demo/CMakeLists.txt").find("cmake/Pgo.cmake"),
+      std::string::npos
+  );
+  EXPECT_TRUE(std::filesystem::is_directory(test_dir / "demo/include"));
+  EXPECT_TRUE(
+      LockFile::load(test_dir / "demo").find("CMakeLists.txt").has_value()
+  );
+}
+
+TEST_F(ProjectGeneratorTest, RerunWithSameOptionsTouchesNothing)
+{
+  generator.generate(spec);
+  const auto before =
+      std::filesystem::last_write_time(test_dir / "demo/CMakeLists.txt");
+  const auto lock_before =
+      std::filesystem::last_write_time(test_dir / "demo/.nexpp-lock");
+
+  const GenerationReport report = generator.generate(spec);
+
+  EXPECT_TRUE(report.written.empty());
+  EXPECT_EQ(report.unchanged.size(), 4);
+  EXPECT_EQ(
+      std::filesystem::last_write_time(test_dir / "demo/CMakeLists.txt"),
+      before
+  );
+  EXPECT_EQ(
+      std::filesystem::last_write_time(test_dir / "demo/.nexpp-lock"),
+      lock_before
+  );
+}
+
+TEST_F(ProjectGeneratorTest, LayoutCanBeHashedBeforeWriting)
+{
+  const LayoutTree layout = generator.layout(spec);
+
+  EXPECT_EQ(layout.size(), 8u);
+  EXPECT_EQ(layout.hash(), generator.layout(spec).hash());
+  EXPECT_FALSE(std::filesystem::exists(test_dir / "demo"));
+
+  spec.has_flags = true;
+  EXPECT_NE(layout.hash(), generator.layout(spec).hash());
+}
+
+TEST_F(ProjectGeneratorTest, PchUsesHeadersIncludedBySources)
+{
+  spec.perf.pch = true;
+
+  const ProjectPlan plan = generator.render(spec);
+  EXPECT_NE(
+      plan.files.front().content.find("    PRIVATE\n    <iostream>\n"),
+      std::string::npos
+  );
+}
+
+TEST_F(ProjectGeneratorTest, BenchmarkLibraryAddsBenchSource)
+{
+  spec.libraries = {"benchmark"};
+
+  const ProjectPlan plan = generator.render(spec);
+  EXPECT_NE(
+      std::ranges::find(plan.folders, std::string_view("bench")),
+      plan.folders.end()
+  );
+  const auto bench = std::ranges::find(
+      plan.files, std::string_view("bench/demo_bench.cpp"),
+      &PlannedFile::path
+  );
+  ASSERT_NE(bench, plan.files.end());
+  EXPECT_NE(
+      bench->content.find("BENCHMARK_REGISTER_F(SampleFixture, Accumulate)"),
+      std::string::npos
+  );
+}
+
+TEST_F(ProjectGeneratorTest, GTestLibraryAddsTestsAndDependencyModule)
+{
+  spec.libraries = {"gtest"};
+
+  const ProjectPlan plan = generator.render(spec);
+  EXPECT_NE(
+      std::ranges::find(
+          plan.files, std::filesystem::path("tests/demo_test.cpp"),
+          &PlannedFile::path
+      ),
+      plan.files.end()
+  );
+  EXPECT_NE(
+      std::ranges::find(
+          plan.files, std::filesystem::path("cmake/Dependencies.cmake"),
+          &PlannedFile::path
+      ),
+      plan.files.end()
+  );
+}
+
+TEST_F(ProjectGeneratorTest, DeletedFileIsRestored)
+{
+  generator.generate(spec);
+  std::filesystem::remove(test_dir / "demo/src/main.cpp");
+
+  const GenerationReport report = generator.generate(spec);
+
+  ASSERT_EQ(report.written.size(), 1);
+  EXPECT_TRUE(std::filesystem::exists(test_dir / "demo/src/main.cpp"));
+}
+
+namespace {
+class RecordingArchiveWriter final : public ArchiveWriter
+{
+public:
+  void add_folder(const std::filesystem::path &path) override
+  {
+    folders.push_back(path);
+  }
+
+  void add_file(
+      const std::filesystem::path &path, std::string_view content
+  ) override
+  {
+    files.emplace_back(path, std::string(content));
+  }
+
+  void finish() override {}
+
+  std::vector<std::filesystem::path>                         folders;
+  std::vector<std::pair<std::filesystem::path, std::string>> files;
+};
+} // namespace
+
+TEST_F(ProjectGeneratorTest, ArchiveStreamsPlanWithoutTouchingDisk)
+{
+  RecordingArchiveWriter writer;
+  generator.archive(spec, writer);
+
+  EXPECT_FALSE(std::filesystem::exists(test_dir / "demo"));
+  ASSERT_FALSE(writer.folders.empty());
+  EXPECT_EQ(writer.folders.front(), "demo");
+
+  ASSERT_EQ(writer.files.size(), 5u);
+  EXPECT_EQ(writer.files[0].first, "demo/CMakeLists.txt");
+  EXPECT_EQ(writer.files[1].first, "demo/src/main.cpp");
+  EXPECT_EQ(writer.files[2].first, "demo/CMakePresets.json");
+  EXPECT_EQ(writer.files[3].first, "demo/cmake/Pgo.cmake");
+  EXPECT_EQ(writer.files[4].first, "demo/.nexpp-lock");
+
+  const LockFile lock = LockFile::parse(writer.files[4].second);
+  EXPECT_TRUE(lock.find("CMakeLists.txt").has_value());
+  EXPECT_TRUE(lock.find("src/main.cpp").has_value());
+}
+
+TEST_F(ProjectGeneratorTest, WorkspaceGeneratesComponentsUnderOneRoot)
+{
+  ProjectSpec alpha;
+  alpha.name      = "alpha";
+  alpha.libraries = {"gtest"};
+  alpha.perf.pch  = true;
+  ProjectSpec beta;
+  beta.name     = "beta";
+  beta.standard = Standard::CPP20;
+
+  WorkspaceSpec workspace;
+  workspace.name        = "fleet";
+  workspace.destination = test_dir;
+  workspace.projects    = {alpha, beta};
+
+  const GenerationReport      report = generator.generate_workspace(workspace);
+  const std::filesystem::path root   = test_dir / "fleet";
+
+  EXPECT_EQ(report.root, root);
+  EXPECT_EQ(report.written.size(), 8u);
+  EXPECT_TRUE(std::filesystem::exists(root / "alpha/src/main.cpp"));
+  EXPECT_TRUE(std::filesystem::exists(root / "alpha/tests/alpha_test.cpp"));
+  EXPECT_TRUE(std::filesystem::exists(root / "beta/src/main.cpp"));
+  EXPECT_TRUE(std::filesystem::exists(root / "cmake/Dependencies.cmake"));
+  EXPECT_TRUE(std::filesystem::exists(root / "common/pch.cpp"));
+  EXPECT_FALSE(std::filesystem::exists(root / "alpha/CMakePresets.json"));
+  EXPECT_TRUE(std::filesystem::exists(root / LockFile::file_name));
+
+  const std::string config = read_file(root / "CMakeLists.txt");
+  EXPECT_NE(config.find("set(CMAKE_CXX_STANDARD 23)\n"), std::string::npos);
+  EXPECT_NE(config.find("add_subdirectory(beta)\n"), std::string::npos);
+  EXPECT_NE(
+      read_file(root / "alpha/CMakeLists.txt").find("REUSE_FROM fleet_pch"),
+      std::string::npos
+  );
+  EXPECT_EQ(
+      read_file(root / "beta/CMakeLists.txt").find("REUSE_FROM"),
+      std::string::npos
+  );
+
+  const GenerationReport again = generator.generate_workspace(workspace);
+  EXPECT_TRUE(again.written.empty());
+  EXPECT_EQ(again.unchanged.size(), 8u);
+}
+
+TEST_F(ProjectGeneratorTest, WorkspaceRejectsConflictingComponents)
+{
+  WorkspaceSpec workspace;
+  workspace.name        = "fleet";
+  workspace.destination = test_dir;
+  EXPECT_THROW(generator.generate_workspace(workspace), std::runtime_error);
+
+  workspace.projects = {spec, spec};
+  EXPECT_THROW(generator.generate_workspace(workspace), std::runtime_error);
+
+  workspace.projects.front().name = "cmake";
+  workspace.projects.pop_back();
+  EXPECT_THROW(generator.generate_workspace(workspace), std::runtime_error);
+  EXPECT_FALSE(std::filesystem::exists(test_dir / "fleet"));
+}
+
+TEST_F(ProjectGeneratorTest, WorkspaceRejectsCollidingModuleNames)
+{
+  WorkspaceSpec workspace;
+  workspace.name             = "fleet";
+  workspace.destination      = test_dir;
+  workspace.projects         = {spec, spec};
+  workspace.projects[0].name = "My-App";
+  workspace.projects[1].name = "my_app";
+  EXPECT_NO_THROW(generator.render_workspace(workspace));
+
+  workspace.projects[0].modules = true;
+  EXPECT_NO_THROW(generator.render_workspace(workspace));
+
+  workspace.projects[1].modules = true;
+  EXPECT_THROW(generator.render_workspace(workspace), std::runtime_error);
+}
+
+TEST_F(ProjectGeneratorTest, ModulesLayoutAddsInterfaceUnits)
+{
+  spec.name    = "my-app";
+  spec.modules = true;
+
+  const ProjectPlan plan = generator.render(spec);
+  const auto find_file = [&](const char *path) {
+    return std::ranges::find(
+        plan.files, std::filesystem::path(path), &PlannedFile::path
+    );
+  };
+
+  const auto main_source = find_file("src/main.cpp");
+  ASSERT_NE(main_source, plan.files.end());
+  EXPECT_NE(main_source->content.find("import my_app;"), std::string::npos);
+
+  const auto interface = find_file("src/my-app.cppm");
+  ASSERT_NE(interface, plan.files.end());
+  EXPECT_NE(
+      interface->content.find("export module my_app;"), std::string::npos
+  );
+
+  const auto partition = find_file("src/my-app-greeting.cppm");
+  ASSERT_NE(partition, plan.files.end());
+  EXPECT_NE(
+      partition->content.find("export module my_app:greeting;"),
+      std::string::npos
+  );
+  EXPECT_NE(find_file("cmake/CompareLayouts.cmake"), plan.files.end());
+}
+
+TEST_F(ProjectGeneratorTest, ModulesRequireCpp20)
+{
+  spec.modules  = true;
+  spec.standard = Standard::CPP17;
+  EXPECT_THROW(generator.render(spec), std::runtime_error);
+}
+
+TEST_F(InMemoryProjectGeneratorTest, FreshProjectIsWrittenInMemory)
+{
+  const GenerationReport report = generator.generate(spec);
+
+  EXPECT_EQ(report.written.size(), 4);
+  EXPECT_TRUE(file_system.exists("/projects/demo/include"));
+  EXPECT_NE(
+      read_file("/projects/demo/src/main.cpp").find("int main"),
+      std::string::npos
+  );
+  EXPECT_TRUE(
+      LockFile::parse(read_file("/projects/demo/.nexpp-lock"))
+          .find("CMakeLists.txt")
+          .has_value()
+  );
+  EXPECT_FALSE(std::filesystem::exists("/projects/demo"));
+}
+
+TEST_F(InMemoryProjectGeneratorTest, ChangedOptionRewritesOnlyAffectedFiles)
+{
+  generator.generate(spec);
+  spec.has_flags = true;
+
+  const GenerationReport report = generator.generate(spec);
+
+  ASSERT_EQ(report.written.size(), 1);
+  EXPECT_EQ(report.written.front(), "CMakeLists.txt");
+  EXPECT_EQ(report.unchanged.size(), 3);
+  EXPECT_NE(
+      read_file("/projects/demo/CMakeLists.txt").find("-Wall"),
+      std::string::npos
+  );
+}
+
+TEST_F(InMemoryProjectGeneratorTest, UserModifiedFileIsReportedAndKept)
+{
+  generator.generate(spec);
+  file_system.put_in_file("/projects/demo/src/main.cpp", "// mine\n");
+  spec.has_flags = true;
+
+  const GenerationReport report = generator.generate(spec);
+
+  ASSERT_EQ(report.conflicts.size(), 1);
+  EXPECT_EQ(report.conflicts.front(), std::filesystem::path("src/main.cpp"));
+  EXPECT_EQ(read_file("/projects/demo/src/main.cpp"), "// mine\n");
+}
+
+TEST_F(InMemoryProjectGeneratorTest, UnknownExistingFileIsNotOverwritten)
+{
+  file_system.create_folder("/", "projects");
+  file_system.create_folder("/projects", "demo");
+  file_system.put_in_file("/projects/demo/CMakeLists.txt", "handwritten\n");
+
+  const GenerationReport report = generator.generate(spec);
+
+  ASSERT_EQ(report.conflicts.size(), 1);
+  EXPECT_EQ(read_file("/projects/demo/CMakeLists.txt"), "handwritten\n");
+  EXPECT_TRUE(file_system.exists("/projects/demo/src/main.cpp"));
+}
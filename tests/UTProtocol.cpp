@@ -0,0 +1,89 @@
+#include "Nexpp/Server/Protocol.h"
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+TEST(ProtocolTest, RequestRoundTripsProjectSpec)
+{
+  ProjectSpec spec;
+  spec.name        = "service";
+  spec.destination = "/srv/projects";
+  spec.standard    = Standard::CPP17;
+  spec.libraries   = {"qt", "gtest"};
+  spec.has_flags   = true;
+  spec.perf        = {true, false, true};
+  spec.compiler    = CompilerFamily::Clang;
+  spec.toolchain   = {"clang++-18", "sccache", "lld"};
+
+  const QByteArray line = Protocol::encode_request(spec);
+  ASSERT_TRUE(line.endsWith('\n'));
+
+  const ProjectSpec decoded = Protocol::decode_request(line);
+  EXPECT_EQ(decoded.name, "service");
+  EXPECT_EQ(decoded.destination, std::filesystem::path("/srv/projects"));
+  EXPECT_EQ(decoded.standard, Standard::CPP17);
+  EXPECT_EQ(decoded.libraries, spec.libraries);
+  EXPECT_TRUE(decoded.has_flags);
+  EXPECT_EQ(decoded.perf, spec.perf);
+  EXPECT_EQ(decoded.compiler, CompilerFamily::Clang);
+  EXPECT_EQ(decoded.toolchain, spec.toolchain);
+}
+
+TEST(ProtocolTest, RequestDestinationIsMadeAbsolute)
+{
+  ProjectSpec spec;
+  spec.name        = "service";
+  spec.destination = "relative/dir";
+
+  const ProjectSpec decoded =
+      Protocol::decode_request(Protocol::encode_request(spec));
+  EXPECT_TRUE(decoded.destination.is_absolute());
+  EXPECT_EQ(decoded.destination, std::filesystem::absolute("relative/dir"));
+}
+
+TEST(ProtocolTest, RequestWithoutNameThrows)
+{
+  EXPECT_THROW(
+      Protocol::decode_request("{\"destination\": \"/tmp\"}\n"),
+      std::runtime_error
+  );
+}
+
+TEST(ProtocolTest, MalformedRequestThrows)
+{
+  EXPECT_THROW(Protocol::decode_request("not json\n"), std::runtime_error);
+}
+
+TEST(ProtocolTest, ResponseRoundTripsResult)
+{
+  BatchResult result;
+  result.project_name     = "service";
+  result.success          = true;
+  result.report.root      = "/srv/projects/service";
+  result.report.written   = {"CMakeLists.txt"};
+  result.report.unchanged = {"src/main.cpp"};
+  result.report.conflicts = {"include/service.h"};
+  result.duration         = std::chrono::microseconds(1234);
+
+  const BatchResult decoded =
+      Protocol::decode_response(Protocol::encode_response(result));
+  EXPECT_EQ(decoded.project_name, "service");
+  EXPECT_TRUE(decoded.success);
+  EXPECT_EQ(decoded.report.root, result.report.root);
+  EXPECT_EQ(decoded.report.written, result.report.written);
+  EXPECT_EQ(decoded.report.unchanged, result.report.unchanged);
+  EXPECT_EQ(decoded.report.conflicts, result.report.conflicts);
+  EXPECT_EQ(decoded.duration, std::chrono::microseconds(1234));
+}
+
+TEST(ProtocolTest, ResponseCarriesError)
+{
+  BatchResult result;
+  result.project_name = "service";
+  result.error        = "Cannot create file";
+
+  const BatchResult decoded =
+      Protocol::decode_response(Protocol::encode_response(result));
+  EXPECT_FALSE(decoded.success);
+  EXPECT_EQ(decoded.error, "Cannot create file");
+}
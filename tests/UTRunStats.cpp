@@ -0,0 +1,122 @@
+#include "Nexpp/Batch/BatchRunner.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include "Nexpp/Stats/RunStats.h"
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class RunStatsTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_stats/";
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+    RunStats::reset();
+    RunStats::start();
+  }
+
+  void TearDown() override
+  {
+    RunStats::stop();
+    RunStats::reset();
+    std::filesystem::remove_all(test_dir);
+  }
+};
+
+TEST_F(RunStatsTest, CountersAreSummedAcrossThreads)
+{
+  std::vector<std::thread> workers;
+  for(int worker = 0; worker < 4; ++worker) {
+    workers.emplace_back([] {
+      for(int i = 0; i < 1000; ++i) {
+        RunStats::add(StatCounter::Files);
+        RunStats::add(StatCounter::BytesWritten, 10);
+      }
+    });
+  }
+  for(auto &worker : workers) {
+    worker.join();
+  }
+
+  const StatsSnapshot snapshot = RunStats::snapshot();
+  EXPECT_EQ(snapshot.counter(StatCounter::Files), 4000u);
+  EXPECT_EQ(snapshot.counter(StatCounter::BytesWritten), 40000u);
+}
+
+TEST_F(RunStatsTest, NothingIsRecordedWhileStopped)
+{
+  RunStats::stop();
+  RunStats::add(StatCounter::Projects);
+  RunStats::record(StatLatency::Render, 1000);
+
+  const StatsSnapshot snapshot = RunStats::snapshot();
+  EXPECT_EQ(snapshot.counter(StatCounter::Projects), 0u);
+  EXPECT_EQ(snapshot.latency(StatLatency::Render).count, 0u);
+}
+
+TEST_F(RunStatsTest, BucketsBoundRelativeError)
+{
+  for(std::int64_t ns : {0L, 1L, 15L, 16L, 17L, 1000L, 123456789L}) {
+    const std::int64_t upper =
+        RunStats::bucket_upper_bound(RunStats::bucket_of(ns));
+    EXPECT_GE(upper, ns);
+    EXPECT_LE(upper - ns, ns / 8);
+  }
+}
+
+TEST_F(RunStatsTest, PercentilesFollowDistribution)
+{
+  for(std::int64_t us = 1; us <= 1000; ++us) {
+    RunStats::record(StatLatency::FileWrite, us * 1000);
+  }
+
+  const LatencySummary summary =
+      RunStats::snapshot().latency(StatLatency::FileWrite);
+  EXPECT_EQ(summary.count, 1000u);
+  EXPECT_NEAR(static_cast<double>(summary.p50_ns), 500'000.0, 62'500.0);
+  EXPECT_NEAR(static_cast<double>(summary.p95_ns), 950'000.0, 118'750.0);
+  EXPECT_NEAR(static_cast<double>(summary.p99_ns), 990'000.0, 123'750.0);
+  EXPECT_EQ(summary.max_ns, 1'000'000);
+  EXPECT_LE(summary.p99_ns, summary.max_ns);
+}
+
+TEST_F(RunStatsTest, GenerationIsCounted)
+{
+  ProjectSpec spec;
+  spec.name        = "demo";
+  spec.destination = test_dir;
+
+  const ProjectGenerator generator;
+  ASSERT_TRUE(BatchRunner::generate_one(generator, spec).success);
+
+  const StatsSnapshot snapshot = RunStats::snapshot();
+  EXPECT_EQ(snapshot.counter(StatCounter::Projects), 1u);
+  EXPECT_EQ(snapshot.counter(StatCounter::Files), 5u);
+  EXPECT_EQ(snapshot.counter(StatCounter::Directories), 3u);
+  EXPECT_GT(snapshot.counter(StatCounter::BytesWritten), 0u);
+  EXPECT_GT(snapshot.counter(StatCounter::Syscalls), 0u);
+  EXPECT_EQ(snapshot.latency(StatLatency::Project).count, 1u);
+  EXPECT_EQ(snapshot.latency(StatLatency::Render).count, 1u);
+  EXPECT_EQ(snapshot.latency(StatLatency::FileWrite).count, 5u);
+}
+
+TEST_F(RunStatsTest, JsonListsCountersAndLatencies)
+{
+  RunStats::add(StatCounter::Projects, 2);
+  RunStats::record(StatLatency::Project, 5000);
+
+  std::ostringstream out;
+  RunStats::write_json(out, RunStats::snapshot());
+
+  EXPECT_NE(out.str().find("\"projects\": 2"), std::string::npos);
+  EXPECT_NE(
+      out.str().find("\"project\": {\"count\": 1, \"p50\": 5000"),
+      std::string::npos
+  );
+}
@@ -0,0 +1,212 @@
+#include "Nexpp/FileSystem/FileCloner.h"
+#include "Nexpp/Generator/ContentHasher.h"
+#include "Nexpp/Generator/ProjectGenerator.h"
+#include "Nexpp/Generator/SkeletonCache.h"
+#include "Nexpp/Stats/RunStats.h"
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class SkeletonCacheTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_skeleton_cache/";
+  ProjectGenerator      generator {GenerationOptions {SyncPolicy::None}};
+  ProjectSpec           spec;
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+    spec.name        = "demo";
+    spec.destination = test_dir;
+    spec.libraries   = {"gtest", "benchmark"};
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  SkeletonCache::Renderer renderer() const
+  {
+    return [this](const ProjectSpec &sentinel) {
+      return generator.render(sentinel);
+    };
+  }
+
+  std::string read_file(const std::filesystem::path &file_path)
+  {
+    std::ifstream ifs(file_path, std::ios::binary);
+    return std::string(
+        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+    );
+  }
+
+  static std::vector<std::string> patterns_of(const Skeleton &skeleton)
+  {
+    std::vector<std::string> patterns;
+    for(const auto &file : skeleton.files()) {
+      patterns.push_back(file.pattern);
+    }
+    std::sort(patterns.begin(), patterns.end());
+    return patterns;
+  }
+};
+
+TEST_F(SkeletonCacheTest, KeyIgnoresNameAndDestination)
+{
+  ProjectSpec other = spec;
+  other.name        = "another";
+  other.destination = test_dir / "elsewhere";
+  EXPECT_EQ(SkeletonCache::key(spec), SkeletonCache::key(other));
+
+  other.libraries.pop_back();
+  EXPECT_NE(SkeletonCache::key(spec), SkeletonCache::key(other));
+
+  other            = spec;
+  other.perf.unity = true;
+  EXPECT_NE(SkeletonCache::key(spec), SkeletonCache::key(other));
+}
+
+TEST_F(SkeletonCacheTest, SkeletonHoldsOnlyNameIndependentFiles)
+{
+  SkeletonCache cache(test_dir / "cache");
+  const auto    skeleton = cache.acquire(spec, renderer());
+
+  ASSERT_NE(skeleton, nullptr);
+  EXPECT_EQ(skeleton->directory(), cache.directory(spec));
+  EXPECT_EQ(
+      patterns_of(*skeleton),
+      (std::vector<std::string> {
+          "bench/@name@_bench.cpp", "cmake/Dependencies.cmake",
+          "tests/@name@_test.cpp"
+      })
+  );
+  EXPECT_TRUE(std::filesystem::exists(
+      skeleton->directory() / "tests" / "@name@_test.cpp"
+  ));
+  EXPECT_FALSE(
+      std::filesystem::exists(skeleton->directory() / "CMakeLists.txt")
+  );
+}
+
+TEST_F(SkeletonCacheTest, MatchingStoredSkeletonIsNotRewritten)
+{
+  const auto stored =
+      SkeletonCache(test_dir / "cache").acquire(spec, renderer());
+
+  SkeletonCache cache(test_dir / "cache");
+  RunStats::reset();
+  RunStats::start();
+  const auto loaded = cache.acquire(spec, renderer());
+  RunStats::stop();
+  EXPECT_EQ(RunStats::snapshot().counter(StatCounter::Files), 0u);
+  RunStats::reset();
+
+  EXPECT_EQ(patterns_of(*loaded), patterns_of(*stored));
+
+  const auto again = cache.acquire(spec, [](const ProjectSpec &) {
+    ADD_FAILURE() << "skeleton was rendered again";
+    return ProjectPlan {};
+  });
+  EXPECT_EQ(again, loaded);
+}
+
+TEST_F(SkeletonCacheTest, SkeletonFromOtherTemplatesIsRewritten)
+{
+  SkeletonCache(test_dir / "cache")
+      .acquire(spec, [this](const ProjectSpec &sentinel) {
+        ProjectPlan plan = generator.render(sentinel);
+        for(auto &file : plan.files) {
+          file.content += "// older template\n";
+        }
+        return plan;
+      });
+
+  SkeletonCache     cache(test_dir / "cache");
+  const auto        skeleton = cache.acquire(spec, renderer());
+  const ProjectPlan plan     = generator.render(spec);
+  const auto        test     = std::ranges::find(
+      plan.files, std::string_view("tests/demo_test.cpp"), &PlannedFile::path
+  );
+  ASSERT_NE(test, plan.files.end());
+
+  const std::uint64_t hash = ContentHasher::hash(test->content);
+  EXPECT_EQ(
+      skeleton->find("tests/demo_test.cpp", "demo", hash),
+      skeleton->directory() / "tests/@name@_test.cpp"
+  );
+  EXPECT_EQ(
+      read_file(skeleton->directory() / "tests/@name@_test.cpp"),
+      std::string_view(test->content)
+  );
+}
+
+TEST_F(SkeletonCacheTest, FindRequiresMatchingNameAndHash)
+{
+  const Skeleton skeleton(
+      test_dir, {{"tests/@name@_test.cpp", 7}, {"cmake/Dependencies.cmake", 9}}
+  );
+
+  EXPECT_EQ(
+      skeleton.find("tests/demo_test.cpp", "demo", 7),
+      test_dir / "tests/@name@_test.cpp"
+  );
+  EXPECT_FALSE(skeleton.find("tests/demo_test.cpp", "demo", 8));
+  EXPECT_FALSE(skeleton.find("tests/demo_test.cpp", "other", 7));
+  EXPECT_FALSE(skeleton.find("tests/demox_test.cpp", "demo", 7));
+  EXPECT_TRUE(skeleton.find("cmake/Dependencies.cmake", "any", 9));
+}
+
+TEST_F(SkeletonCacheTest, ClonedProjectMatchesWrittenProject)
+{
+  GenerationOptions options {SyncPolicy::None};
+  options.skeleton_cache = test_dir / "cache";
+  const ProjectGenerator cached(options);
+
+  ProjectSpec plain_spec = spec;
+  plain_spec.destination = test_dir / "plain";
+  spec.destination       = test_dir / "cached";
+  std::filesystem::create_directories(plain_spec.destination);
+  std::filesystem::create_directories(spec.destination);
+
+  const GenerationReport plain = generator.generate(plain_spec);
+
+  RunStats::reset();
+  RunStats::start();
+  const GenerationReport cloned = cached.generate(spec);
+  RunStats::stop();
+  const bool reflinks = FileCloner::supports_reflink(test_dir.c_str());
+  EXPECT_EQ(
+      RunStats::snapshot().counter(StatCounter::ClonedFiles),
+      reflinks ? 3u : 0u
+  );
+  RunStats::reset();
+
+  EXPECT_EQ(cloned.written, plain.written);
+  EXPECT_TRUE(std::filesystem::exists(
+      SkeletonCache(options.skeleton_cache).directory(spec)
+  ));
+
+  const std::filesystem::path plain_root  = plain_spec.destination / "demo";
+  const std::filesystem::path cached_root = spec.destination / "demo";
+  std::size_t                 files       = 0;
+  for(const auto &entry :
+      std::filesystem::recursive_directory_iterator(plain_root)) {
+    if(!entry.is_regular_file()) {
+      continue;
+    }
+    const auto relative = entry.path().lexically_relative(plain_root);
+    EXPECT_EQ(read_file(cached_root / relative), read_file(entry.path()))
+        << relative;
+    ++files;
+  }
+  EXPECT_GT(files, 3u);
+}
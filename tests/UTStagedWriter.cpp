@@ -0,0 +1,184 @@
+#include "Nexpp/FileSystem/StagedWriter.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <string>
+
+class StagedWriterTest : public ::testing::TestWithParam<SyncPolicy>
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_staged/";
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  std::string read_file(const std::filesystem::path &file_path)
+  {
+    std::ifstream ifs(file_path);
+    return std::string(
+        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>()
+    );
+  }
+
+  std::size_t count_entries(const std::filesystem::path &path)
+  {
+    return static_cast<std::size_t>(std::distance(
+        std::filesystem::directory_iterator(path),
+        std::filesystem::directory_iterator()
+    ));
+  }
+};
+
+TEST_P(StagedWriterTest, NothingIsVisibleBeforeCommit)
+{
+  StagedWriter writer(test_dir / "project", GetParam());
+  writer.create_folder("src");
+  writer.write_file("src/main.cpp", "int main() {}\n");
+
+  EXPECT_FALSE(std::filesystem::exists(test_dir / "project"));
+  EXPECT_TRUE(std::filesystem::exists(writer.staging_path() / "src/main.cpp"));
+}
+
+TEST_P(StagedWriterTest, CommitPublishesWholeTree)
+{
+  StagedWriter writer(test_dir / "project", GetParam());
+  writer.create_folder("src");
+  writer.create_folder("include");
+  writer.write_file("CMakeLists.txt", "project(project)\n");
+  writer.write_file("src/main.cpp", "int main() {}\n");
+  writer.commit();
+
+  EXPECT_EQ(
+      read_file(test_dir / "project/CMakeLists.txt"), "project(project)\n"
+  );
+  EXPECT_EQ(read_file(test_dir / "project/src/main.cpp"), "int main() {}\n");
+  EXPECT_TRUE(std::filesystem::is_directory(test_dir / "project/include"));
+  EXPECT_EQ(count_entries(test_dir), 1);
+}
+
+TEST_P(StagedWriterTest, DestructionWithoutCommitRollsBack)
+{
+  {
+    StagedWriter writer(test_dir / "project", GetParam());
+    writer.write_file("CMakeLists.txt", "project(project)\n");
+  }
+
+  EXPECT_FALSE(std::filesystem::exists(test_dir / "project"));
+  EXPECT_EQ(count_entries(test_dir), 0);
+}
+
+TEST_P(StagedWriterTest, CommitIntoExistingProjectKeepsOtherFiles)
+{
+  std::filesystem::create_directories(test_dir / "project/src");
+  std::ofstream(test_dir / "project/src/user.cpp") << "user";
+  std::ofstream(test_dir / "project/CMakeLists.txt") << "old";
+
+  StagedWriter writer(test_dir / "project", GetParam());
+  writer.create_folder("src");
+  writer.write_file("CMakeLists.txt", "new");
+  writer.write_file("src/main.cpp", "main");
+  writer.commit();
+
+  EXPECT_EQ(read_file(test_dir / "project/CMakeLists.txt"), "new");
+  EXPECT_EQ(read_file(test_dir / "project/src/main.cpp"), "main");
+  EXPECT_EQ(read_file(test_dir / "project/src/user.cpp"), "user");
+  EXPECT_EQ(count_entries(test_dir), 1);
+}
+
+TEST_P(StagedWriterTest, FailedPublishRestoresExistingProject)
+{
+  std::filesystem::create_directories(test_dir / "project/src");
+  std::ofstream(test_dir / "project/CMakeLists.txt") << "old";
+  std::ofstream(test_dir / "project/src/main.cpp") << "old main";
+
+  StagedWriter writer(test_dir / "project", GetParam());
+  writer.create_folder("src");
+  writer.create_folder("tests");
+  writer.write_file("CMakeLists.txt", "new");
+  writer.write_file("tests/demo_test.cpp", "test");
+  writer.write_file("src/main.cpp", "new main");
+  std::filesystem::remove(writer.staging_path() / "src/main.cpp");
+
+  EXPECT_THROW(writer.commit(), std::system_error);
+  EXPECT_EQ(read_file(test_dir / "project/CMakeLists.txt"), "old");
+  EXPECT_EQ(read_file(test_dir / "project/src/main.cpp"), "old main");
+  EXPECT_FALSE(std::filesystem::exists(test_dir / "project/tests"));
+}
+
+TEST_P(StagedWriterTest, LayoutIsPublishedIntoExistingProject)
+{
+  std::filesystem::create_directories(test_dir / "project");
+  std::ofstream(test_dir / "project/README.md") << "keep\n";
+
+  LayoutTree layout;
+  layout.add_file("src/main.cpp", "int main() {}\n");
+  layout.add_symlink("compile_commands.json", "build/compile_commands.json");
+
+  StagedWriter writer(test_dir / "project", GetParam());
+  writer.write_layout(layout);
+  writer.commit();
+
+  EXPECT_EQ(read_file(test_dir / "project/README.md"), "keep\n");
+  EXPECT_EQ(read_file(test_dir / "project/src/main.cpp"), "int main() {}\n");
+  EXPECT_TRUE(
+      std::filesystem::is_symlink(test_dir / "project/compile_commands.json")
+  );
+}
+
+TEST_P(StagedWriterTest, WritingOutsideCreatedFolderThrows)
+{
+  StagedWriter writer(test_dir / "project", GetParam());
+  EXPECT_THROW(writer.write_file("missing/file.txt", "x"), std::system_error);
+}
+
+TEST_P(StagedWriterTest, MissingParentsAreCreated)
+{
+  StagedWriter writer(test_dir / "./nested/deeper/../project/", GetParam());
+  writer.write_file("CMakeLists.txt", "project(project)\n");
+  writer.commit();
+
+  EXPECT_EQ(
+      read_file(test_dir / "nested/project/CMakeLists.txt"),
+      "project(project)\n"
+  );
+  EXPECT_EQ(count_entries(test_dir / "nested"), 1);
+}
+
+TEST_P(StagedWriterTest, BookkeepingStaysInGivenResource)
+{
+  std::pmr::monotonic_buffer_resource arena;
+  SyncFileSystemBackend               backend;
+  {
+    StagedWriter writer(test_dir / "project", GetParam(), backend, &arena);
+    writer.create_folder("src");
+    writer.write_file("src/a_rather_long_source_file_name.cpp", "\n");
+    writer.commit();
+  }
+
+  EXPECT_TRUE(std::filesystem::exists(
+      test_dir / "project/src/a_rather_long_source_file_name.cpp"
+  ));
+}
+
+TEST_P(StagedWriterTest, CommitTwiceThrows)
+{
+  StagedWriter writer(test_dir / "project", GetParam());
+  writer.commit();
+  EXPECT_THROW(writer.commit(), std::logic_error);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SyncPolicies, StagedWriterTest,
+    ::testing::Values(
+        SyncPolicy::None, SyncPolicy::PerProject, SyncPolicy::PerFile
+    )
+);
@@ -0,0 +1,76 @@
+#include "Nexpp/Template/Template.h"
+#include <gtest/gtest.h>
+#include <string>
+
+TEST(TemplateTest, LiteralOnlyTemplateRendersAsIs)
+{
+  using Literal = Template<"no placeholders here\n">;
+  static_assert(Literal::placeholder_count == 0);
+  static_assert(Literal::segment_count == 1);
+  EXPECT_EQ(Literal::render(), "no placeholders here\n");
+}
+
+TEST(TemplateTest, PlaceholdersAreSplitAtCompileTime)
+{
+  using Greeting = Template<"Hello %1, welcome to %2!">;
+  static_assert(Greeting::placeholder_count == 2);
+  static_assert(Greeting::segment_count == 5);
+  static_assert(Greeting::literal_size == 20);
+  EXPECT_EQ(Greeting::render("Ada", "Nexpp"), "Hello Ada, welcome to Nexpp!");
+}
+
+TEST(TemplateTest, RepeatedPlaceholderUsesSameValue)
+{
+  using Repeated = Template<"%1-%2-%1">;
+  static_assert(Repeated::placeholder_count == 2);
+  EXPECT_EQ(Repeated::render("a", "b"), "a-b-a");
+}
+
+TEST(TemplateTest, DoublePercentIsLiteralPercent)
+{
+  using Percent = Template<"100%% of %1">;
+  static_assert(Percent::placeholder_count == 1);
+  EXPECT_EQ(Percent::render("tests"), "100% of tests");
+}
+
+TEST(TemplateTest, TypedValuesAreConverted)
+{
+  using Typed = Template<"std=%1 count=%2 name=%3">;
+  EXPECT_EQ(
+      Typed::render(Standard::CPP20, 42, std::string("svc")),
+      "std=20 count=42 name=svc"
+  );
+}
+
+TEST(TemplateTest, SizeMatchesRenderedOutput)
+{
+  using Sized = Template<"project(%1)\nset(CMAKE_CXX_STANDARD %2)\n">;
+  EXPECT_EQ(
+      Sized::size("demo", Standard::CPP17),
+      Sized::render("demo", Standard::CPP17).size()
+  );
+}
+
+TEST(TemplateTest, AppendToKeepsExistingContent)
+{
+  using Line = Template<"%1\n">;
+  std::string output = "first\n";
+  output.reserve(output.size() + Line::size("second"));
+  Line::append_to(output, "second");
+  EXPECT_EQ(output, "first\nsecond\n");
+}
+
+TEST(TemplateTest, CMakeVariablesAreNotPlaceholders)
+{
+  using CMake = Template<"${CMAKE_CURRENT_SOURCE_DIR}/%1">;
+  EXPECT_EQ(CMake::render("include"), "${CMAKE_CURRENT_SOURCE_DIR}/include");
+}
+
+TEST(TemplateTest, WriteToStreamsTheSameBytesAsRender)
+{
+  using Config = Template<"project(%1)\nset(CMAKE_CXX_STANDARD %2)\n">;
+  std::string output;
+  StringSink  sink(output);
+  Config::write_to(sink, "demo", Standard::CPP17);
+  EXPECT_EQ(output, Config::render("demo", Standard::CPP17));
+}
@@ -0,0 +1,88 @@
+#include "Nexpp/Batch/ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+TEST(ThreadPoolTest, RunsEverySubmittedTask)
+{
+  ThreadPool       pool(4);
+  std::atomic<int> counter = 0;
+
+  for(int i = 0; i < 1000; ++i) {
+    pool.submit([&] { ++counter; });
+  }
+  pool.wait_idle();
+
+  EXPECT_EQ(counter, 1000);
+}
+
+TEST(ThreadPoolTest, WaitIdleWithoutTasksReturns)
+{
+  ThreadPool pool(2);
+  pool.wait_idle();
+  SUCCEED();
+}
+
+TEST(ThreadPoolTest, ZeroThreadsFallsBackToOne)
+{
+  ThreadPool pool(0);
+  EXPECT_EQ(pool.size(), 1);
+}
+
+TEST(ThreadPoolTest, TasksSubmittedFromWorkersAreExecuted)
+{
+  ThreadPool       pool(4);
+  std::atomic<int> counter = 0;
+
+  for(int i = 0; i < 10; ++i) {
+    pool.submit([&] {
+      for(int j = 0; j < 10; ++j) {
+        pool.submit([&] { ++counter; });
+      }
+    });
+  }
+  pool.wait_idle();
+
+  EXPECT_EQ(counter, 100);
+}
+
+TEST(ThreadPoolTest, IdleWorkersStealQueuedTasks)
+{
+  ThreadPool                pool(4);
+  std::mutex                mutex;
+  std::set<std::thread::id> threads;
+  std::atomic<int>          counter = 0;
+
+  pool.submit([&] {
+    for(int i = 0; i < 64; ++i) {
+      pool.submit([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard lock(mutex);
+        threads.insert(std::this_thread::get_id());
+        ++counter;
+      });
+    }
+  });
+  pool.wait_idle();
+
+  EXPECT_EQ(counter, 64);
+  EXPECT_GT(threads.size(), 1);
+}
+
+TEST(ThreadPoolTest, ThrowingTaskDoesNotBlockWaitIdle)
+{
+  ThreadPool       pool(2);
+  std::atomic<int> counter = 0;
+
+  pool.submit([] { throw std::runtime_error("task failed"); });
+  for(int i = 0; i < 10; ++i) {
+    pool.submit([&] { ++counter; });
+  }
+  pool.wait_idle();
+
+  EXPECT_EQ(counter, 10);
+}
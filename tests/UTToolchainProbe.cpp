@@ -0,0 +1,150 @@
+#include "Nexpp/Toolchain/ToolchainProbe.h"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+class ToolchainProbeTest : public ::testing::Test
+{
+protected:
+  std::filesystem::path test_dir = "test_tmp_toolchain/";
+
+  void                  SetUp() override
+  {
+    std::filesystem::remove_all(test_dir);
+    std::filesystem::create_directory(test_dir);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(test_dir);
+  }
+
+  std::filesystem::path
+      make_program(const std::string &name, const std::string &body = "")
+  {
+    const std::filesystem::path path = test_dir / name;
+    std::ofstream(path) << "#!/bin/sh\n" << body;
+    std::filesystem::permissions(
+        path, std::filesystem::perms::owner_all,
+        std::filesystem::perm_options::replace
+    );
+    return path;
+  }
+};
+
+TEST_F(ToolchainProbeTest, FamilyIsTakenFromCompilerName)
+{
+  EXPECT_EQ(
+      ToolchainProbe::family_of(make_program("g++-12")), CompilerFamily::GCC
+  );
+  EXPECT_EQ(
+      ToolchainProbe::family_of(make_program("clang++-17")),
+      CompilerFamily::Clang
+  );
+  EXPECT_FALSE(ToolchainProbe::family_of(make_program("icpx")).has_value());
+}
+
+TEST_F(ToolchainProbeTest, FamilyFollowsSymlinks)
+{
+  make_program("clang++");
+  std::filesystem::create_symlink("clang++", test_dir / "c++");
+
+  EXPECT_EQ(
+      ToolchainProbe::family_of(test_dir / "c++"), CompilerFamily::Clang
+  );
+}
+
+TEST_F(ToolchainProbeTest, FindProgramRequiresExecutable)
+{
+  const std::filesystem::path program = make_program("tool");
+  std::ofstream(test_dir / "data") << "plain\n";
+
+  EXPECT_EQ(ToolchainProbe::find_program(program.string()), program);
+  EXPECT_FALSE(
+      ToolchainProbe::find_program((test_dir / "data").string()).has_value()
+  );
+  EXPECT_FALSE(
+      ToolchainProbe::find_program("nexpp-no-such-tool").has_value()
+  );
+}
+
+TEST_F(ToolchainProbeTest, CompilerVersionIsCachedByPathAndMtime)
+{
+  const std::filesystem::path compiler =
+      make_program("g++-test", "echo 13.2.0\n");
+  const std::filesystem::path cache_file = test_dir / "toolchain.cache";
+  const auto                  mtime =
+      std::filesystem::last_write_time(compiler);
+
+  {
+    ToolchainProbe probe(cache_file);
+    EXPECT_EQ(probe.compiler_version(compiler), 13);
+  }
+
+  make_program("g++-test", "exit 1\n");
+  std::filesystem::last_write_time(compiler, mtime);
+  EXPECT_EQ(ToolchainProbe(cache_file).compiler_version(compiler), 13);
+
+  make_program("g++-test", "echo 14\n");
+  std::filesystem::last_write_time(compiler, mtime + std::chrono::seconds(10));
+  EXPECT_EQ(ToolchainProbe(cache_file).compiler_version(compiler), 14);
+}
+
+TEST_F(ToolchainProbeTest, ProbeSelectsCompilerAndAccelerators)
+{
+  make_program("g++", "echo 9\n");
+  make_program("g++-13", "echo 13\n");
+  make_program("ccache");
+  make_program("mold");
+
+  const std::string path = std::getenv("PATH");
+  setenv("PATH", std::filesystem::absolute(test_dir).c_str(), 1);
+  const Toolchain toolchain =
+      ToolchainProbe(test_dir / "toolchain.cache")
+          .probe(CompilerFamily::GCC, Standard::CPP23);
+  setenv("PATH", path.c_str(), 1);
+
+  EXPECT_EQ(toolchain.compiler, "g++-13");
+  EXPECT_EQ(toolchain.launcher, "ccache");
+  EXPECT_EQ(toolchain.linker, "mold");
+}
+
+TEST_F(ToolchainProbeTest, ProbeKeepsDefaultCompilerWhenItQualifies)
+{
+  make_program("g++", "echo 12\n");
+  make_program("ld.lld");
+
+  const std::string path = std::getenv("PATH");
+  setenv("PATH", std::filesystem::absolute(test_dir).c_str(), 1);
+  const Toolchain toolchain =
+      ToolchainProbe(test_dir / "toolchain.cache")
+          .probe(CompilerFamily::GCC, Standard::CPP17);
+  setenv("PATH", path.c_str(), 1);
+
+  EXPECT_EQ(toolchain.compiler, "g++");
+  EXPECT_EQ(toolchain.launcher, "");
+  EXPECT_EQ(toolchain.linker, "lld");
+}
+
+TEST_F(ToolchainProbeTest, MoldNeedsVersion12ForEitherFamily)
+{
+  make_program("clang++", "echo 11\n");
+  make_program("g++", "echo 12\n");
+  make_program("mold");
+  make_program("ld.lld");
+
+  const std::string path = std::getenv("PATH");
+  setenv("PATH", std::filesystem::absolute(test_dir).c_str(), 1);
+  ToolchainProbe  probe(test_dir / "toolchain.cache");
+  const Toolchain clang = probe.probe(CompilerFamily::Clang, Standard::CPP17);
+  const Toolchain gcc   = probe.probe(CompilerFamily::GCC, Standard::CPP17);
+  setenv("PATH", path.c_str(), 1);
+
+  EXPECT_EQ(clang.compiler, "clang++");
+  EXPECT_EQ(clang.linker, "lld");
+  EXPECT_EQ(gcc.compiler, "g++");
+  EXPECT_EQ(gcc.linker, "mold");
+}
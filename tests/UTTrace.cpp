@@ -0,0 +1,86 @@
+#include "Nexpp/Trace/Trace.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+class TraceTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    Trace::clear();
+    Trace::start();
+  }
+
+  void TearDown() override
+  {
+    Trace::stop();
+    Trace::clear();
+  }
+
+  std::string written_trace()
+  {
+    std::ostringstream out;
+    Trace::write(out);
+    return out.str();
+  }
+};
+
+TEST_F(TraceTest, SpansAreRecordedOnlyWhileEnabled)
+{
+  {
+    const TraceSpan span("enabled");
+  }
+
+  Trace::stop();
+  {
+    const TraceSpan span("disabled");
+  }
+
+  EXPECT_EQ(Trace::event_count(), 1u);
+  const std::string trace = written_trace();
+  EXPECT_NE(trace.find("\"name\":\"enabled\""), std::string::npos);
+  EXPECT_EQ(trace.find("\"name\":\"disabled\""), std::string::npos);
+}
+
+TEST_F(TraceTest, CompleteEventsCarryThreadAndDetail)
+{
+  {
+    const TraceSpan span("render", "demo \"quoted\"\n");
+  }
+
+  const std::string trace = written_trace();
+  EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+  EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(
+      trace.find("\"tid\":" + std::to_string(::gettid())), std::string::npos
+  );
+  EXPECT_NE(
+      trace.find("\"args\":{\"detail\":\"demo \\\"quoted\\\"\\n\"}"),
+      std::string::npos
+  );
+}
+
+TEST_F(TraceTest, EachThreadGetsItsOwnTrack)
+{
+  pid_t worker_id = 0;
+  std::thread worker([&] {
+    worker_id = ::gettid();
+    const TraceSpan span("worker");
+  });
+  worker.join();
+  {
+    const TraceSpan span("main");
+  }
+
+  const std::string trace = written_trace();
+  EXPECT_EQ(Trace::event_count(), 2u);
+  EXPECT_NE(
+      trace.find("\"tid\":" + std::to_string(worker_id)), std::string::npos
+  );
+  EXPECT_NE(
+      trace.find("\"tid\":" + std::to_string(::gettid())), std::string::npos
+  );
+}